@@ -23,6 +23,7 @@
 #include <list>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -33,6 +34,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/table_builder.h"
@@ -127,6 +129,53 @@ class ArrowInputFile : public liborc::InputStream {
   std::shared_ptr<io::RandomAccessFile> file_;
 };
 
+// Convert the minimum and maximum of ORC column statistics to scalars of the
+// corresponding Arrow type, leaving them null if not available
+Status GetStatisticsMinMax(const liborc::ColumnStatistics& statistics,
+                           const std::shared_ptr<DataType>& type,
+                           std::shared_ptr<Scalar>* min, std::shared_ptr<Scalar>* max) {
+  std::shared_ptr<Scalar> orc_min, orc_max;
+  if (auto integer_statistics =
+          dynamic_cast<const liborc::IntegerColumnStatistics*>(&statistics)) {
+    if (!integer_statistics->hasMinimum() || !integer_statistics->hasMaximum()) {
+      return Status::OK();
+    }
+    orc_min = std::make_shared<Int64Scalar>(integer_statistics->getMinimum());
+    orc_max = std::make_shared<Int64Scalar>(integer_statistics->getMaximum());
+  } else if (auto double_statistics =
+                 dynamic_cast<const liborc::DoubleColumnStatistics*>(&statistics)) {
+    if (!double_statistics->hasMinimum() || !double_statistics->hasMaximum()) {
+      return Status::OK();
+    }
+    orc_min = std::make_shared<DoubleScalar>(double_statistics->getMinimum());
+    orc_max = std::make_shared<DoubleScalar>(double_statistics->getMaximum());
+  } else if (auto string_statistics =
+                 dynamic_cast<const liborc::StringColumnStatistics*>(&statistics)) {
+    if (!string_statistics->hasMinimum() || !string_statistics->hasMaximum()) {
+      return Status::OK();
+    }
+    orc_min = std::make_shared<StringScalar>(string_statistics->getMinimum());
+    orc_max = std::make_shared<StringScalar>(string_statistics->getMaximum());
+  } else if (auto date_statistics =
+                 dynamic_cast<const liborc::DateColumnStatistics*>(&statistics)) {
+    if (!date_statistics->hasMinimum() || !date_statistics->hasMaximum()) {
+      return Status::OK();
+    }
+    orc_min = std::make_shared<Date32Scalar>(date_statistics->getMinimum());
+    orc_max = std::make_shared<Date32Scalar>(date_statistics->getMaximum());
+  } else {
+    return Status::OK();
+  }
+  if (orc_min->type->Equals(*type)) {
+    *min = std::move(orc_min);
+    *max = std::move(orc_max);
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(*min, orc_min->CastTo(type));
+  ARROW_ASSIGN_OR_RAISE(*max, orc_max->CastTo(type));
+  return Status::OK();
+}
+
 struct StripeInformation {
   uint64_t offset;
   uint64_t length;
@@ -215,6 +264,46 @@ class ORCFileReader::Impl {
 
   int64_t NumberOfStripes() { return stripes_.size(); }
 
+  Result<int64_t> NumberOfRowsInStripe(int64_t stripe) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    return static_cast<int64_t>(stripes_[stripe].num_rows);
+  }
+
+  Result<std::vector<StripeFieldStatistics>> ReadStripeStatistics(int64_t stripe) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(&schema));
+    std::vector<StripeFieldStatistics> out(schema->num_fields());
+
+    uint64_t num_stripe_statistics;
+    try {
+      num_stripe_statistics = reader_->getNumberOfStripeStatistics();
+    } catch (const std::logic_error&) {
+      // The file has no stripe statistics
+      return out;
+    }
+    if (static_cast<uint64_t>(stripe) >= num_stripe_statistics) {
+      return out;
+    }
+
+    const liborc::Type& type = reader_->getType();
+    std::unique_ptr<liborc::StripeStatistics> stripe_statistics;
+    ORC_CATCH_NOT_OK(stripe_statistics = reader_->getStripeStatistics(stripe));
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      const liborc::ColumnStatistics* statistics =
+          stripe_statistics->getColumnStatistics(
+              static_cast<uint32_t>(type.getSubtype(i)->getColumnId()));
+      if (statistics == nullptr) continue;
+      out[i].num_values = static_cast<int64_t>(statistics->getNumberOfValues());
+      out[i].has_null = statistics->hasNull();
+      RETURN_NOT_OK(GetStatisticsMinMax(*statistics, schema->field(i)->type(),
+                                        &out[i].min, &out[i].max));
+    }
+    return out;
+  }
+
   int64_t NumberOfRows() { return reader_->getNumberOfRows(); }
 
   Status ReadSchema(std::shared_ptr<Schema>* out) {
@@ -548,8 +637,17 @@ Result<std::shared_ptr<RecordBatchReader>> ORCFileReader::NextStripeReader(
   return reader;
 }
 
+Result<std::vector<StripeFieldStatistics>> ORCFileReader::ReadStripeStatistics(
+    int64_t stripe) {
+  return impl_->ReadStripeStatistics(stripe);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
+Result<int64_t> ORCFileReader::NumberOfRowsInStripe(int64_t stripe) {
+  return impl_->NumberOfRowsInStripe(stripe);
+}
+
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
 namespace {
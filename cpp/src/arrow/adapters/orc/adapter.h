@@ -34,6 +34,19 @@ namespace arrow {
 namespace adapters {
 namespace orc {
 
+/// \brief Statistics of a top-level field of an ORC file within a single stripe
+struct ARROW_EXPORT StripeFieldStatistics {
+  /// The number of non-null values, or -1 if no statistics were written
+  int64_t num_values = -1;
+  /// Whether the field may contain nulls
+  bool has_null = true;
+  /// The minimum and maximum values, or null if unknown
+  ///
+  /// These are only available for integer, floating point, string and date fields.
+  std::shared_ptr<Scalar> min;
+  std::shared_ptr<Scalar> max;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -228,9 +241,23 @@ class ARROW_EXPORT ORCFileReader {
   Result<std::shared_ptr<RecordBatchReader>> NextStripeReader(
       int64_t batch_size, const std::vector<int>& include_indices);
 
+  /// \brief Read the statistics of the top-level fields within a stripe
+  ///
+  /// Statistics are not decoded from the stripe data, so this is much cheaper than
+  /// reading the stripe.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \return the statistics of each field of the file schema, in order
+  Result<std::vector<StripeFieldStatistics>> ReadStripeStatistics(int64_t stripe);
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
+  /// \brief The number of rows in a stripe
+  ///
+  /// \param[in] stripe the stripe index
+  Result<int64_t> NumberOfRowsInStripe(int64_t stripe);
+
   /// \brief The number of rows in the file
   int64_t NumberOfRows();
 
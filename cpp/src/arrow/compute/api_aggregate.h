@@ -173,6 +173,22 @@ class ARROW_EXPORT TDigestOptions : public FunctionOptions {
   uint32_t min_count;
 };
 
+/// \brief Control ApproximateCountDistinct kernel behavior
+///
+/// The relative standard error of the estimate is about 1.04 / sqrt(2^precision),
+/// and each sketch uses 2^precision bytes.  By default, the error is about 1.6%.
+class ARROW_EXPORT ApproximateCountDistinctOptions : public FunctionOptions {
+ public:
+  explicit ApproximateCountDistinctOptions(uint32_t precision = 12);
+  constexpr static char const kTypeName[] = "ApproximateCountDistinctOptions";
+  static ApproximateCountDistinctOptions Defaults() {
+    return ApproximateCountDistinctOptions{};
+  }
+
+  /// HyperLogLog precision, between 4 and 18 inclusive, default 12
+  uint32_t precision;
+};
+
 /// \brief Control Index kernel behavior
 class ARROW_EXPORT IndexOptions : public FunctionOptions {
  public:
@@ -380,6 +396,24 @@ Result<Datum> TDigest(const Datum& value,
                       const TDigestOptions& options = TDigestOptions::Defaults(),
                       ExecContext* ctx = NULLPTR);
 
+/// \brief Estimate the number of distinct values in an array with HyperLogLog
+///
+/// Null values are ignored.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see ApproximateCountDistinctOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as an Int64Scalar
+///
+/// \since 6.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> ApproximateCountDistinct(
+    const Datum& value,
+    const ApproximateCountDistinctOptions& options =
+        ApproximateCountDistinctOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
 /// \brief Find the first index of a value in an array.
 ///
 /// \param[in] value The array to search.
@@ -436,6 +436,10 @@ Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
 ///
+/// If the input is a large ChunkedArray and ctx->use_threads() is true, ranges
+/// of chunks are hashed in parallel and the results merged, keeping the values
+/// in order of first occurrence.
+///
 /// \param[in] datum array-like input
 /// \param[in] ctx the function execution context, optional
 /// \return result as Array
@@ -481,6 +485,10 @@ Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
 /// If the input is already dictionary encoded this function is a no-op unless
 /// it needs to modify the null_encoding (TODO)
 ///
+/// If the input is a large ChunkedArray and ctx->use_threads() is true, ranges
+/// of chunks are encoded in parallel, then their dictionaries are merged and
+/// their indices remapped.  The result is the same as a serial execution.
+///
 /// \param[in] data array-like input
 /// \param[in] ctx the function execution context, optional
 /// \param[in] options configures null encoding behavior
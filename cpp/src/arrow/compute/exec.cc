@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernel.h"
@@ -43,6 +45,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -56,7 +59,9 @@ namespace arrow {
 using internal::BitmapAnd;
 using internal::checked_cast;
 using internal::CopyBitmap;
+using internal::CountSetBits;
 using internal::CpuInfo;
+using internal::VisitSetBitRunsVoid;
 
 namespace compute {
 
@@ -71,8 +76,19 @@ ExecBatch::ExecBatch(const RecordBatch& batch)
   std::move(columns.begin(), columns.end(), values.begin());
 }
 
+namespace {
+
+bool SelectionsEqual(const std::shared_ptr<SelectionVector>& left,
+                     const std::shared_ptr<SelectionVector>& right) {
+  if (left == nullptr || right == nullptr) return left == right;
+  return MakeArray(left->data())->Equals(*MakeArray(right->data()));
+}
+
+}  // namespace
+
 bool ExecBatch::Equals(const ExecBatch& other) const {
-  return guarantee == other.guarantee && values == other.values;
+  return guarantee == other.guarantee && values == other.values &&
+         SelectionsEqual(selection_vector, other.selection_vector);
 }
 
 void PrintTo(const ExecBatch& batch, std::ostream* os) {
@@ -84,6 +100,13 @@ void PrintTo(const ExecBatch& batch, std::ostream* os) {
   if (batch.guarantee != literal(true)) {
     *os << indent << "Guarantee: " << batch.guarantee.ToString() << "\n";
   }
+  if (batch.selection_vector) {
+    PrettyPrintOptions options;
+    options.skip_new_lines = true;
+    *os << indent << "Selection: ";
+    ARROW_CHECK_OK(PrettyPrint(*MakeArray(batch.selection_vector->data()), options, os));
+    *os << "\n";
+  }
 
   int i = 0;
   for (const Datum& value : batch.values) {
@@ -111,6 +134,12 @@ std::string ExecBatch::ToString() const {
 
 ExecBatch ExecBatch::Slice(int64_t offset, int64_t length) const {
   ExecBatch out = *this;
+  if (selection_vector) {
+    // The values are indexed through the selection, so only the selection is sliced
+    out.selection_vector = selection_vector->Slice(offset, length);
+    out.length = out.selection_vector->length();
+    return out;
+  }
   for (auto& value : out.values) {
     if (value.is_scalar()) continue;
     value = value.array()->Slice(offset, length);
@@ -119,6 +148,38 @@ ExecBatch ExecBatch::Slice(int64_t offset, int64_t length) const {
   return out;
 }
 
+namespace {
+
+int64_t TotalBufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) size += buffer->size();
+  }
+  for (const auto& child : data.child_data) {
+    size += TotalBufferSize(*child);
+  }
+  if (data.dictionary) {
+    size += TotalBufferSize(*data.dictionary);
+  }
+  return size;
+}
+
+}  // namespace
+
+int64_t ExecBatch::TotalBufferSize() const {
+  int64_t size = 0;
+  for (const auto& value : values) {
+    if (value.is_array()) {
+      size += compute::TotalBufferSize(*value.array());
+    } else if (value.is_arraylike()) {
+      for (const auto& chunk : value.chunked_array()->chunks()) {
+        size += compute::TotalBufferSize(*chunk->data());
+      }
+    }
+  }
+  return size;
+}
+
 Result<ExecBatch> ExecBatch::Make(std::vector<Datum> values) {
   if (values.empty()) {
     return Status::Invalid("Cannot infer ExecBatch length without at least one value");
@@ -150,6 +211,12 @@ Result<ExecBatch> ExecBatch::Make(std::vector<Datum> values) {
 
 Result<std::shared_ptr<RecordBatch>> ExecBatch::ToRecordBatch(
     std::shared_ptr<Schema> schema, MemoryPool* pool) const {
+  if (selection_vector) {
+    ExecContext ctx(pool);
+    ARROW_ASSIGN_OR_RAISE(auto materialized, MaterializeSelection(&ctx));
+    return materialized.ToRecordBatch(std::move(schema), pool);
+  }
+
   ArrayVector columns(schema->num_fields());
 
   for (size_t i = 0; i < columns.size(); ++i) {
@@ -164,6 +231,43 @@ Result<std::shared_ptr<RecordBatch>> ExecBatch::ToRecordBatch(
   return RecordBatch::Make(std::move(schema), length, std::move(columns));
 }
 
+Result<ExecBatch> ExecBatch::MaterializeSelection(ExecContext* ctx) const {
+  std::vector<int> columns(values.size());
+  std::iota(columns.begin(), columns.end(), 0);
+  return MaterializeSelection(columns, ctx);
+}
+
+Result<ExecBatch> ExecBatch::MaterializeSelection(const std::vector<int>& columns,
+                                                  ExecContext* ctx) const {
+  if (selection_vector == nullptr) {
+    ExecBatch out = *this;
+    return out;
+  }
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return MaterializeSelection(columns, &default_ctx);
+  }
+
+  ExecBatch out({}, length);
+  out.guarantee = guarantee;
+  out.values.resize(values.size());
+
+  const Datum indices(selection_vector->data());
+  const auto take_options = TakeOptions::NoBoundsCheck();
+  auto materialize = [&](int i) -> Status {
+    if (values[i].is_scalar()) {
+      out.values[i] = values[i];
+      return Status::OK();
+    }
+    if (out.values[i].kind() != Datum::NONE) return Status::OK();
+    return CallFunction("take", {values[i], indices}, &take_options, ctx)
+        .Value(&out.values[i]);
+  };
+
+  for (int i : columns) RETURN_NOT_OK(materialize(i));
+  return out;
+}
+
 namespace {
 
 Result<std::shared_ptr<Buffer>> AllocateDataBuffer(KernelContext* ctx, int64_t length,
@@ -1038,8 +1142,50 @@ SelectionVector::SelectionVector(const Array& arr) : SelectionVector(arr.data())
 int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->length); }
 
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
-    const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+    const BooleanArray& arr, MemoryPool* pool) {
+  // Null slots aren't selected, so combine the values with the validity bitmap
+  const uint8_t* bitmap = arr.values()->data();
+  int64_t bitmap_offset = arr.offset();
+  std::shared_ptr<Buffer> and_bitmap;
+  if (arr.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(and_bitmap,
+                          BitmapAnd(pool, arr.values()->data(), arr.offset(),
+                                    arr.null_bitmap_data(), arr.offset(), arr.length(),
+                                    /*out_offset=*/0));
+    bitmap = and_bitmap->data();
+    bitmap_offset = 0;
+  }
+
+  const int64_t length = CountSetBits(bitmap, bitmap_offset, arr.length());
+  ARROW_ASSIGN_OR_RAISE(auto indices, AllocateBuffer(length * sizeof(int32_t), pool));
+  auto out = reinterpret_cast<int32_t*>(indices->mutable_data());
+  VisitSetBitRunsVoid(bitmap, bitmap_offset, arr.length(),
+                      [&](int64_t position, int64_t run_length) {
+                        for (int64_t i = 0; i < run_length; ++i) {
+                          *out++ = static_cast<int32_t>(position + i);
+                        }
+                      });
+
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), length, {nullptr, std::move(indices)}, /*null_count=*/0));
+}
+
+Result<std::shared_ptr<SelectionVector>> SelectionVector::Filter(
+    const BooleanArray& mask, MemoryPool* pool) const {
+  DCHECK_EQ(mask.length(), length());
+  ARROW_ASSIGN_OR_RAISE(auto positions, FromMask(mask, pool));
+
+  // positions is freshly allocated, so map it through this selection in place
+  auto indices = positions->data_->GetMutableValues<int32_t>(1);
+  for (int32_t i = 0; i < positions->length(); ++i) {
+    indices[i] = indices_[indices[i]];
+  }
+  return positions;
+}
+
+std::shared_ptr<SelectionVector> SelectionVector::Slice(int64_t offset,
+                                                        int64_t length) const {
+  return std::make_shared<SelectionVector>(data_->Slice(offset, length));
 }
 
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
@@ -140,7 +140,9 @@ ARROW_EXPORT ExecContext* default_exec_context();
 /// implementations. This is especially relevant for aggregations but also
 /// applies to scalar operations.
 ///
-/// We are not yet using this so this is mostly a placeholder for now.
+/// FilterNode attaches a SelectionVector to its output batches instead of
+/// filtering every column, and consumers materialize only the columns they
+/// reference (see ExecBatch::MaterializeSelection).
 ///
 /// [1]: http://cidrdb.org/cidr2005/papers/P19.pdf
 class ARROW_EXPORT SelectionVector {
@@ -150,7 +152,20 @@ class ARROW_EXPORT SelectionVector {
   explicit SelectionVector(const Array& arr);
 
   /// \brief Create SelectionVector from boolean mask
-  static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
+  ///
+  /// Null mask slots are not selected, as with FilterOptions::DROP.
+  static Result<std::shared_ptr<SelectionVector>> FromMask(
+      const BooleanArray& arr, MemoryPool* pool = default_memory_pool());
+
+  /// \brief Select a subset of this selection using a boolean mask of the same length
+  Result<std::shared_ptr<SelectionVector>> Filter(
+      const BooleanArray& mask, MemoryPool* pool = default_memory_pool()) const;
+
+  /// \brief Return a slice of the selected indices
+  std::shared_ptr<SelectionVector> Slice(int64_t offset, int64_t length) const;
+
+  /// The selected indices as an int32 array
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
 
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
@@ -185,6 +200,18 @@ struct ARROW_EXPORT ExecBatch {
   Result<std::shared_ptr<RecordBatch>> ToRecordBatch(
       std::shared_ptr<Schema> schema, MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Apply the selection vector (if any) to the array values.
+  ///
+  /// The returned batch has no selection vector.
+  Result<ExecBatch> MaterializeSelection(ExecContext* ctx = NULLPTR) const;
+
+  /// \brief Apply the selection vector (if any) to some of the array values.
+  ///
+  /// Only the values at the given indices are materialized and the others may be
+  /// left unset, which avoids copying columns a consumer doesn't reference.
+  Result<ExecBatch> MaterializeSelection(const std::vector<int>& columns,
+                                         ExecContext* ctx = NULLPTR) const;
+
   /// The values representing positional arguments to be passed to a kernel's
   /// exec function for processing.
   std::vector<Datum> values;
@@ -223,6 +250,12 @@ struct ARROW_EXPORT ExecBatch {
 
   ExecBatch Slice(int64_t offset, int64_t length) const;
 
+  /// \brief The total size in bytes of the buffers referenced by the array values.
+  ///
+  /// Scalars are not counted, and buffers shared between arrays (or slices) are
+  /// counted once per array.
+  int64_t TotalBufferSize() const;
+
   /// \brief A convenience for returning the ValueDescr objects (types and
   /// shapes) from the batch.
   std::vector<ValueDescr> GetDescriptors() const {
@@ -22,6 +22,7 @@
 #include <thread>
 #include <unordered_map>
 
+#include "arrow/array/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec/options.h"
 #include "arrow/compute/exec/util.h"
@@ -192,7 +193,17 @@ class ScalarAggregateNode : public ExecNode {
 
   const char* kind_name() const override { return "ScalarAggregateNode"; }
 
+  bool accepts_selection_vector() const override { return true; }
+
   Status DoConsume(const ExecBatch& batch, size_t thread_index) {
+    if (batch.selection_vector) {
+      // Only the aggregated columns need to be gathered
+      ARROW_ASSIGN_OR_RAISE(auto materialized,
+                            batch.MaterializeSelection(target_field_ids_,
+                                                       plan()->exec_context()));
+      return DoConsume(materialized, thread_index);
+    }
+
     for (size_t i = 0; i < kernels_.size(); ++i) {
       KernelContext batch_ctx{plan()->exec_context()};
       batch_ctx.SetState(states_[i][thread_index].get());
@@ -231,13 +242,19 @@ class ScalarAggregateNode : public ExecNode {
   Status StartProducing() override {
     finished_ = Future<>::Make();
     // Scalar aggregates will only output a single batch
-    outputs_[0]->InputFinished(this, 1);
+    EmitFinished(outputs_[0], 1);
     return Status::OK();
   }
 
-  void PauseProducing(ExecNode* output) override {}
+  void PauseProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->PauseProducing(this);
+  }
 
-  void ResumeProducing(ExecNode* output) override {}
+  void ResumeProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->ResumeProducing(this);
+  }
 
   void StopProducing(ExecNode* output) override {
     DCHECK_EQ(output, outputs_[0]);
@@ -273,7 +290,7 @@ class ScalarAggregateNode : public ExecNode {
       RETURN_NOT_OK(kernels_[i]->finalize(&ctx, &batch.values[i]));
     }
 
-    outputs_[0]->InputReceived(this, std::move(batch));
+    EmitBatch(outputs_[0], std::move(batch));
     finished_.MarkFinished();
     return Status::OK();
   }
@@ -385,6 +402,8 @@ class GroupByNode : public ExecNode {
 
   const char* kind_name() const override { return "GroupByNode"; }
 
+  bool accepts_selection_vector() const override { return true; }
+
   Status Consume(ExecBatch batch) {
     size_t thread_index = get_thread_index_();
     if (thread_index >= local_states_.size()) {
@@ -395,6 +414,27 @@ class GroupByNode : public ExecNode {
     auto state = &local_states_[thread_index];
     RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
+    if (batch.selection_vector) {
+      // Only the key and aggregated columns need to be gathered
+      std::vector<int> field_ids = key_field_ids_;
+      field_ids.insert(field_ids.end(), agg_src_field_ids_.begin(),
+                       agg_src_field_ids_.end());
+      ARROW_ASSIGN_OR_RAISE(batch, batch.MaterializeSelection(field_ids, ctx_));
+    }
+
+    // Groupers and hash aggregate kernels expect arrays, so broadcast scalars (such as
+    // partition fields whose values are known for the whole batch)
+    auto broadcast = [&](int field_id) -> Status {
+      Datum& value = batch.values[field_id];
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(value, MakeArrayFromScalar(*value.scalar(), batch.length,
+                                                         ctx_->memory_pool()));
+      }
+      return Status::OK();
+    };
+    for (int field_id : key_field_ids_) RETURN_NOT_OK(broadcast(field_id));
+    for (int field_id : agg_src_field_ids_) RETURN_NOT_OK(broadcast(field_id));
+
     // Create a batch with key columns
     std::vector<Datum> keys(key_field_ids_.size());
     for (size_t i = 0; i < key_field_ids_.size(); ++i) {
@@ -479,7 +519,7 @@ class GroupByNode : public ExecNode {
     if (finished_.is_finished()) return;
 
     int64_t batch_size = output_batch_size();
-    outputs_[0]->InputReceived(this, out_data_.Slice(batch_size * n, batch_size));
+    EmitBatch(outputs_[0], out_data_.Slice(batch_size * n, batch_size));
 
     if (output_counter_.Increment()) {
       finished_.MarkFinished();
@@ -491,7 +531,7 @@ class GroupByNode : public ExecNode {
     ARROW_ASSIGN_OR_RAISE(out_data_, Finalize());
 
     int num_output_batches = *output_counter_.total();
-    outputs_[0]->InputFinished(this, num_output_batches);
+    EmitFinished(outputs_[0], num_output_batches);
 
     auto executor = ctx_->executor();
     for (int i = 0; i < num_output_batches; ++i) {
@@ -546,9 +586,15 @@ class GroupByNode : public ExecNode {
     return Status::OK();
   }
 
-  void PauseProducing(ExecNode* output) override {}
+  void PauseProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->PauseProducing(this);
+  }
 
-  void ResumeProducing(ExecNode* output) override {}
+  void ResumeProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->ResumeProducing(this);
+  }
 
   void StopProducing(ExecNode* output) override {
     DCHECK_EQ(output, outputs_[0]);
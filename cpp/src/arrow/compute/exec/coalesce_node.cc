@@ -0,0 +1,269 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/expression.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/scalar.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace {
+
+// Bounds on the adaptive target, so that a poor row size estimate (e.g. from
+// sliced batches referencing large buffers) can't degenerate
+constexpr int64_t kMinAdaptiveTargetRows = 1024;
+constexpr int64_t kMaxAdaptiveTargetRows = 1 << 20;
+
+Result<ExecBatch> ConcatenateBatches(const std::vector<ExecBatch>& batches,
+                                     MemoryPool* pool) {
+  DCHECK(!batches.empty());
+  if (batches.size() == 1) return batches[0];
+
+  int64_t length = 0;
+  bool same_guarantee = true;
+  for (const auto& batch : batches) {
+    length += batch.length;
+    same_guarantee &= batch.guarantee.Equals(batches[0].guarantee);
+  }
+
+  std::vector<Datum> values(batches[0].values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    // Keep columns which are the same scalar in all batches (e.g. partition columns)
+    const auto& first = batches[0].values[i];
+    if (first.is_scalar() &&
+        std::all_of(batches.begin(), batches.end(), [&](const ExecBatch& batch) {
+          return batch.values[i].is_scalar() &&
+                 batch.values[i].scalar()->Equals(*first.scalar());
+        })) {
+      values[i] = first;
+      continue;
+    }
+
+    ArrayVector arrays(batches.size());
+    for (size_t j = 0; j < batches.size(); ++j) {
+      const auto& value = batches[j].values[i];
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(
+            arrays[j], MakeArrayFromScalar(*value.scalar(), batches[j].length, pool));
+      } else {
+        arrays[j] = value.make_array();
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(values[i], Concatenate(arrays, pool));
+  }
+
+  ExecBatch out(std::move(values), length);
+  if (same_guarantee) out.guarantee = batches[0].guarantee;
+  return out;
+}
+
+class CoalesceNode : public ExecNode {
+ public:
+  CoalesceNode(ExecPlan* plan, std::vector<ExecNode*> inputs, int64_t target_rows,
+               int64_t target_bytes)
+      : ExecNode(plan, inputs, /*input_labels=*/{"target"},
+                 /*output_schema=*/inputs[0]->output_schema(),
+                 /*num_outputs=*/1),
+        target_rows_(target_rows),
+        target_bytes_(target_bytes) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "CoalesceNode"));
+
+    const auto& coalesce_options = checked_cast<const CoalesceNodeOptions&>(options);
+    if (coalesce_options.target_rows < 0 || coalesce_options.target_bytes < 0) {
+      return Status::Invalid("CoalesceNode targets must be non-negative");
+    }
+    int64_t target_bytes = coalesce_options.target_bytes;
+    if (target_bytes == 0) {
+      // Leave room in L2 for the outputs of the kernels processing the batch
+      target_bytes = ::arrow::internal::CpuInfo::GetInstance()->CacheSize(
+                         ::arrow::internal::CpuInfo::L2_CACHE) /
+                     2;
+    }
+
+    return plan->EmplaceNode<CoalesceNode>(plan, std::move(inputs),
+                                           coalesce_options.target_rows, target_bytes);
+  }
+
+  const char* kind_name() const override { return "CoalesceNode"; }
+
+  void InputReceived(ExecNode* input, ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+
+    std::vector<ExecBatch> to_coalesce;
+    int64_t target_rows;
+    bool pass_through;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      rows_received_ += batch.length;
+      bytes_received_ += batch.TotalBufferSize();
+      target_rows = TargetRows();
+
+      // Empty batches are dropped
+      pass_through = batch.length > 0 && batch.length >= target_rows / 2;
+      if (batch.length > 0 && !pass_through) {
+        pending_rows_ += batch.length;
+        pending_.push_back(std::move(batch));
+        if (pending_rows_ >= target_rows) {
+          to_coalesce = std::move(pending_);
+          pending_.clear();
+          pending_rows_ = 0;
+        }
+      }
+    }
+
+    if (!to_coalesce.empty()) {
+      EmitCoalesced(std::move(to_coalesce));
+    } else if (pass_through) {
+      // Large enough: pass through, slicing into roughly equal pieces if oversized
+      const int64_t num_slices =
+          batch.length > 2 * target_rows ? BitUtil::CeilDiv(batch.length, target_rows)
+                                         : 1;
+      const int64_t slice_length = BitUtil::CeilDiv(batch.length, num_slices);
+      for (int64_t offset = 0; offset < batch.length; offset += slice_length) {
+        num_emitted_.fetch_add(1);
+        EmitBatch(outputs_[0], batch.Slice(offset, slice_length));
+      }
+    }
+
+    if (input_counter_.Increment()) {
+      Finish();
+    }
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, std::move(error));
+  }
+
+  void InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (input_counter_.SetTotal(total_batches)) {
+      Finish();
+    }
+  }
+
+  Status StartProducing() override { return Status::OK(); }
+
+  void PauseProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->PauseProducing(this);
+  }
+
+  void ResumeProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->ResumeProducing(this);
+  }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    StopProducing();
+  }
+
+  void StopProducing() override {
+    input_counter_.Cancel();
+    inputs_[0]->StopProducing(this);
+  }
+
+  Future<> finished() override { return inputs_[0]->finished(); }
+
+ protected:
+  std::string ToStringExtra() const override {
+    return target_rows_ > 0 ? "target_rows=" + std::to_string(target_rows_)
+                            : "target_bytes=" + std::to_string(target_bytes_);
+  }
+
+ private:
+  // Must be called with mutex_ held
+  int64_t TargetRows() const {
+    if (target_rows_ > 0) return target_rows_;
+    if (rows_received_ == 0) return kMinAdaptiveTargetRows;
+    const int64_t row_bytes = std::max<int64_t>(1, bytes_received_ / rows_received_);
+    return std::min(kMaxAdaptiveTargetRows,
+                    std::max(kMinAdaptiveTargetRows, target_bytes_ / row_bytes));
+  }
+
+  void EmitCoalesced(std::vector<ExecBatch> batches) {
+    // Claim the output batch before emitting, so that Finish() sees the final count
+    num_emitted_.fetch_add(1);
+    auto maybe_coalesced =
+        ConcatenateBatches(batches, plan()->exec_context()->memory_pool());
+    if (ErrorIfNotOk(maybe_coalesced.status())) {
+      num_emitted_.fetch_sub(1);
+      return;
+    }
+    EmitBatch(outputs_[0], maybe_coalesced.MoveValueUnsafe());
+  }
+
+  void Finish() {
+    std::vector<ExecBatch> remainder;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      remainder = std::move(pending_);
+      pending_.clear();
+      pending_rows_ = 0;
+    }
+    if (!remainder.empty()) {
+      EmitCoalesced(std::move(remainder));
+    }
+    EmitFinished(outputs_[0], num_emitted_.load());
+  }
+
+  const int64_t target_rows_;
+  const int64_t target_bytes_;
+
+  std::mutex mutex_;
+  std::vector<ExecBatch> pending_;
+  int64_t pending_rows_ = 0;
+  int64_t rows_received_ = 0, bytes_received_ = 0;
+
+  std::atomic<int> num_emitted_{0};
+  AtomicCounter input_counter_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterCoalesceNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory("coalesce", CoalesceNode::Make));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
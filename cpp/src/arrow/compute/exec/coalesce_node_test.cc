@@ -0,0 +1,214 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/api.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+
+using testing::HasSubstr;
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+BatchesWithSchema MakeSmallBatches(int num_batches) {
+  BatchesWithSchema out;
+  for (int i = 0; i < num_batches; ++i) {
+    out.batches.push_back(ExecBatchFromJSON({int32(), utf8()}, R"([
+                   [1, "alfa"],
+                   [2, "beta"],
+                   [3, "gama"]
+                 ])"));
+  }
+  out.schema = schema({field("i32", int32()), field("str", utf8())});
+  return out;
+}
+
+Result<std::vector<ExecBatch>> RunPlan(const BatchesWithSchema& input,
+                                       Declaration node, bool parallel) {
+  ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+  RETURN_NOT_OK(
+      Declaration::Sequence(
+          {
+              {"source",
+               SourceNodeOptions{input.schema, input.gen(parallel, /*slow=*/false)}},
+              std::move(node),
+              {"sink", SinkNodeOptions{&sink_gen}},
+          })
+          .AddToPlan(plan.get()));
+
+  return StartAndCollect(plan.get(), sink_gen).result();
+}
+
+// Check that the batches hold the expected rows, in any order
+void AssertRows(const std::shared_ptr<Schema>& schema,
+                const std::vector<ExecBatch>& batches, int64_t num_rows,
+                int64_t i32_sum) {
+  RecordBatchVector record_batches;
+  for (const auto& batch : batches) {
+    ASSERT_OK_AND_ASSIGN(auto record_batch, batch.ToRecordBatch(schema));
+    record_batches.push_back(std::move(record_batch));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(schema, record_batches));
+  ASSERT_EQ(table->num_rows(), num_rows);
+  ASSERT_OK_AND_ASSIGN(auto sum, Sum(table->column(0)));
+  AssertDatumsEqual(Datum(int64_t(i32_sum)), sum);
+}
+
+}  // namespace
+
+TEST(CoalesceNode, CoalesceSmallBatches) {
+  auto input = MakeSmallBatches(100);
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "serial");
+
+    ASSERT_OK_AND_ASSIGN(
+        auto batches,
+        RunPlan(input, {"coalesce", CoalesceNodeOptions{/*target_rows=*/50}}, parallel));
+    AssertRows(input.schema, batches, 300, 600);
+
+    // All batches reach the target, except for the remainder
+    int num_small_batches = 0;
+    for (const auto& batch : batches) {
+      if (batch.length < 50) ++num_small_batches;
+    }
+    ASSERT_LE(num_small_batches, 1);
+    if (!parallel) {
+      // 17 input batches make up each output batch
+      ASSERT_EQ(batches.size(), 6);
+    }
+  }
+}
+
+TEST(CoalesceNode, SplitLargeBatches) {
+  BatchesWithSchema input;
+  input.schema = schema({field("i32", int32())});
+  ASSERT_OK_AND_ASSIGN(auto array, MakeArrayFromScalar(Int32Scalar(2), 1000));
+  input.batches = {ExecBatch({array}, 1000), ExecBatch({array->Slice(0, 60)}, 60)};
+
+  ASSERT_OK_AND_ASSIGN(
+      auto batches,
+      RunPlan(input, {"coalesce", CoalesceNodeOptions{/*target_rows=*/100}}, false));
+  AssertRows(input.schema, batches, 1060, 2120);
+  // The large batch is sliced and the other one is large enough to pass through
+  ASSERT_EQ(batches.size(), 11);
+  for (const auto& batch : batches) {
+    ASSERT_THAT(batch.length, testing::AnyOf(60, 100));
+  }
+}
+
+TEST(CoalesceNode, AdaptiveTarget) {
+  auto input = MakeSmallBatches(1000);
+
+  // The default target is large enough to coalesce all of this
+  ASSERT_OK_AND_ASSIGN(auto batches,
+                       RunPlan(input, {"coalesce", CoalesceNodeOptions{}}, false));
+  AssertRows(input.schema, batches, 3000, 6000);
+  ASSERT_EQ(batches.size(), 1);
+
+  // 3000 rows take a few tens of kilobytes
+  ASSERT_OK_AND_ASSIGN(
+      batches, RunPlan(input,
+                       {"coalesce", CoalesceNodeOptions{/*target_rows=*/0,
+                                                        /*target_bytes=*/1024}},
+                       false));
+  AssertRows(input.schema, batches, 3000, 6000);
+  // The minimum adaptive target is 1024 rows
+  ASSERT_EQ(batches.size(), 3);
+}
+
+TEST(CoalesceNode, ScalarColumns) {
+  BatchesWithSchema input;
+  input.schema = schema({field("i32", int32()), field("part", utf8())});
+  input.batches = {
+      ExecBatchFromJSON({int32(), ValueDescr::Scalar(utf8())}, R"([[1, "a"], [2, "a"]])"),
+      ExecBatchFromJSON({int32(), ValueDescr::Scalar(utf8())}, R"([[3, "a"]])"),
+      ExecBatchFromJSON({int32(), ValueDescr::Scalar(utf8())}, R"([[4, "b"]])")};
+
+  ASSERT_OK_AND_ASSIGN(
+      auto batches,
+      RunPlan(input, {"coalesce", CoalesceNodeOptions{/*target_rows=*/5}}, false));
+  ASSERT_EQ(batches.size(), 1);
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[1, 2, 3, 4]"), batches[0].values[0]);
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["a", "a", "a", "b"])"),
+                    batches[0].values[1]);
+
+  // A scalar column which is the same in all batches stays a scalar
+  input.batches.pop_back();
+  ASSERT_OK_AND_ASSIGN(
+      batches,
+      RunPlan(input, {"coalesce", CoalesceNodeOptions{/*target_rows=*/5}}, false));
+  ASSERT_EQ(batches.size(), 1);
+  ASSERT_TRUE(batches[0].values[1].is_scalar());
+  ASSERT_EQ(batches[0].length, 3);
+}
+
+TEST(CoalesceNode, AfterFilter) {
+  auto input = MakeSmallBatches(100);
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "serial");
+
+    ASSERT_OK_AND_ASSIGN(
+        auto batches,
+        RunPlan(input,
+                {"filter", FilterNodeOptions{greater(field_ref("i32"), literal(2)),
+                                             /*coalesce_output=*/true}},
+                parallel));
+    AssertRows(input.schema, batches, 100, 300);
+    ASSERT_EQ(batches.size(), 1);
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(
+      auto node, Declaration::Sequence(
+                     {
+                         {"source", SourceNodeOptions{input.schema,
+                                                      input.gen(/*parallel=*/false,
+                                                                /*slow=*/false)}},
+                         {"filter", FilterNodeOptions{literal(true),
+                                                      /*coalesce_output=*/true}},
+                     })
+                     .AddToPlan(plan.get()));
+  ASSERT_STREQ(node->kind_name(), "CoalesceNode");
+  ASSERT_STREQ(node->inputs()[0]->kind_name(), "FilterNode");
+}
+
+TEST(CoalesceNode, Errors) {
+  auto input = MakeSmallBatches(1);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(auto source,
+                       MakeExecNode("source", plan.get(), {},
+                                    SourceNodeOptions{input.schema,
+                                                      input.gen(/*parallel=*/false,
+                                                                /*slow=*/false)}));
+  ASSERT_RAISES(Invalid, MakeExecNode("coalesce", plan.get(), {source},
+                                      CoalesceNodeOptions{/*target_rows=*/-1}));
+  ASSERT_OK_AND_ASSIGN(auto node, MakeExecNode("coalesce", plan.get(), {source},
+                                               CoalesceNodeOptions{/*target_rows=*/8}));
+  ASSERT_THAT(node->ToString(), HasSubstr("target_rows=8"));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -17,7 +17,13 @@
 
 #include "arrow/compute/exec/exec_plan.h"
 
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -26,6 +32,7 @@
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/datum.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/util/async_generator.h"
@@ -41,9 +48,265 @@ namespace compute {
 
 namespace {
 
+int64_t WallTimeNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+int64_t ThreadCpuTimeNanos() {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+  }
+#endif
+  // No per-thread CPU clock available: approximate with wall clock time
+  return WallTimeNanos();
+}
+
+struct NodeCounters {
+  std::atomic<int64_t> batches_received{0};
+  std::atomic<int64_t> rows_received{0};
+  std::atomic<int64_t> batches_emitted{0};
+  std::atomic<int64_t> rows_emitted{0};
+  std::atomic<int64_t> cpu_time_ns{0};
+  std::atomic<int64_t> wall_time_ns{0};
+  std::atomic<int64_t> bytes_allocated{0};
+};
+
+// A node callback currently executing on this thread.  Frames form a stack
+// (through `parent`) since a node's callback synchronously calls into its outputs.
+struct InstrumentationFrame {
+  NodeCounters* counters;
+  InstrumentationFrame* parent;
+  int64_t start_wall_ns, start_cpu_ns;
+  int64_t child_wall_ns = 0, child_cpu_ns = 0;
+};
+
+thread_local InstrumentationFrame* current_frame = NULLPTR;
+
+// Forwards to another pool, attributing allocations to the node whose callback
+// is executing on the calling thread.
+//
+// Each plan owns one.  Since buffers allocated by a plan may outlive it, the pool
+// is only destroyed once the plan released it and all of its allocations were freed.
+class NodeTrackingMemoryPool : public MemoryPool {
+ public:
+  explicit NodeTrackingMemoryPool(MemoryPool* pool) : pool_(pool) {}
+
+  // Give up the plan's reference
+  void Release() { Unref(); }
+
+  Status Allocate(int64_t size, uint8_t** out) override {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    refs_.fetch_add(1, std::memory_order_relaxed);
+    Attribute(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    if (new_size > old_size) Attribute(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) override {
+    pool_->Free(buffer, size);
+    Unref();
+  }
+
+  void ReleaseUnused() override { pool_->ReleaseUnused(); }
+
+  int64_t bytes_allocated() const override { return pool_->bytes_allocated(); }
+
+  int64_t max_memory() const override { return pool_->max_memory(); }
+
+  std::string backend_name() const override { return pool_->backend_name(); }
+
+ private:
+  ~NodeTrackingMemoryPool() override = default;
+
+  void Unref() {
+    if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+  }
+
+  static void Attribute(int64_t size) {
+    auto frame = current_frame;
+    if (frame != NULLPTR) {
+      frame->counters->bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+    }
+  }
+
+  MemoryPool* pool_;
+  // One for the plan and one per live allocation
+  std::atomic<int64_t> refs_{1};
+};
+
+class ExecPlanInstrumentation {
+ public:
+  ExecPlanInstrumentation(const ExecPlanOptions& options, ExecContext* ctx)
+      : collect_trace_(options.collect_trace),
+        origin_ns_(WallTimeNanos()),
+        memory_pool_(new NodeTrackingMemoryPool(ctx->memory_pool())),
+        exec_context_(memory_pool_, ctx->executor(), ctx->func_registry()) {
+    exec_context_.set_exec_chunksize(ctx->exec_chunksize());
+    exec_context_.set_use_threads(ctx->use_threads());
+    exec_context_.set_preallocate_contiguous(ctx->preallocate_contiguous());
+  }
+
+  ~ExecPlanInstrumentation() { memory_pool_->Release(); }
+
+  ExecContext* exec_context() { return &exec_context_; }
+
+  void AddNode(const ExecNode* node) {
+    counters_.emplace(node, std::unique_ptr<NodeCounters>(new NodeCounters));
+  }
+
+  NodeCounters* counters(const ExecNode* node) const {
+    auto it = counters_.find(node);
+    return it == counters_.end() ? NULLPTR : it->second.get();
+  }
+
+  // Account for a batch (or, with rows < 0, the end of stream) passed from
+  // `input` to `output`, and time the callback in `output` for the lifetime
+  // of this object.
+  class Span {
+   public:
+    Span(ExecPlanInstrumentation* instrumentation, const ExecNode* input,
+         const ExecNode* output, int64_t rows)
+        : instrumentation_(instrumentation), output_(output), rows_(rows) {
+      auto input_counters = instrumentation->counters(input);
+      auto output_counters = instrumentation->counters(output);
+      if (rows >= 0) {
+        input_counters->batches_emitted.fetch_add(1, std::memory_order_relaxed);
+        input_counters->rows_emitted.fetch_add(rows, std::memory_order_relaxed);
+        output_counters->batches_received.fetch_add(1, std::memory_order_relaxed);
+        output_counters->rows_received.fetch_add(rows, std::memory_order_relaxed);
+      }
+      frame_.counters = output_counters;
+      frame_.parent = current_frame;
+      frame_.start_wall_ns = WallTimeNanos();
+      frame_.start_cpu_ns = ThreadCpuTimeNanos();
+      current_frame = &frame_;
+    }
+
+    ~Span() {
+      const int64_t wall_ns = WallTimeNanos() - frame_.start_wall_ns;
+      const int64_t cpu_ns = ThreadCpuTimeNanos() - frame_.start_cpu_ns;
+      current_frame = frame_.parent;
+      if (frame_.parent != NULLPTR) {
+        frame_.parent->child_wall_ns += wall_ns;
+        frame_.parent->child_cpu_ns += cpu_ns;
+      }
+      frame_.counters->wall_time_ns.fetch_add(wall_ns - frame_.child_wall_ns,
+                                              std::memory_order_relaxed);
+      frame_.counters->cpu_time_ns.fetch_add(cpu_ns - frame_.child_cpu_ns,
+                                             std::memory_order_relaxed);
+      if (instrumentation_->collect_trace_) {
+        instrumentation_->AddTraceEvent(output_, frame_.start_wall_ns, wall_ns, rows_);
+      }
+    }
+
+   private:
+    ExecPlanInstrumentation* instrumentation_;
+    const ExecNode* output_;
+    int64_t rows_;
+    InstrumentationFrame frame_;
+
+    ARROW_DISALLOW_COPY_AND_ASSIGN(Span);
+  };
+
+  bool collect_trace() const { return collect_trace_; }
+
+  std::string ToChromeTrace() const {
+    std::lock_guard<std::mutex> lock(trace_mutex_);
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "{\"traceEvents\":[";
+    for (size_t i = 0; i < trace_events_.size(); ++i) {
+      const auto& event = trace_events_[i];
+      const auto& name =
+          event.node->label().empty() ? event.node->kind_name() : event.node->label();
+      if (i > 0) ss << ',';
+      ss << "{\"name\":";
+      AppendJsonString(name, &ss);
+      ss << ",\"cat\":";
+      AppendJsonString(event.node->kind_name(), &ss);
+      ss << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.tid
+         << ",\"ts\":" << static_cast<double>(event.start_ns - origin_ns_) / 1000
+         << ",\"dur\":" << static_cast<double>(event.duration_ns) / 1000 << ",\"args\":{";
+      if (event.rows >= 0) {
+        ss << "\"rows\":" << event.rows;
+      } else {
+        ss << "\"input_finished\":true";
+      }
+      ss << "}}";
+    }
+    ss << "],\"displayTimeUnit\":\"ns\"}";
+    return ss.str();
+  }
+
+ private:
+  struct TraceEvent {
+    const ExecNode* node;
+    int tid;
+    int64_t start_ns, duration_ns, rows;
+  };
+
+  void AddTraceEvent(const ExecNode* node, int64_t start_ns, int64_t duration_ns,
+                     int64_t rows) {
+    std::lock_guard<std::mutex> lock(trace_mutex_);
+    auto tid = thread_ids_.emplace(std::this_thread::get_id(),
+                                   static_cast<int>(thread_ids_.size()))
+                   .first->second;
+    trace_events_.push_back({node, tid, start_ns, duration_ns, rows});
+  }
+
+  static void AppendJsonString(const std::string& s, std::stringstream* ss) {
+    *ss << '"';
+    for (char c : s) {
+      switch (c) {
+        case '"':
+          *ss << "\\\"";
+          break;
+        case '\\':
+          *ss << "\\\\";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            *ss << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                << static_cast<int>(c) << std::dec << std::setfill(' ');
+          } else {
+            *ss << c;
+          }
+      }
+    }
+    *ss << '"';
+  }
+
+  const bool collect_trace_;
+  const int64_t origin_ns_;
+  NodeTrackingMemoryPool* memory_pool_;
+  ExecContext exec_context_;
+  std::unordered_map<const ExecNode*, std::unique_ptr<NodeCounters>> counters_;
+
+  mutable std::mutex trace_mutex_;
+  std::vector<TraceEvent> trace_events_;
+  std::unordered_map<std::thread::id, int> thread_ids_;
+};
+
 struct ExecPlanImpl : public ExecPlan {
   explicit ExecPlanImpl(ExecContext* exec_context) : ExecPlan(exec_context) {}
 
+  ExecPlanImpl(const ExecPlanOptions& options, ExecContext* exec_context)
+      : ExecPlan(exec_context) {
+    if (options.collect_metrics || options.collect_trace) {
+      instrumentation_.reset(new ExecPlanInstrumentation(options, exec_context));
+      exec_context_ = instrumentation_->exec_context();
+    }
+  }
+
   ~ExecPlanImpl() override {
     if (started_ && !finished_.is_finished()) {
       ARROW_LOG(WARNING) << "Plan was destroyed before finishing";
@@ -59,6 +322,9 @@ struct ExecPlanImpl : public ExecPlan {
     if (node->num_outputs() == 0) {
       sinks_.push_back(node.get());
     }
+    if (instrumentation_) {
+      instrumentation_->AddNode(node.get());
+    }
     nodes_.push_back(std::move(node));
     return nodes_.back().get();
   }
@@ -162,6 +428,8 @@ struct ExecPlanImpl : public ExecPlan {
     return ss.str();
   }
 
+  // Declared first so that it outlives the nodes, which may use exec_context_
+  std::unique_ptr<ExecPlanInstrumentation> instrumentation_;
   Future<> finished_ = Future<>::MakeFinished();
   bool started_ = false, stopped_ = false;
   std::vector<std::unique_ptr<ExecNode>> nodes_;
@@ -189,6 +457,11 @@ Result<std::shared_ptr<ExecPlan>> ExecPlan::Make(ExecContext* ctx) {
   return std::shared_ptr<ExecPlan>(new ExecPlanImpl{ctx});
 }
 
+Result<std::shared_ptr<ExecPlan>> ExecPlan::Make(ExecPlanOptions options,
+                                                 ExecContext* ctx) {
+  return std::shared_ptr<ExecPlan>(new ExecPlanImpl{options, ctx});
+}
+
 ExecNode* ExecPlan::AddNode(std::unique_ptr<ExecNode> node) {
   return ToDerived(this)->AddNode(std::move(node));
 }
@@ -209,6 +482,34 @@ Future<> ExecPlan::finished() { return ToDerived(this)->finished_; }
 
 std::string ExecPlan::ToString() const { return ToDerived(this)->ToString(); }
 
+Result<ExecNodeMetrics> ExecPlan::GetNodeMetrics(const ExecNode* node) const {
+  const auto& instrumentation = ToDerived(this)->instrumentation_;
+  if (!instrumentation) {
+    return Status::Invalid("ExecPlan was not created with metrics collection enabled");
+  }
+  auto counters = instrumentation->counters(node);
+  if (counters == NULLPTR) {
+    return Status::KeyError("Node '", node->label(), "' is not part of this ExecPlan");
+  }
+  ExecNodeMetrics metrics;
+  metrics.batches_received = counters->batches_received.load();
+  metrics.rows_received = counters->rows_received.load();
+  metrics.batches_emitted = counters->batches_emitted.load();
+  metrics.rows_emitted = counters->rows_emitted.load();
+  metrics.cpu_time_ns = counters->cpu_time_ns.load();
+  metrics.wall_time_ns = counters->wall_time_ns.load();
+  metrics.bytes_allocated = counters->bytes_allocated.load();
+  return metrics;
+}
+
+Result<std::string> ExecPlan::ToChromeTrace() const {
+  const auto& instrumentation = ToDerived(this)->instrumentation_;
+  if (!instrumentation || !instrumentation->collect_trace()) {
+    return Status::Invalid("ExecPlan was not created with tracing enabled");
+  }
+  return instrumentation->ToChromeTrace();
+}
+
 ExecNode::ExecNode(ExecPlan* plan, NodeVector inputs,
                    std::vector<std::string> input_labels,
                    std::shared_ptr<Schema> output_schema, int num_outputs)
@@ -283,6 +584,32 @@ bool ExecNode::ErrorIfNotOk(Status status) {
   return true;
 }
 
+void ExecNode::EmitBatch(ExecNode* output, ExecBatch batch) {
+  if (batch.selection_vector && !output->accepts_selection_vector()) {
+    auto maybe_materialized = batch.MaterializeSelection(plan_->exec_context());
+    if (ErrorIfNotOk(maybe_materialized.status())) return;
+    batch = maybe_materialized.MoveValueUnsafe();
+  }
+
+  auto instrumentation = ToDerived(plan_)->instrumentation_.get();
+  if (instrumentation == NULLPTR) {
+    output->InputReceived(this, std::move(batch));
+    return;
+  }
+  ExecPlanInstrumentation::Span span(instrumentation, this, output, batch.length);
+  output->InputReceived(this, std::move(batch));
+}
+
+void ExecNode::EmitFinished(ExecNode* output, int total_batches) {
+  auto instrumentation = ToDerived(plan_)->instrumentation_.get();
+  if (instrumentation == NULLPTR) {
+    output->InputFinished(this, total_batches);
+    return;
+  }
+  ExecPlanInstrumentation::Span span(instrumentation, this, output, /*rows=*/-1);
+  output->InputFinished(this, total_batches);
+}
+
 std::shared_ptr<RecordBatchReader> MakeGeneratorReader(
     std::shared_ptr<Schema> schema,
     std::function<Future<util::optional<ExecBatch>>()> gen, MemoryPool* pool) {
@@ -352,9 +679,11 @@ namespace internal {
 
 void RegisterSourceNode(ExecFactoryRegistry*);
 void RegisterFilterNode(ExecFactoryRegistry*);
+void RegisterCoalesceNode(ExecFactoryRegistry*);
 void RegisterProjectNode(ExecFactoryRegistry*);
 void RegisterUnionNode(ExecFactoryRegistry*);
 void RegisterAggregateNode(ExecFactoryRegistry*);
+void RegisterWindowNode(ExecFactoryRegistry*);
 void RegisterSinkNode(ExecFactoryRegistry*);
 
 }  // namespace internal
@@ -365,9 +694,11 @@ ExecFactoryRegistry* default_exec_factory_registry() {
     DefaultRegistry() {
       internal::RegisterSourceNode(this);
       internal::RegisterFilterNode(this);
+      internal::RegisterCoalesceNode(this);
       internal::RegisterProjectNode(this);
       internal::RegisterUnionNode(this);
       internal::RegisterAggregateNode(this);
+      internal::RegisterWindowNode(this);
       internal::RegisterSinkNode(this);
     }
 
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -32,6 +33,42 @@
 namespace arrow {
 namespace compute {
 
+/// \brief Options controlling the instrumentation of an ExecPlan
+struct ARROW_EXPORT ExecPlanOptions {
+  /// \brief Collect per-node counters and timings
+  ///
+  /// The collected metrics can be retrieved with ExecPlan::GetNodeMetrics().
+  /// When disabled (the default), the only overhead is a branch per emitted batch.
+  bool collect_metrics = false;
+
+  /// \brief Record a span for each node callback
+  ///
+  /// The spans can be exported with ExecPlan::ToChromeTrace().
+  /// This implies collect_metrics.
+  bool collect_trace = false;
+};
+
+/// \brief Execution metrics collected for a single ExecNode
+///
+/// Work done while delivering a batch (or the end of stream) to a node is
+/// attributed to the receiving node, excluding any time spent in its own
+/// outputs.  Work done by source nodes outside of these callbacks (for example
+/// decoding batches in a generator) is not accounted for.
+struct ARROW_EXPORT ExecNodeMetrics {
+  /// Number of batches and rows passed to this node by its inputs
+  int64_t batches_received = 0;
+  int64_t rows_received = 0;
+  /// Number of batches and rows this node passed to its outputs
+  int64_t batches_emitted = 0;
+  int64_t rows_emitted = 0;
+  /// CPU time spent by this node, in nanoseconds
+  int64_t cpu_time_ns = 0;
+  /// Wall clock time spent by this node, in nanoseconds, summed across threads
+  int64_t wall_time_ns = 0;
+  /// Number of bytes this node allocated from the plan's memory pool
+  int64_t bytes_allocated = 0;
+};
+
 class ARROW_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan> {
  public:
   using NodeVector = std::vector<ExecNode*>;
@@ -43,6 +80,10 @@ class ARROW_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan> {
   /// Make an empty exec plan
   static Result<std::shared_ptr<ExecPlan>> Make(ExecContext* = default_exec_context());
 
+  /// Make an empty exec plan with the given instrumentation options
+  static Result<std::shared_ptr<ExecPlan>> Make(ExecPlanOptions options,
+                                                ExecContext* = default_exec_context());
+
   ExecNode* AddNode(std::unique_ptr<ExecNode> node);
 
   template <typename Node, typename... Args>
@@ -78,6 +119,18 @@ class ARROW_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan> {
 
   std::string ToString() const;
 
+  /// \brief Return the metrics collected for a node of this plan
+  ///
+  /// Metrics are complete once finished() has completed.  Fails with Invalid if
+  /// the plan was not created with ExecPlanOptions::collect_metrics.
+  Result<ExecNodeMetrics> GetNodeMetrics(const ExecNode* node) const;
+
+  /// \brief Export the recorded spans in the Chrome trace event format
+  ///
+  /// The resulting JSON can be loaded in chrome://tracing or Perfetto.  Fails
+  /// with Invalid if the plan was not created with ExecPlanOptions::collect_trace.
+  Result<std::string> ToChromeTrace() const;
+
  protected:
   ExecContext* exec_context_;
   explicit ExecPlan(ExecContext* exec_context) : exec_context_(exec_context) {}
@@ -133,6 +186,11 @@ class ARROW_EXPORT ExecNode {
   /// Transfer input batch to ExecNode
   virtual void InputReceived(ExecNode* input, ExecBatch batch) = 0;
 
+  /// Whether InputReceived accepts batches carrying a selection vector.
+  ///
+  /// If not, EmitBatch materializes the selection before delivering a batch.
+  virtual bool accepts_selection_vector() const { return false; }
+
   /// Signal error to ExecNode
   virtual void ErrorReceived(ExecNode* input, Status error) = 0;
 
@@ -229,6 +287,12 @@ class ARROW_EXPORT ExecNode {
   // Returns true if the status was an error.
   bool ErrorIfNotOk(Status status);
 
+  // Helper methods to deliver a batch or the end of stream to an output.
+  // These should be preferred over calling the output directly, so that the
+  // plan's instrumentation (if enabled) can account for them.
+  void EmitBatch(ExecNode* output, ExecBatch batch);
+  void EmitFinished(ExecNode* output, int total_batches);
+
   /// Provide extra info to include in the string representation.
   virtual std::string ToStringExtra() const;
 
@@ -17,6 +17,10 @@
 
 #include "arrow/compute/exec/expression.h"
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -489,6 +493,148 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Schema& full
   return ExecuteScalarExpression(expr, input, exec_context);
 }
 
+namespace {
+
+bool IsKleeneConnective(const Expression::Call& call) {
+  return call.function_name == "and_kleene" || call.function_name == "or_kleene";
+}
+
+// When fewer than this fraction of the rows a member was evaluated on are left
+// undecided, the following members are evaluated on a selection of those rows only.
+constexpr double kNarrowingThreshold = 0.5;
+
+struct MemberObservation {
+  int64_t rows_evaluated;
+  int64_t rows_undecided;
+  int64_t nanos;
+};
+
+Result<std::shared_ptr<SelectionVector>> MakeSelection(
+    const std::vector<int32_t>& indices, MemoryPool* pool) {
+  const auto length = static_cast<int64_t>(indices.size());
+  ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(length * sizeof(int32_t), pool));
+  std::copy(indices.begin(), indices.end(),
+            reinterpret_cast<int32_t*>(buffer->mutable_data()));
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), length, {nullptr, std::move(buffer)}, /*null_count=*/0));
+}
+
+// Evaluate and_kleene (whose decisive value is false) or or_kleene (whose decisive value
+// is true) of the given members, in order. Rows for which a member yields the decisive
+// value are decided and need not be evaluated by the following members.
+Result<Datum> ExecuteKleeneConnective(bool decisive,
+                                      const std::vector<Expression>& members,
+                                      const ExecBatch& input,
+                                      compute::ExecContext* exec_context,
+                                      std::vector<MemberObservation>* observations) {
+  DCHECK(!input.selection_vector);
+  constexpr uint8_t kDecided = 1, kNull = 2;
+
+  // Until a member yields an array, the state of all rows is the same
+  uint8_t scalar_state = 0;
+  std::vector<uint8_t> row_states;
+  bool dense = false;
+
+  // The rows which are still undecided, or null if that is all of them
+  std::shared_ptr<SelectionVector> domain;
+
+  for (size_t member_index = 0; member_index < members.size(); ++member_index) {
+    ExecBatch batch = input;
+    if (domain) {
+      batch.selection_vector = domain;
+      batch.length = domain->length();
+    }
+    auto row_at = [&](int64_t i) -> int64_t { return domain ? domain->indices()[i] : i; };
+
+    auto start = std::chrono::steady_clock::now();
+    ARROW_ASSIGN_OR_RAISE(
+        Datum value, ExecuteScalarExpression(members[member_index], batch, exec_context));
+
+    int64_t rows_undecided = 0;
+    if (value.is_scalar()) {
+      const auto& scalar = value.scalar_as<BooleanScalar>();
+      const uint8_t flag =
+          !scalar.is_valid ? kNull : (scalar.value == decisive ? kDecided : 0);
+      if (!dense) {
+        scalar_state |= flag;
+      } else {
+        for (int64_t i = 0; i < batch.length; ++i) row_states[row_at(i)] |= flag;
+      }
+      if (!(flag & kDecided)) rows_undecided = batch.length;
+    } else {
+      if (!dense) {
+        row_states.assign(static_cast<size_t>(input.length), scalar_state);
+        dense = true;
+      }
+      const ArrayData& array = *value.array();
+      const uint8_t* validity =
+          array.GetNullCount() > 0 ? array.buffers[0]->data() : nullptr;
+      const uint8_t* bits = array.buffers[1]->data();
+      for (int64_t i = 0; i < array.length; ++i) {
+        uint8_t& row_state = row_states[row_at(i)];
+        if (validity && !BitUtil::GetBit(validity, array.offset + i)) {
+          row_state |= kNull;
+          ++rows_undecided;
+        } else if (BitUtil::GetBit(bits, array.offset + i) == decisive) {
+          row_state |= kDecided;
+        } else {
+          ++rows_undecided;
+        }
+      }
+    }
+
+    if (observations) {
+      auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+      observations->push_back({batch.length, rows_undecided, nanos});
+    }
+
+    // Rows outside the domain are already decided
+    if (rows_undecided == 0 || (!dense && (scalar_state & kDecided))) break;
+
+    if (dense && member_index + 1 < members.size() &&
+        rows_undecided < kNarrowingThreshold * batch.length) {
+      std::vector<int32_t> undecided;
+      undecided.reserve(rows_undecided);
+      for (int64_t i = 0; i < batch.length; ++i) {
+        const auto row = row_at(i);
+        if (!(row_states[row] & kDecided)) undecided.push_back(static_cast<int32_t>(row));
+      }
+      ARROW_ASSIGN_OR_RAISE(domain,
+                            MakeSelection(undecided, exec_context->memory_pool()));
+    }
+  }
+
+  if (!dense) {
+    if (scalar_state & kDecided) return MakeScalar(decisive);
+    if (scalar_state & kNull) return MakeNullScalar(boolean());
+    return MakeScalar(!decisive);
+  }
+
+  auto pool = exec_context->memory_pool();
+  ARROW_ASSIGN_OR_RAISE(auto values, AllocateEmptyBitmap(input.length, pool));
+  ARROW_ASSIGN_OR_RAISE(auto validity, AllocateEmptyBitmap(input.length, pool));
+  int64_t null_count = 0;
+  for (int64_t row = 0; row < input.length; ++row) {
+    const uint8_t row_state = row_states[row];
+    if (row_state & kDecided) {
+      BitUtil::SetBitTo(values->mutable_data(), row, decisive);
+    } else if (row_state & kNull) {
+      ++null_count;
+      continue;
+    } else {
+      BitUtil::SetBitTo(values->mutable_data(), row, !decisive);
+    }
+    BitUtil::SetBit(validity->mutable_data(), row);
+  }
+  if (null_count == 0) validity = nullptr;
+  return ArrayData::Make(boolean(), input.length,
+                         {std::move(validity), std::move(values)}, null_count);
+}
+
+}  // namespace
+
 Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
                                       compute::ExecContext* exec_context) {
   if (exec_context == nullptr) {
@@ -507,6 +653,14 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
 
   if (auto lit = expr.literal()) return *lit;
 
+  if (input.selection_vector) {
+    // Gather only the columns referenced by this expression, then evaluate densely
+    ARROW_ASSIGN_OR_RAISE(
+        auto materialized,
+        input.MaterializeSelection(FieldIndicesInExpression(expr), exec_context));
+    return ExecuteScalarExpression(expr, materialized, exec_context);
+  }
+
   if (auto param = expr.parameter()) {
     if (param->descr.type->id() == Type::NA) {
       return MakeNullScalar(null());
@@ -524,6 +678,12 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
 
   auto call = CallNotNull(expr);
 
+  if (IsKleeneConnective(*call)) {
+    return ExecuteKleeneConnective(call->function_name == "or_kleene",
+                                   FlattenedAssociativeChain(expr).fringe, input,
+                                   exec_context, /*observations=*/nullptr);
+  }
+
   std::vector<Datum> arguments(call->arguments.size());
   for (size_t i = 0; i < arguments.size(); ++i) {
     ARROW_ASSIGN_OR_RAISE(
@@ -551,6 +711,277 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
 
 namespace {
 
+// The number of leading arguments of a call which are evaluated for every row. The
+// members of a Kleene connective after the first are skipped for decided rows, and
+// only the rows selected by the first argument of a conditional function use the
+// others, so hoisting those could raise errors (e.g. a guarded division by zero).
+size_t NumUnconditionalArguments(const Expression::Call& call) {
+  static const std::unordered_set<std::string> kConditional = {
+      "and_kleene", "or_kleene", "if_else", "case_when", "choose", "coalesce"};
+  if (kConditional.count(call.function_name) > 0) {
+    return std::min<size_t>(1, call.arguments.size());
+  }
+  return call.arguments.size();
+}
+
+void CountCalls(const Expression& expr,
+                std::unordered_map<Expression, int, Expression::Hash>* counts,
+                std::vector<Expression>* calls) {
+  auto call = expr.call();
+  if (call == nullptr) return;
+  if ((*counts)[expr]++ == 0) calls->push_back(expr);
+  for (size_t i = 0; i < NumUnconditionalArguments(*call); ++i) {
+    CountCalls(call->arguments[i], counts, calls);
+  }
+}
+
+int CountOccurrences(const Expression& expr, const Expression& subexpr) {
+  auto call = expr.call();
+  if (call == nullptr) return 0;
+  if (expr == subexpr) return 1;
+  int count = 0;
+  for (size_t i = 0; i < NumUnconditionalArguments(*call); ++i) {
+    count += CountOccurrences(call->arguments[i], subexpr);
+  }
+  return count;
+}
+
+int NumNodes(const Expression& expr) {
+  int num_nodes = 1;
+  if (auto call = expr.call()) {
+    for (const Expression& arg : call->arguments) num_nodes += NumNodes(arg);
+  }
+  return num_nodes;
+}
+
+Expression MakeColumnReference(int index, ValueDescr descr) {
+  Expression::Parameter param;
+  param.ref = FieldRef(index);
+  param.descr = std::move(descr);
+  param.index = index;
+  return Expression(std::move(param));
+}
+
+Result<Expression> ReplaceSubexpression(Expression expr, const Expression& subexpr,
+                                        const Expression& replacement) {
+  return Modify(
+      std::move(expr),
+      [&](Expression expr) { return expr == subexpr ? replacement : expr; },
+      [](Expression expr, ...) { return expr; });
+}
+
+}  // namespace
+
+Result<CommonSubexpressions> EliminateCommonSubexpressions(
+    const std::vector<Expression>& exprs, int num_input_columns) {
+  std::unordered_map<Expression, int, Expression::Hash> counts;
+  std::vector<Expression> candidates;
+  for (const Expression& expr : exprs) {
+    DCHECK(expr.IsBound());
+    CountCalls(expr, &counts, &candidates);
+  }
+  candidates.erase(
+      std::remove_if(candidates.begin(), candidates.end(),
+                     [&](const Expression& expr) { return counts[expr] < 2; }),
+      candidates.end());
+
+  // Factor the largest subexpressions first, so that subexpressions which only occur
+  // within a larger common subexpression are not factored separately
+  std::vector<int> num_nodes(candidates.size());
+  std::vector<size_t> order(candidates.size());
+  for (size_t i = 0; i < candidates.size(); ++i) num_nodes[i] = NumNodes(candidates[i]);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](size_t l, size_t r) { return num_nodes[l] > num_nodes[r]; });
+
+  CommonSubexpressions out;
+  out.exprs = exprs;
+  for (size_t i : order) {
+    const Expression& candidate = candidates[i];
+    int occurrences = 0;
+    for (const Expression& expr : out.exprs) {
+      occurrences += CountOccurrences(expr, candidate);
+    }
+    for (const Expression& expr : out.common) {
+      occurrences += CountOccurrences(expr, candidate);
+    }
+    if (occurrences < 2) continue;
+
+    // Temporarily number common subexpressions in the order they are factored
+    auto reference = MakeColumnReference(
+        num_input_columns + static_cast<int>(out.common.size()), candidate.descr());
+    for (Expression& expr : out.exprs) {
+      ARROW_ASSIGN_OR_RAISE(expr, ReplaceSubexpression(expr, candidate, reference));
+    }
+    for (Expression& expr : out.common) {
+      ARROW_ASSIGN_OR_RAISE(expr, ReplaceSubexpression(expr, candidate, reference));
+    }
+    out.common.push_back(candidate);
+  }
+
+  // Smaller common subexpressions may occur within larger ones (which were factored
+  // earlier) but not the reverse, so reverse the order to get an evaluation order
+  const int num_common = static_cast<int>(out.common.size());
+  std::reverse(out.common.begin(), out.common.end());
+  auto renumber = [&](Expression expr) {
+    auto param = expr.parameter();
+    if (param == nullptr || param->index < num_input_columns) return expr;
+    return MakeColumnReference(2 * num_input_columns + num_common - 1 - param->index,
+                               param->descr);
+  };
+  for (auto* group : {&out.exprs, &out.common}) {
+    for (Expression& expr : *group) {
+      ARROW_ASSIGN_OR_RAISE(
+          expr, Modify(expr, renumber, [](Expression expr, ...) { return expr; }));
+    }
+  }
+  return out;
+}
+
+Result<std::vector<Datum>> ExecuteScalarExpressions(const CommonSubexpressions& exprs,
+                                                    const ExecBatch& input,
+                                                    compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return ExecuteScalarExpressions(exprs, input, &exec_context);
+  }
+
+  ExecBatch extended = input;
+  if (input.selection_vector) {
+    // Gather each referenced input column once
+    std::vector<int> referenced;
+    for (const auto* group : {&exprs.common, &exprs.exprs}) {
+      for (const Expression& expr : *group) {
+        for (int i : FieldIndicesInExpression(expr)) {
+          if (i < input.num_values()) referenced.push_back(i);
+        }
+      }
+    }
+    std::sort(referenced.begin(), referenced.end());
+    referenced.erase(std::unique(referenced.begin(), referenced.end()), referenced.end());
+    ARROW_ASSIGN_OR_RAISE(extended,
+                          input.MaterializeSelection(referenced, exec_context));
+  }
+
+  extended.values.reserve(extended.values.size() + exprs.common.size());
+  for (const Expression& expr : exprs.common) {
+    ARROW_ASSIGN_OR_RAISE(auto value,
+                          ExecuteScalarExpression(expr, extended, exec_context));
+    extended.values.push_back(std::move(value));
+  }
+
+  std::vector<Datum> out(exprs.exprs.size());
+  for (size_t i = 0; i < out.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(
+        out[i], ExecuteScalarExpression(exprs.exprs[i], extended, exec_context));
+  }
+  return out;
+}
+
+class ConjunctionEvaluator::Impl {
+ public:
+  std::vector<Expression> Order(std::vector<Expression> members) const {
+    std::vector<double> ranks(members.size());
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (size_t i = 0; i < members.size(); ++i) {
+        auto it = statistics_.find(members[i]);
+        // Members which haven't been observed yet go first, so that they get observed
+        ranks[i] = it == statistics_.end() ? 0 : it->second.rank();
+      }
+    }
+
+    std::vector<size_t> indices(members.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::stable_sort(indices.begin(), indices.end(),
+                     [&](size_t l, size_t r) { return ranks[l] < ranks[r]; });
+
+    std::vector<Expression> ordered(members.size());
+    for (size_t i = 0; i < members.size(); ++i) {
+      ordered[i] = std::move(members[indices[i]]);
+    }
+    return ordered;
+  }
+
+  void Record(const std::vector<Expression>& members,
+              const std::vector<MemberObservation>& observations) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < observations.size(); ++i) {
+      auto& statistics = statistics_[members[i]];
+      if (statistics.rows_evaluated > kDecayRows) {
+        // Decay older observations so that the order can follow changes in the data
+        statistics.rows_evaluated /= 2;
+        statistics.rows_undecided /= 2;
+        statistics.nanos /= 2;
+      }
+      statistics.rows_evaluated += observations[i].rows_evaluated;
+      statistics.rows_undecided += observations[i].rows_undecided;
+      statistics.nanos += observations[i].nanos;
+    }
+  }
+
+ private:
+  static constexpr double kDecayRows = 1 << 22;
+
+  struct Statistics {
+    double rows_evaluated = 0, rows_undecided = 0, nanos = 0;
+
+    // The expected cost per row decided: lower is better
+    double rank() const {
+      if (rows_evaluated == 0) return 0;
+      const double decided_fraction = 1 - rows_undecided / rows_evaluated;
+      return (nanos / rows_evaluated) / std::max(decided_fraction, 1e-3);
+    }
+  };
+
+  mutable std::mutex mutex_;
+  std::unordered_map<Expression, Statistics, Expression::Hash> statistics_;
+};
+
+constexpr double ConjunctionEvaluator::Impl::kDecayRows;
+
+ConjunctionEvaluator::ConjunctionEvaluator() : impl_(new Impl) {}
+
+ConjunctionEvaluator::~ConjunctionEvaluator() = default;
+
+Result<Datum> ConjunctionEvaluator::Execute(const Expression& filter,
+                                            const ExecBatch& input,
+                                            compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return Execute(filter, input, &exec_context);
+  }
+
+  auto call = filter.call();
+  if (call == nullptr || !filter.IsBound() || !IsKleeneConnective(*call)) {
+    return ExecuteScalarExpression(filter, input, exec_context);
+  }
+
+  if (input.selection_vector) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto materialized,
+        input.MaterializeSelection(FieldIndicesInExpression(filter), exec_context));
+    return Execute(filter, materialized, exec_context);
+  }
+
+  auto members = impl_->Order(FlattenedAssociativeChain(filter).fringe);
+  std::vector<MemberObservation> observations;
+  ARROW_ASSIGN_OR_RAISE(auto out, ExecuteKleeneConnective(
+                                      call->function_name == "or_kleene", members,
+                                      input, exec_context, &observations));
+  impl_->Record(members, observations);
+  return out;
+}
+
+std::vector<Expression> ConjunctionEvaluator::GetEvaluationOrder(
+    const Expression& filter) const {
+  auto call = filter.call();
+  if (call == nullptr || !IsKleeneConnective(*call)) return {filter};
+  return impl_->Order(FlattenedAssociativeChain(filter).fringe);
+}
+
+namespace {
+
 std::array<std::pair<const Expression&, const Expression&>, 2>
 ArgumentsAndFlippedArguments(const Expression::Call& call) {
   DCHECK_EQ(call.arguments.size(), 2);
@@ -608,6 +1039,27 @@ bool ExpressionHasFieldRefs(const Expression& expr) {
   return false;
 }
 
+namespace {
+
+void AddFieldIndices(const Expression& expr, std::vector<int>* indices) {
+  if (auto param = expr.parameter()) {
+    DCHECK(expr.IsBound());
+    indices->push_back(param->index);
+  } else if (auto call = expr.call()) {
+    for (const Expression& arg : call->arguments) AddFieldIndices(arg, indices);
+  }
+}
+
+}  // namespace
+
+std::vector<int> FieldIndicesInExpression(const Expression& expr) {
+  std::vector<int> indices;
+  AddFieldIndices(expr, &indices);
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+  return indices;
+}
+
 Result<Expression> FoldConstants(Expression expr) {
   return Modify(
       std::move(expr), [](Expression expr) { return expr; },
@@ -166,6 +166,10 @@ std::vector<FieldRef> FieldsInExpression(const Expression&);
 ARROW_EXPORT
 bool ExpressionHasFieldRefs(const Expression&);
 
+/// Assemble the (deduplicated) indices of all fields referenced by a bound Expression.
+ARROW_EXPORT
+std::vector<int> FieldIndicesInExpression(const Expression&);
+
 /// Assemble a mapping from field references to known values.
 struct ARROW_EXPORT KnownFieldValues;
 ARROW_EXPORT
@@ -230,6 +234,56 @@ ARROW_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const Schema& full_schema,
                                       const Datum& partial_input, ExecContext* = NULLPTR);
 
+/// \brief A set of expressions with their common subexpressions factored out.
+struct ARROW_EXPORT CommonSubexpressions {
+  /// Subexpressions which occurred more than once, in evaluation order. The result of
+  /// the i-th is appended to the input batch as column `num_input_columns + i`, which
+  /// the following common subexpressions and `exprs` reference instead of recomputing.
+  std::vector<Expression> common;
+
+  /// The original expressions, rewritten to reference the common subexpressions.
+  std::vector<Expression> exprs;
+};
+
+/// Factor calls which occur more than once in a set of bound expressions, for example
+/// multiply(a, b) in [multiply(a, b), add(multiply(a, b), 1)]. The largest repeated
+/// subexpressions are factored first.
+ARROW_EXPORT
+Result<CommonSubexpressions> EliminateCommonSubexpressions(
+    const std::vector<Expression>& exprs, int num_input_columns);
+
+/// Execute expressions factored by EliminateCommonSubexpressions(), evaluating each
+/// common subexpression once.
+ARROW_EXPORT
+Result<std::vector<Datum>> ExecuteScalarExpressions(const CommonSubexpressions& exprs,
+                                                    const ExecBatch& input,
+                                                    ExecContext* = NULLPTR);
+
+/// \brief Executes boolean filter expressions, ordering conjunctions adaptively.
+///
+/// ExecuteScalarExpression() short-circuits and_kleene and or_kleene: each member is
+/// evaluated only on the rows which the preceding members haven't already decided.
+/// This additionally records the cost and selectivity observed for each member of a
+/// top-level conjunction (or disjunction) and evaluates cheap, selective members
+/// first in subsequent calls. It may be used concurrently from multiple threads.
+class ARROW_EXPORT ConjunctionEvaluator {
+ public:
+  ConjunctionEvaluator();
+  ~ConjunctionEvaluator();
+
+  /// Execute a bound filter expression, as ExecuteScalarExpression() would.
+  Result<Datum> Execute(const Expression& filter, const ExecBatch& input,
+                        ExecContext* = NULLPTR);
+
+  /// The order in which the members of the filter's top-level conjunction would be
+  /// evaluated by the next call to Execute().
+  std::vector<Expression> GetEvaluationOrder(const Expression& filter) const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 // Serialization
 
 ARROW_EXPORT
@@ -17,10 +17,13 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec/expression.h"
 #include "arrow/dataset/partition.h"
+#include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 
 namespace arrow {
@@ -84,5 +87,103 @@ BENCHMARK_CAPTURE(SimplifyFilterWithGuarantee,
 BENCHMARK_CAPTURE(SimplifyFilterWithGuarantee, positive_filter_cast_guarantee_dictionary,
                   filter_cast_positive, guarantee_dictionary);
 
+// A benchmark of ExecuteScalarExpression over batches of various sizes.  For small
+// batches, allocating the outputs of each kernel is a significant part of the cost.
+static void ExecuteScalarExpressionOverhead(benchmark::State& state,
+                                            bool recycle_buffers) {
+  const int64_t batch_size = state.range(0);
+  auto dataset_schema = schema({field("a", int64()), field("b", int64())});
+  random::RandomArrayGenerator rng(42);
+  ExecBatch batch({rng.Int64(batch_size, 0, 100), rng.Int64(batch_size, 0, 100)},
+                  batch_size);
+
+  auto expr = greater(call("add", {call("multiply", {field_ref("a"), literal(2)}),
+                                   field_ref("b")}),
+                      literal(100));
+  ASSIGN_OR_ABORT(expr, expr.Bind(*dataset_schema));
+
+  RecyclingMemoryPool recycling_pool(default_memory_pool());
+  ExecContext ctx(recycle_buffers ? &recycling_pool : default_memory_pool());
+  for (auto _ : state) {
+    ABORT_NOT_OK(ExecuteScalarExpression(expr, batch, &ctx));
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+BENCHMARK_CAPTURE(ExecuteScalarExpressionOverhead, default_pool, false)
+    ->RangeMultiplier(8)
+    ->Range(64, 64 * 1024);
+BENCHMARK_CAPTURE(ExecuteScalarExpressionOverhead, recycling_pool, true)
+    ->RangeMultiplier(8)
+    ->Range(64, 64 * 1024);
+
+// A benchmark of a filter conjunction with a cheap, selective member and an expensive
+// member which excludes few rows. Evaluating the cheap member first restricts the
+// expensive one to the few surviving rows; ConjunctionEvaluator should find that order
+// even if the filter is written the other way around.
+static void ExecuteConjunction(benchmark::State& state, bool cheap_first, bool adaptive) {
+  const int64_t batch_size = 64 * 1024;
+  auto dataset_schema = schema({field("a", int64()), field("s", utf8())});
+  random::RandomArrayGenerator rng(42);
+  ExecBatch batch({rng.Int64(batch_size, 0, 1000), rng.String(batch_size, 8, 32)},
+                  batch_size);
+
+  auto cheap = equal(field_ref("a"), literal(int64_t(7)));
+  auto expensive = call("invert", {call("match_substring", {field_ref("s")},
+                                        MatchSubstringOptions("xyz"))});
+  auto expr = cheap_first ? and_(cheap, expensive) : and_(expensive, cheap);
+  ASSIGN_OR_ABORT(expr, expr.Bind(*dataset_schema));
+
+  ConjunctionEvaluator evaluator;
+  ExecContext ctx;
+  for (auto _ : state) {
+    if (adaptive) {
+      ABORT_NOT_OK(evaluator.Execute(expr, batch, &ctx));
+    } else {
+      ABORT_NOT_OK(ExecuteScalarExpression(expr, batch, &ctx));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+BENCHMARK_CAPTURE(ExecuteConjunction, cheap_first, true, false);
+BENCHMARK_CAPTURE(ExecuteConjunction, expensive_first, false, false);
+BENCHMARK_CAPTURE(ExecuteConjunction, expensive_first_adaptive, false, true);
+
+// A benchmark of a wide projection whose columns share subexpressions, as is common in
+// feature engineering, with or without common subexpression elimination.
+static void ExecuteProjection(benchmark::State& state, bool eliminate_common) {
+  const int64_t batch_size = 64 * 1024;
+  auto dataset_schema = schema({field("a", float64()), field("b", float64())});
+  random::RandomArrayGenerator rng(42);
+  ExecBatch batch({rng.Float64(batch_size, 0, 1), rng.Float64(batch_size, 1, 2)},
+                  batch_size);
+
+  auto product = call("multiply", {field_ref("a"), field_ref("b")});
+  auto ratio = call("divide", {product, call("add", {field_ref("a"), field_ref("b")})});
+  std::vector<Expression> exprs;
+  for (int i = 0; i < 8; ++i) {
+    exprs.push_back(call("add", {product, literal(static_cast<double>(i))}));
+    exprs.push_back(call("multiply", {ratio, literal(static_cast<double>(i))}));
+  }
+  for (auto& expr : exprs) {
+    ASSIGN_OR_ABORT(expr, expr.Bind(*dataset_schema));
+  }
+
+  CommonSubexpressions factored{/*common=*/{}, exprs};
+  if (eliminate_common) {
+    ASSIGN_OR_ABORT(factored, EliminateCommonSubexpressions(exprs, 2));
+  }
+
+  ExecContext ctx;
+  for (auto _ : state) {
+    ABORT_NOT_OK(ExecuteScalarExpressions(factored, batch, &ctx));
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+BENCHMARK_CAPTURE(ExecuteProjection, independent, false);
+BENCHMARK_CAPTURE(ExecuteProjection, eliminate_common_subexpressions, true);
+
 }  // namespace compute
 }  // namespace arrow
@@ -699,6 +699,162 @@ TEST(Expression, ExecuteCall) {
   ])"));
 }
 
+TEST(Expression, ExecuteKleeneConnectives) {
+  auto input = ArrayFromJSON(
+      struct_({field("a", int32()), field("b", boolean()), field("c", int32())}), R"([
+    {"a": 1, "b": true,  "c": 5},
+    {"a": 2, "b": null,  "c": 4},
+    {"a": 3, "b": false, "c": null},
+    {"a": 4, "b": true,  "c": 2},
+    {"a": 5, "b": null,  "c": 1},
+    {"a": null, "b": true, "c": 0},
+    {"a": 7, "b": false, "c": 9},
+    {"a": 8, "b": true,  "c": 8}
+  ])");
+
+  // Members after the first are evaluated only on the rows which are still undecided
+  ExpectExecute(and_({greater(field_ref("a"), literal(6)), field_ref("b"),
+                      less(field_ref("c"), literal(9))}),
+                input);
+  ExpectExecute(and_({field_ref("b"), greater(field_ref("a"), literal(1)),
+                      greater(field_ref("c"), literal(1))}),
+                input);
+  ExpectExecute(or_({less(field_ref("a"), literal(2)), field_ref("b"),
+                     equal(field_ref("c"), literal(9))}),
+                input);
+  ExpectExecute(or_(and_(field_ref("b"), greater(field_ref("c"), literal(3))),
+                    is_null(field_ref("a"))),
+                input);
+
+  // Scalar members
+  ExpectExecute(and_({literal(true), field_ref("b")}), input);
+  ExpectExecute(and_({field_ref("b"), literal(false)}), input);
+  ExpectExecute(or_({literal(std::make_shared<BooleanScalar>()), field_ref("b")}), input);
+  ExpectExecute(or_({literal(false), literal(std::make_shared<BooleanScalar>())}), input);
+}
+
+TEST(Expression, ConjunctionEvaluator) {
+  auto input = ArrayFromJSON(struct_({field("a", int32()), field("b", int32())}), R"([
+    {"a": 1, "b": 5},
+    {"a": 2, "b": 4},
+    {"a": 3, "b": null},
+    {"a": 4, "b": 2},
+    {"a": null, "b": 1}
+  ])");
+  auto schm = schema(input->type()->fields());
+  ASSERT_OK_AND_ASSIGN(auto batch, MakeExecBatch(*schm, input));
+
+  // The second member is false for most rows and the first for none, so the second
+  // should be evaluated first
+  auto never_false = not_equal(field_ref("a"), literal(100));
+  auto mostly_false = equal(field_ref("b"), literal(4));
+  ASSERT_OK_AND_ASSIGN(auto filter, and_(never_false, mostly_false).Bind(*schm));
+  ASSERT_OK_AND_ASSIGN(never_false, never_false.Bind(*schm));
+  ASSERT_OK_AND_ASSIGN(mostly_false, mostly_false.Bind(*schm));
+
+  ConjunctionEvaluator evaluator;
+  ASSERT_EQ(evaluator.GetEvaluationOrder(filter),
+            (std::vector<Expression>{never_false, mostly_false}));
+
+  ASSERT_OK_AND_ASSIGN(Datum expected, NaiveExecuteScalarExpression(filter, input));
+  for (int i = 0; i < 16; ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum actual, evaluator.Execute(filter, batch));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+  ASSERT_EQ(evaluator.GetEvaluationOrder(filter),
+            (std::vector<Expression>{mostly_false, never_false}));
+
+  // Other expressions are simply executed
+  ASSERT_EQ(evaluator.GetEvaluationOrder(never_false),
+            std::vector<Expression>{never_false});
+  ASSERT_OK_AND_ASSIGN(expected, ExecuteScalarExpression(never_false, batch));
+  ASSERT_OK_AND_ASSIGN(Datum actual, evaluator.Execute(never_false, batch));
+  AssertDatumsEqual(expected, actual, /*verbose=*/true);
+}
+
+TEST(Expression, EliminateCommonSubexpressions) {
+  auto input = ArrayFromJSON(
+      struct_({field("a", int32()), field("b", int32()), field("c", int32())}), R"([
+    {"a": 1, "b": 5, "c": 0},
+    {"a": 2, "b": null, "c": 1},
+    {"a": 3, "b": 3, "c": null},
+    {"a": null, "b": 2, "c": 3}
+  ])");
+  auto schm = schema(input->type()->fields());
+  ASSERT_OK_AND_ASSIGN(auto batch, MakeExecBatch(*schm, input));
+
+  auto check = [&](std::vector<Expression> exprs, size_t expected_num_common) {
+    for (auto& expr : exprs) {
+      ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*schm));
+    }
+    ASSERT_OK_AND_ASSIGN(auto factored, EliminateCommonSubexpressions(exprs, 3));
+    ASSERT_EQ(factored.common.size(), expected_num_common);
+    ASSERT_EQ(factored.exprs.size(), exprs.size());
+
+    for (bool with_selection : {false, true}) {
+      ExecBatch target = batch;
+      if (with_selection) {
+        target.selection_vector =
+            std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 1, 3]"));
+        target.length = 3;
+      }
+      ASSERT_OK_AND_ASSIGN(auto actual, ExecuteScalarExpressions(factored, target));
+      ASSERT_EQ(actual.size(), exprs.size());
+      for (size_t i = 0; i < exprs.size(); ++i) {
+        ASSERT_OK_AND_ASSIGN(auto expected, ExecuteScalarExpression(exprs[i], target));
+        AssertDatumsEqual(expected, actual[i], /*verbose=*/true);
+      }
+    }
+  };
+
+  auto ab = call("multiply", {field_ref("a"), field_ref("b")});
+  auto c1 = call("add", {field_ref("c"), literal(1)});
+  check({ab, call("add", {ab, literal(1)}),
+         call("cast", {ab}, compute::CastOptions::Safe(float64())), c1,
+         call("multiply", {c1, c1})},
+        /*expected_num_common=*/2);
+
+  // Only the larger subexpression is factored, since the smaller one occurs within it
+  auto ab1 = call("add", {ab, literal(1)});
+  check({ab1, call("multiply", {ab1, literal(2)}), field_ref("c")},
+        /*expected_num_common=*/1);
+
+  // Nothing to factor
+  check({ab, c1, field_ref("a"), field_ref("a")}, /*expected_num_common=*/0);
+}
+
+TEST(Expression, EliminateCommonSubexpressionsShortCircuit) {
+  auto input = ArrayFromJSON(struct_({field("a", int32()), field("b", int32())}), R"([
+    {"a": 4, "b": 0},
+    {"a": 6, "b": 0},
+    {"a": 8, "b": 0},
+    {"a": 8, "b": 2}
+  ])");
+  auto schm = schema(input->type()->fields());
+  ASSERT_OK_AND_ASSIGN(auto batch, MakeExecBatch(*schm, input));
+
+  // The division is only evaluated for the rows the guard lets through, so it
+  // must not be hoisted out of the conjunctions
+  auto guard = not_equal(field_ref("b"), literal(0));
+  auto quotient = call("divide_checked", {field_ref("a"), field_ref("b")});
+  std::vector<Expression> exprs = {and_(guard, greater(quotient, literal(1))),
+                                   and_(guard, less(quotient, literal(5)))};
+  for (auto& expr : exprs) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*schm));
+  }
+  ASSERT_OK_AND_ASSIGN(auto factored, EliminateCommonSubexpressions(exprs, 2));
+  // Only the guard is factored
+  ASSERT_EQ(factored.common.size(), 1);
+
+  ASSERT_OK_AND_ASSIGN(auto actual, ExecuteScalarExpressions(factored, batch));
+  ASSERT_EQ(actual.size(), exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto expected, ExecuteScalarExpression(exprs[i], batch));
+    AssertDatumsEqual(expected, actual[i], /*verbose=*/true);
+  }
+  AssertDatumsEqual(ArrayFromJSON(boolean(), "[false, false, false, true]"), actual[1]);
+}
+
 TEST(Expression, ExecuteDictionaryTransparent) {
   ExpectExecute(
       equal(field_ref("a"), field_ref("b")),
@@ -17,6 +17,7 @@
 
 #include "arrow/compute/exec/exec_plan.h"
 
+#include "arrow/array/array_primitive.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec/expression.h"
@@ -62,18 +63,25 @@ class FilterNode : public ExecNode {
                                filter_expression.type()->ToString());
     }
 
-    return plan->EmplaceNode<FilterNode>(plan, std::move(inputs), std::move(schema),
-                                         std::move(filter_expression));
+    ExecNode* filter_node = plan->EmplaceNode<FilterNode>(
+        plan, std::move(inputs), std::move(schema), std::move(filter_expression));
+    if (!filter_options.coalesce_output) {
+      return filter_node;
+    }
+    return MakeExecNode("coalesce", plan, {filter_node}, CoalesceNodeOptions{});
   }
 
   const char* kind_name() const override { return "FilterNode"; }
 
+  bool accepts_selection_vector() const override { return true; }
+
   Result<ExecBatch> DoFilter(const ExecBatch& target) {
     ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
                           SimplifyWithGuarantee(filter_, target.guarantee));
 
-    ARROW_ASSIGN_OR_RAISE(Datum mask, ExecuteScalarExpression(simplified_filter, target,
-                                                              plan()->exec_context()));
+    ARROW_ASSIGN_OR_RAISE(
+        Datum mask, conjunction_evaluator_.Execute(simplified_filter, target,
+                                                   plan()->exec_context()));
 
     if (mask.is_scalar()) {
       const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
@@ -88,6 +96,22 @@ class FilterNode : public ExecNode {
     DCHECK(!std::all_of(target.values.begin(), target.values.end(),
                         [](const Datum& value) { return value.is_scalar(); }));
 
+    if (target.selection_vector || outputs_[0]->accepts_selection_vector()) {
+      // Defer materialization: the output only gathers the columns it references
+      const BooleanArray mask_array(mask.array());
+      auto pool = plan()->exec_context()->memory_pool();
+      ExecBatch out = target;
+      if (target.selection_vector) {
+        ARROW_ASSIGN_OR_RAISE(out.selection_vector,
+                              target.selection_vector->Filter(mask_array, pool));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(out.selection_vector,
+                              SelectionVector::FromMask(mask_array, pool));
+      }
+      out.length = out.selection_vector->length();
+      return out;
+    }
+
     auto values = target.values;
     for (auto& value : values) {
       if (value.is_scalar()) continue;
@@ -103,7 +127,7 @@ class FilterNode : public ExecNode {
     if (ErrorIfNotOk(maybe_filtered.status())) return;
 
     maybe_filtered->guarantee = batch.guarantee;
-    outputs_[0]->InputReceived(this, maybe_filtered.MoveValueUnsafe());
+    EmitBatch(outputs_[0], maybe_filtered.MoveValueUnsafe());
   }
 
   void ErrorReceived(ExecNode* input, Status error) override {
@@ -113,14 +137,20 @@ class FilterNode : public ExecNode {
 
   void InputFinished(ExecNode* input, int total_batches) override {
     DCHECK_EQ(input, inputs_[0]);
-    outputs_[0]->InputFinished(this, total_batches);
+    EmitFinished(outputs_[0], total_batches);
   }
 
   Status StartProducing() override { return Status::OK(); }
 
-  void PauseProducing(ExecNode* output) override {}
+  void PauseProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->PauseProducing(this);
+  }
 
-  void ResumeProducing(ExecNode* output) override {}
+  void ResumeProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->ResumeProducing(this);
+  }
 
   void StopProducing(ExecNode* output) override {
     DCHECK_EQ(output, outputs_[0]);
@@ -136,6 +166,8 @@ class FilterNode : public ExecNode {
 
  private:
   Expression filter_;
+  // Orders the members of the filter's conjunction by observed cost and selectivity
+  ConjunctionEvaluator conjunction_evaluator_;
 };
 
 }  // namespace
@@ -56,12 +56,37 @@ class ARROW_EXPORT SourceNodeOptions : public ExecNodeOptions {
 /// filter_expression will be evaluated against each batch which is pushed to
 /// this node. Any rows for which filter_expression does not evaluate to `true` will be
 /// excluded in the batch emitted by this node.
+///
+/// A selective filter emits many small batches, which makes the processing of
+/// downstream nodes dominated by per-batch overhead.  If coalesce_output is true,
+/// the filter node is followed by a CoalesceNode with default options.
 class ARROW_EXPORT FilterNodeOptions : public ExecNodeOptions {
  public:
-  explicit FilterNodeOptions(Expression filter_expression)
-      : filter_expression(std::move(filter_expression)) {}
+  explicit FilterNodeOptions(Expression filter_expression, bool coalesce_output = false)
+      : filter_expression(std::move(filter_expression)),
+        coalesce_output(coalesce_output) {}
 
   Expression filter_expression;
+  bool coalesce_output;
+};
+
+/// \brief Make a node which regroups batches passed through it to a target size
+///
+/// Small batches are concatenated and oversized batches are sliced, so that
+/// downstream kernels process batches large enough to amortize per-batch overhead
+/// yet small enough to stay in cache.  Empty batches are dropped.  Emitted batches
+/// will not be ordered.
+class ARROW_EXPORT CoalesceNodeOptions : public ExecNodeOptions {
+ public:
+  explicit CoalesceNodeOptions(int64_t target_rows = 0, int64_t target_bytes = 0)
+      : target_rows(target_rows), target_bytes(target_bytes) {}
+
+  /// The number of rows per emitted batch.  If 0, it is derived from target_bytes
+  /// and the average size of the rows received so far.
+  int64_t target_rows;
+  /// The size in bytes of emitted batches, if target_rows is 0.  If 0, half the
+  /// size of the L2 cache.
+  int64_t target_bytes;
 };
 
 /// \brief Make a node which executes expressions on input batches, producing new batches.
@@ -101,15 +126,110 @@ class ARROW_EXPORT AggregateNodeOptions : public ExecNodeOptions {
   std::vector<FieldRef> keys;
 };
 
+/// \brief A window function evaluated by a WindowNode
+struct ARROW_EXPORT WindowFunction {
+  WindowFunction(std::string function, int64_t offset = 1)  // NOLINT runtime/explicit
+      : function(std::move(function)), offset(offset) {}
+  WindowFunction(const char* function, int64_t offset = 1)  // NOLINT runtime/explicit
+      : WindowFunction(std::string(function), offset) {}
+
+  /// One of "row_number", "rank", "dense_rank", "cumulative_sum", "lag" or "lead"
+  std::string function;
+  /// The number of rows to look back ("lag") or ahead ("lead")
+  int64_t offset;
+};
+
+/// \brief Make a node which evaluates window functions over partitions of its input
+///
+/// Rows are split into partitions of equal partition keys, then ordered within each
+/// partition by the sort keys.  Window functions are evaluated over each partition
+/// in a single pass, keeping constant state per function.
+///
+/// Output batches contain all input columns followed by one column per window
+/// function, ordered by partition keys then by sort keys.  Since input batches may
+/// arrive in any order, all input is accumulated before evaluation.
+class ARROW_EXPORT WindowNodeOptions : public ExecNodeOptions {
+ public:
+  WindowNodeOptions(std::vector<WindowFunction> functions,
+                    std::vector<FieldRef> targets, std::vector<std::string> names,
+                    std::vector<FieldRef> partition_keys = {},
+                    std::vector<SortKey> sort_keys = {})
+      : functions(std::move(functions)),
+        targets(std::move(targets)),
+        names(std::move(names)),
+        partition_keys(std::move(partition_keys)),
+        sort_keys(std::move(sort_keys)) {}
+
+  // window functions to evaluate
+  std::vector<WindowFunction> functions;
+  // fields to which window functions will be applied (ignored by ranking functions)
+  std::vector<FieldRef> targets;
+  // output field names for window functions
+  std::vector<std::string> names;
+  // keys by which rows will be partitioned
+  std::vector<FieldRef> partition_keys;
+  // keys by which rows will be ordered within each partition
+  std::vector<SortKey> sort_keys;
+};
+
+/// \brief Flow control settings for a sink node
+///
+/// Batches which were received by the sink but not yet pulled from its generator
+/// are queued.  When the queue grows above the pause threshold the sink asks its
+/// input to pause producing; this request travels up to the source nodes, which
+/// stop pulling from their generators until the queue drains below the resume
+/// threshold.
+struct ARROW_EXPORT BackpressureOptions {
+  BackpressureOptions() = default;
+
+  BackpressureOptions(int64_t resume_if_below, int64_t pause_if_above,
+                      int64_t memory_budget = 0)
+      : resume_if_below(resume_if_below),
+        pause_if_above(pause_if_above),
+        memory_budget(memory_budget) {}
+
+  /// \brief Pause when more than `pause_if_above` bytes and resume when at most
+  /// `resume_if_below` bytes are queued
+  static BackpressureOptions QueueSize(int64_t resume_if_below, int64_t pause_if_above) {
+    return BackpressureOptions(resume_if_below, pause_if_above);
+  }
+
+  /// \brief Pause while the plan's memory pool has more than `memory_budget` bytes
+  /// allocated and batches are queued
+  ///
+  /// The budget applies to everything allocated from the pool, which is usually
+  /// shared with the rest of the process.  To budget the plan alone, give its
+  /// ExecContext a pool of its own, e.g. a ProxyMemoryPool.
+  static BackpressureOptions MemoryBudget(int64_t memory_budget) {
+    return BackpressureOptions(0, 0, memory_budget);
+  }
+
+  bool should_apply_backpressure() const {
+    return pause_if_above > 0 || memory_budget > 0;
+  }
+
+  /// Queued byte count at or below which a paused input is resumed
+  int64_t resume_if_below = 0;
+  /// Queued byte count above which the input is paused (0 disables)
+  int64_t pause_if_above = 0;
+  /// Bytes allocated from the plan's MemoryPool above which the input is paused
+  /// while the queue is not empty (0 disables).  Since only the queue can be
+  /// drained, the input is resumed whenever the queue becomes empty.  This counts
+  /// all the allocations of the pool, not only the plan's (see MemoryBudget()).
+  int64_t memory_budget = 0;
+};
+
 /// \brief Add a sink node which forwards to an AsyncGenerator<ExecBatch>
 ///
 /// Emitted batches will not be ordered.
 class ARROW_EXPORT SinkNodeOptions : public ExecNodeOptions {
  public:
-  explicit SinkNodeOptions(std::function<Future<util::optional<ExecBatch>>()>* generator)
-      : generator(generator) {}
+  explicit SinkNodeOptions(std::function<Future<util::optional<ExecBatch>>()>* generator,
+                           BackpressureOptions backpressure = {})
+      : generator(generator), backpressure(std::move(backpressure)) {}
 
   std::function<Future<util::optional<ExecBatch>>()>* generator;
+  BackpressureOptions backpressure;
 };
 
 /// \brief Make a node which sorts rows passed through it
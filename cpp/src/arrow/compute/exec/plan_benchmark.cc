@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/async_generator.h"
+
+namespace arrow {
+namespace compute {
+
+// A source -> filter -> project -> sink plan over many small batches, where the
+// filter keeps ~10% of the rows. With coalescing, the project node and the sink see
+// few large batches instead of many tiny ones.
+static void FilterProjectOverhead(benchmark::State& state, bool coalesce) {
+  const int64_t batch_size = state.range(0);
+  const int64_t total_rows = 1 << 20;
+
+  auto dataset_schema = schema({field("a", int64()), field("b", int64())});
+  random::RandomArrayGenerator rng(42);
+  std::vector<util::optional<ExecBatch>> batches;
+  for (int64_t offset = 0; offset < total_rows; offset += batch_size) {
+    batches.push_back(ExecBatch(
+        {rng.Int64(batch_size, 0, 1000), rng.Int64(batch_size, 0, 1000)}, batch_size));
+  }
+
+  auto filter = less(field_ref("a"), literal(int64_t(100)));
+  auto projection = call(
+      "add", {call("multiply", {field_ref("a"), literal(int64_t(2))}), field_ref("b")});
+
+  for (auto _ : state) {
+    ASSIGN_OR_ABORT(auto plan, ExecPlan::Make());
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    ABORT_NOT_OK(
+        Declaration::Sequence(
+            {
+                {"source",
+                 SourceNodeOptions{dataset_schema, MakeVectorGenerator(batches)}},
+                {"filter", FilterNodeOptions{filter, coalesce}},
+                {"project", ProjectNodeOptions{{projection}}},
+                {"sink", SinkNodeOptions{&sink_gen}},
+            })
+            .AddToPlan(plan.get())
+            .status());
+    ABORT_NOT_OK(StartAndCollect(plan.get(), sink_gen).status());
+  }
+  state.SetItemsProcessed(state.iterations() * total_rows);
+}
+
+BENCHMARK_CAPTURE(FilterProjectOverhead, no_coalesce, false)
+    ->RangeMultiplier(8)
+    ->Range(64, 64 * 1024)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(FilterProjectOverhead, coalesce, true)
+    ->RangeMultiplier(8)
+    ->Range(64, 64 * 1024)
+    ->UseRealTime();
+
+}  // namespace compute
+}  // namespace arrow
@@ -17,6 +17,7 @@
 
 #include <gmock/gmock-matchers.h>
 
+#include <atomic>
 #include <functional>
 #include <memory>
 
@@ -473,6 +474,133 @@ TEST(ExecPlanExecution, StressSourceSinkStopped) {
   }
 }
 
+TEST(ExecPlanExecution, SourceFilterSinkBackpressure) {
+  constexpr int kNumBatches = 100;
+  constexpr int kPauseIfAbove = 4;
+  auto batch = ExecBatchFromJSON({int32(), boolean()}, "[[1, true], [2, false]]");
+  const int64_t batch_size = batch.TotalBufferSize();
+  ASSERT_GT(batch_size, 0);
+
+  std::atomic<int> batches_read{0};
+  AsyncGenerator<util::optional<ExecBatch>> source_gen =
+      [&]() -> Future<util::optional<ExecBatch>> {
+    if (batches_read.load() >= kNumBatches) {
+      return AsyncGeneratorEnd<util::optional<ExecBatch>>();
+    }
+    ++batches_read;
+    return Future<util::optional<ExecBatch>>::MakeFinished(batch);
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+  ASSERT_OK(Declaration::Sequence(
+                {
+                    {"source", SourceNodeOptions{schema({field("i32", int32()),
+                                                         field("bool", boolean())}),
+                                                 source_gen}},
+                    {"filter", FilterNodeOptions{literal(true)}},
+                    {"sink", SinkNodeOptions{&sink_gen, BackpressureOptions::QueueSize(
+                                                            batch_size,
+                                                            kPauseIfAbove * batch_size)}},
+                })
+                .AddToPlan(plan.get()));
+  ASSERT_OK(plan->StartProducing());
+
+  // Nothing is pulled from the sink, so the source is paused once the queue is full
+  BusyWait(10, [&] { return batches_read.load() > kPauseIfAbove; });
+  SleepABit();
+  int paused_at = batches_read.load();
+  SleepABit();
+  ASSERT_EQ(batches_read.load(), paused_at);
+  ASSERT_LT(paused_at, kNumBatches);
+
+  // Draining the queue resumes the source
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto collected, CollectAsyncGenerator(sink_gen));
+  ASSERT_EQ(collected.size(), static_cast<size_t>(kNumBatches));
+  ASSERT_EQ(batches_read.load(), kNumBatches);
+  ASSERT_FINISHES_OK(plan->finished());
+}
+
+TEST(ExecPlanExecution, SourceSinkMemoryBudgetBackpressure) {
+  constexpr int kNumBatches = 100;
+  constexpr int64_t kBatchBytes = 1024;
+  constexpr int64_t kMemoryBudget = 4 * kBatchBytes;
+
+  ProxyMemoryPool pool(default_memory_pool());
+  ExecContext ctx(&pool);
+
+  // Each batch holds a buffer allocated from the plan's pool until it is dropped
+  std::atomic<int> batches_read{0};
+  AsyncGenerator<util::optional<ExecBatch>> source_gen =
+      [&]() -> Future<util::optional<ExecBatch>> {
+    if (batches_read.load() >= kNumBatches) {
+      return AsyncGeneratorEnd<util::optional<ExecBatch>>();
+    }
+    ++batches_read;
+    auto maybe_buffer = AllocateBuffer(kBatchBytes, &pool);
+    if (!maybe_buffer.ok()) return maybe_buffer.status();
+    auto values = ArrayData::Make(int8(), kBatchBytes,
+                                  {nullptr, std::move(maybe_buffer).ValueOrDie()});
+    return Future<util::optional<ExecBatch>>::MakeFinished(
+        ExecBatch({Datum(std::move(values))}, kBatchBytes));
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx));
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+  ASSERT_OK(Declaration::Sequence(
+                {
+                    {"source",
+                     SourceNodeOptions{schema({field("i8", int8())}), source_gen}},
+                    {"sink", SinkNodeOptions{&sink_gen, BackpressureOptions::MemoryBudget(
+                                                            kMemoryBudget)}},
+                })
+                .AddToPlan(plan.get()));
+  ASSERT_OK(plan->StartProducing());
+
+  // Nothing is pulled from the sink, so the source is paused once the pool exceeds
+  // the budget
+  BusyWait(10, [&] { return pool.bytes_allocated() > kMemoryBudget; });
+  SleepABit();
+  int paused_at = batches_read.load();
+  SleepABit();
+  ASSERT_EQ(batches_read.load(), paused_at);
+  ASSERT_LT(paused_at, kNumBatches);
+
+  // Dropping the queued batches resumes the source
+  int num_collected = 0;
+  while (true) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto maybe_batch, sink_gen());
+    if (!maybe_batch) break;
+    ++num_collected;
+  }
+  ASSERT_EQ(num_collected, kNumBatches);
+  ASSERT_EQ(batches_read.load(), kNumBatches);
+  ASSERT_FINISHES_OK(plan->finished());
+}
+
+TEST(ExecPlanExecution, SinkBackpressureOptionsValidation) {
+  auto basic_data = MakeBasicBatches();
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  ASSERT_OK_AND_ASSIGN(auto source,
+                       MakeExecNode("source", plan.get(), {},
+                                    SourceNodeOptions{basic_data.schema,
+                                                      basic_data.gen(/*parallel=*/false,
+                                                                     /*slow=*/false)}));
+
+  ASSERT_RAISES(Invalid,
+                MakeExecNode("sink", plan.get(), {source},
+                             SinkNodeOptions{&sink_gen, BackpressureOptions::QueueSize(
+                                                            /*resume_if_below=*/10,
+                                                            /*pause_if_above=*/5)}));
+  ASSERT_RAISES(Invalid,
+                MakeExecNode("sink", plan.get(), {source},
+                             SinkNodeOptions{&sink_gen, BackpressureOptions::MemoryBudget(
+                                                            /*memory_budget=*/-1)}));
+}
+
 TEST(ExecPlanExecution, SourceFilterSink) {
   auto basic_data = MakeBasicBatches();
 
@@ -587,6 +715,38 @@ TEST(ExecPlanExecution, SourceGroupedSum) {
   }
 }
 
+TEST(ExecPlanExecution, SourceGroupedSumScalarKeys) {
+  // Keys may be scalars, e.g. partition fields known for a whole batch
+  BatchesWithSchema input;
+  input.schema = schema({field("i32", int32()), field("str", utf8())});
+  input.batches = {
+      ExecBatch({ArrayFromJSON(int32(), "[1, 2]"), MakeScalar(std::string("alfa"))}, 2),
+      ExecBatch({ArrayFromJSON(int32(), "[3]"), MakeScalar(std::string("beta"))}, 1),
+      ExecBatch({ArrayFromJSON(int32(), "[4, 5, 6]"), MakeScalar(std::string("alfa"))},
+                3),
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+  ASSERT_OK(Declaration::Sequence(
+                {
+                    {"source", SourceNodeOptions{input.schema,
+                                                 input.gen(/*parallel=*/false,
+                                                           /*slow=*/false)}},
+                    {"aggregate",
+                     AggregateNodeOptions{/*aggregates=*/{{"hash_sum", nullptr}},
+                                          /*targets=*/{"i32"}, /*names=*/{"sum(i32)"},
+                                          /*keys=*/{"str"}}},
+                    {"sink", SinkNodeOptions{&sink_gen}},
+                })
+                .AddToPlan(plan.get()));
+
+  ASSERT_THAT(StartAndCollect(plan.get(), sink_gen),
+              Finishes(ResultWith(UnorderedElementsAreArray({ExecBatchFromJSON(
+                  {int64(), utf8()}, R"([[18, "alfa"], [3, "beta"]])")}))));
+}
+
 TEST(ExecPlanExecution, SourceFilterProjectGroupedSumFilter) {
   for (bool parallel : {false, true}) {
     SCOPED_TRACE(parallel ? "parallel/merged" : "serial");
@@ -625,6 +785,144 @@ TEST(ExecPlanExecution, SourceFilterProjectGroupedSumFilter) {
   }
 }
 
+TEST(ExecPlanExecution, SourceFilterGroupedSum) {
+  // The filter emits selection vectors which the aggregate gathers from
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel/merged" : "serial");
+
+    auto input = MakeGroupableBatches(/*multiplicity=*/parallel ? 100 : 1);
+
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+    ASSERT_OK(Declaration::Sequence(
+                  {
+                      {"source", SourceNodeOptions{input.schema,
+                                                   input.gen(parallel, /*slow=*/false)}},
+                      {"filter",
+                       FilterNodeOptions{greater(field_ref("i32"), literal(0))}},
+                      {"aggregate",
+                       AggregateNodeOptions{/*aggregates=*/{{"hash_sum", nullptr}},
+                                            /*targets=*/{"i32"}, /*names=*/{"sum(i32)"},
+                                            /*keys=*/{"str"}}},
+                      {"sink", SinkNodeOptions{&sink_gen}},
+                  })
+                  .AddToPlan(plan.get()));
+
+    ASSERT_THAT(StartAndCollect(plan.get(), sink_gen),
+                Finishes(ResultWith(UnorderedElementsAreArray({ExecBatchFromJSON(
+                    {int64(), utf8()},
+                    parallel ? R"([[1800, "alfa"], [1000, "beta"], [500, "gama"]])"
+                             : R"([[18, "alfa"], [10, "beta"], [5, "gama"]])")}))));
+  }
+}
+
+TEST(ExecPlanExecution, NodeMetrics) {
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "serial");
+
+    auto input = MakeGroupableBatches(/*multiplicity=*/10);
+    ExecPlanOptions plan_options;
+    plan_options.collect_trace = true;
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(plan_options));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+    ASSERT_OK_AND_ASSIGN(
+        auto sink,
+        Declaration::Sequence(
+            {
+                {"source",
+                 SourceNodeOptions{input.schema, input.gen(parallel, /*slow=*/false)}},
+                {"filter",
+                 FilterNodeOptions{greater_equal(field_ref("i32"), literal(0))}},
+                {"aggregate", AggregateNodeOptions{/*aggregates=*/{{"hash_sum", nullptr}},
+                                                   /*targets=*/{"i32"},
+                                                   /*names=*/{"sum(i32)"},
+                                                   /*keys=*/{"str"}}},
+                {"sink", SinkNodeOptions{&sink_gen}},
+            })
+            .AddToPlan(plan.get()));
+    ExecNode* aggregate = sink->inputs()[0];
+    ExecNode* filter = aggregate->inputs()[0];
+    ExecNode* source = filter->inputs()[0];
+
+    ASSERT_FINISHES_OK(StartAndCollect(plan.get(), sink_gen));
+
+    ASSERT_OK_AND_ASSIGN(auto source_metrics, plan->GetNodeMetrics(source));
+    ASSERT_EQ(source_metrics.batches_received, 0);
+    ASSERT_EQ(source_metrics.batches_emitted, 30);
+    ASSERT_EQ(source_metrics.rows_emitted, 90);
+
+    ASSERT_OK_AND_ASSIGN(auto filter_metrics, plan->GetNodeMetrics(filter));
+    ASSERT_EQ(filter_metrics.batches_received, 30);
+    ASSERT_EQ(filter_metrics.rows_received, 90);
+    ASSERT_EQ(filter_metrics.batches_emitted, 30);
+    ASSERT_EQ(filter_metrics.rows_emitted, 60);
+    ASSERT_GT(filter_metrics.wall_time_ns, 0);
+    ASSERT_GT(filter_metrics.bytes_allocated, 0);
+
+    ASSERT_OK_AND_ASSIGN(auto aggregate_metrics, plan->GetNodeMetrics(aggregate));
+    ASSERT_EQ(aggregate_metrics.rows_received, 60);
+    ASSERT_EQ(aggregate_metrics.batches_emitted, 1);
+    ASSERT_EQ(aggregate_metrics.rows_emitted, 3);
+
+    ASSERT_OK_AND_ASSIGN(auto sink_metrics, plan->GetNodeMetrics(sink));
+    ASSERT_EQ(sink_metrics.rows_received, 3);
+    ASSERT_EQ(sink_metrics.batches_emitted, 0);
+
+    ASSERT_OK_AND_ASSIGN(auto trace, plan->ToChromeTrace());
+    ASSERT_THAT(trace, HasSubstr(R"({"traceEvents":[{"name":)"));
+    ASSERT_THAT(trace, HasSubstr(R"("cat":"FilterNode","ph":"X")"));
+    ASSERT_THAT(trace, HasSubstr(R"("args":{"input_finished":true})"));
+  }
+
+  // Instrumentation is disabled by default
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(auto node, MakeExecNode("source", plan.get(), {},
+                                               SourceNodeOptions{schema({}), {}}));
+  ASSERT_RAISES(Invalid, plan->GetNodeMetrics(node));
+  ASSERT_RAISES(Invalid, plan->ToChromeTrace());
+
+  ExecPlanOptions plan_options;
+  plan_options.collect_metrics = true;
+  ASSERT_OK_AND_ASSIGN(auto other_plan, ExecPlan::Make(plan_options));
+  ASSERT_RAISES(KeyError, other_plan->GetNodeMetrics(node));
+  ASSERT_RAISES(Invalid, other_plan->ToChromeTrace());
+}
+
+TEST(ExecPlanExecution, NodeMetricsBuffersOutlivePlan) {
+  ProxyMemoryPool pool(default_memory_pool());
+  ExecContext ctx(&pool);
+  ExecPlanOptions plan_options;
+  plan_options.collect_metrics = true;
+
+  auto random_data =
+      MakeRandomBatches(schema({field("a", int32()), field("b", boolean())}), 10);
+  std::vector<ExecBatch> batches;
+  {
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(plan_options, &ctx));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+    ASSERT_OK(Declaration::Sequence(
+                  {
+                      {"source", SourceNodeOptions{random_data.schema,
+                                                   random_data.gen(/*parallel=*/false,
+                                                                   /*slow=*/false)}},
+                      {"project", ProjectNodeOptions{{call(
+                                      "add", {field_ref("a"), literal(1)})}}},
+                      {"sink", SinkNodeOptions{&sink_gen}},
+                  })
+                  .AddToPlan(plan.get()));
+    ASSERT_FINISHES_OK_AND_ASSIGN(batches, StartAndCollect(plan.get(), sink_gen));
+  }
+
+  // Buffers allocated through the plan's tracking pool may be freed after the plan
+  ASSERT_EQ(batches.size(), 10U);
+  ASSERT_GT(pool.bytes_allocated(), 0);
+  batches.clear();
+  ASSERT_EQ(pool.bytes_allocated(), 0);
+}
+
 TEST(ExecPlanExecution, SourceFilterProjectGroupedSumOrderBy) {
   for (bool parallel : {false, true}) {
     SCOPED_TRACE(parallel ? "parallel/merged" : "serial");
@@ -691,6 +989,38 @@ TEST(ExecPlanExecution, SourceScalarAggSink) {
       }))));
 }
 
+TEST(ExecPlanExecution, SourceFilterFilterScalarAggSink) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+  auto basic_data = MakeBasicBatches();
+
+  // The second filter narrows the first one's selection vector
+  ASSERT_OK(Declaration::Sequence(
+                {
+                    {"source", SourceNodeOptions{basic_data.schema,
+                                                 basic_data.gen(/*parallel=*/false,
+                                                                /*slow=*/false)}},
+                    {"filter",
+                     FilterNodeOptions{greater_equal(field_ref("i32"), literal(4))}},
+                    {"filter",
+                     FilterNodeOptions{not_equal(field_ref("i32"), literal(6))}},
+                    {"aggregate", AggregateNodeOptions{
+                                      /*aggregates=*/{{"sum", nullptr}, {"any", nullptr}},
+                                      /*targets=*/{"i32", "bool"},
+                                      /*names=*/{"sum(i32)", "any(bool)"}}},
+                    {"sink", SinkNodeOptions{&sink_gen}},
+                })
+                .AddToPlan(plan.get()));
+
+  ASSERT_THAT(
+      StartAndCollect(plan.get(), sink_gen),
+      Finishes(ResultWith(UnorderedElementsAreArray({
+          ExecBatchFromJSON({ValueDescr::Scalar(int64()), ValueDescr::Scalar(boolean())},
+                            "[[16, false]]"),
+      }))));
+}
+
 TEST(ExecPlanExecution, AggregationPreservesOptions) {
   // ARROW-13638: aggregation nodes initialize per-thread kernel state lazily
   // and need to keep a copy/strong reference to function options
@@ -40,11 +40,13 @@ namespace {
 class ProjectNode : public ExecNode {
  public:
   ProjectNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
-              std::shared_ptr<Schema> output_schema, std::vector<Expression> exprs)
+              std::shared_ptr<Schema> output_schema, std::vector<Expression> exprs,
+              CommonSubexpressions factored_exprs)
       : ExecNode(plan, std::move(inputs), /*input_labels=*/{"target"},
                  std::move(output_schema),
                  /*num_outputs=*/1),
-        exprs_(std::move(exprs)) {}
+        exprs_(std::move(exprs)),
+        factored_exprs_(std::move(factored_exprs)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -71,21 +73,32 @@ class ProjectNode : public ExecNode {
       ++i;
     }
 
+    // Evaluate subexpressions shared between the projected columns only once
+    ARROW_ASSIGN_OR_RAISE(
+        auto factored_exprs,
+        EliminateCommonSubexpressions(exprs, inputs[0]->output_schema()->num_fields()));
+
     return plan->EmplaceNode<ProjectNode>(plan, std::move(inputs),
-                                          schema(std::move(fields)), std::move(exprs));
+                                          schema(std::move(fields)), std::move(exprs),
+                                          std::move(factored_exprs));
   }
 
   const char* kind_name() const override { return "ProjectNode"; }
 
-  Result<ExecBatch> DoProject(const ExecBatch& target) {
-    std::vector<Datum> values{exprs_.size()};
-    for (size_t i = 0; i < exprs_.size(); ++i) {
-      ARROW_ASSIGN_OR_RAISE(Expression simplified_expr,
-                            SimplifyWithGuarantee(exprs_[i], target.guarantee));
+  bool accepts_selection_vector() const override { return true; }
 
-      ARROW_ASSIGN_OR_RAISE(values[i], ExecuteScalarExpression(simplified_expr, target,
-                                                               plan()->exec_context()));
+  Result<ExecBatch> DoProject(const ExecBatch& target) {
+    CommonSubexpressions simplified = factored_exprs_;
+    for (auto* group : {&simplified.common, &simplified.exprs}) {
+      for (auto& expr : *group) {
+        ARROW_ASSIGN_OR_RAISE(expr, SimplifyWithGuarantee(expr, target.guarantee));
+      }
     }
+
+    // If the target carries a selection vector, each referenced column is gathered once
+    ARROW_ASSIGN_OR_RAISE(
+        auto values,
+        ExecuteScalarExpressions(simplified, target, plan()->exec_context()));
     return ExecBatch{std::move(values), target.length};
   }
 
@@ -96,7 +109,7 @@ class ProjectNode : public ExecNode {
     if (ErrorIfNotOk(maybe_projected.status())) return;
 
     maybe_projected->guarantee = batch.guarantee;
-    outputs_[0]->InputReceived(this, maybe_projected.MoveValueUnsafe());
+    EmitBatch(outputs_[0], maybe_projected.MoveValueUnsafe());
   }
 
   void ErrorReceived(ExecNode* input, Status error) override {
@@ -106,14 +119,20 @@ class ProjectNode : public ExecNode {
 
   void InputFinished(ExecNode* input, int total_batches) override {
     DCHECK_EQ(input, inputs_[0]);
-    outputs_[0]->InputFinished(this, total_batches);
+    EmitFinished(outputs_[0], total_batches);
   }
 
   Status StartProducing() override { return Status::OK(); }
 
-  void PauseProducing(ExecNode* output) override {}
+  void PauseProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->PauseProducing(this);
+  }
 
-  void ResumeProducing(ExecNode* output) override {}
+  void ResumeProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->ResumeProducing(this);
+  }
 
   void StopProducing(ExecNode* output) override {
     DCHECK_EQ(output, outputs_[0]);
@@ -142,6 +161,8 @@ class ProjectNode : public ExecNode {
 
  private:
   std::vector<Expression> exprs_;
+  // exprs_ with their common subexpressions factored out
+  CommonSubexpressions factored_exprs_;
 };
 
 }  // namespace
@@ -44,27 +44,130 @@ using internal::checked_cast;
 namespace compute {
 namespace {
 
+// Tracks the batches queued in a sink's generator and pauses or resumes the
+// sink's input accordingly.  Shared with the generator, which may outlive the node.
+class BackpressureState {
+ public:
+  BackpressureState(BackpressureOptions options, MemoryPool* pool, ExecNode* sink)
+      : options_(std::move(options)),
+        pool_(pool),
+        sink_(sink),
+        input_(sink->inputs()[0]) {}
+
+  void BatchQueued(int64_t batch_bytes) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    queued_bytes_ += batch_bytes;
+    if (!paused_ && ShouldPause()) paused_ = true;
+    SignalInput(std::move(lock));
+  }
+
+  void BatchDequeued(int64_t batch_bytes) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    queued_bytes_ -= batch_bytes;
+    if (paused_ && ShouldResume()) paused_ = false;
+    SignalInput(std::move(lock));
+  }
+
+  // No more pause or resume requests may be sent to the input
+  void Detach() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    input_ = NULLPTR;
+  }
+
+ private:
+  bool ShouldPause() const {
+    if (options_.pause_if_above > 0 && queued_bytes_ > options_.pause_if_above) {
+      return true;
+    }
+    return options_.memory_budget > 0 && queued_bytes_ > 0 &&
+           pool_->bytes_allocated() > options_.memory_budget;
+  }
+
+  bool ShouldResume() const {
+    if (options_.pause_if_above > 0 && queued_bytes_ > options_.resume_if_below) {
+      return false;
+    }
+    // Draining the queue is all we can do to relieve the memory pool
+    return options_.memory_budget == 0 || queued_bytes_ == 0 ||
+           pool_->bytes_allocated() <= options_.memory_budget;
+  }
+
+  // Pausing or resuming the input may synchronously produce more batches, so the
+  // requests are sent without holding the lock.  A single thread sends them at a time
+  // (picking up changes made concurrently by other threads) to keep them ordered.
+  void SignalInput(std::unique_lock<std::mutex> lock) {
+    if (signalling_) return;
+    signalling_ = true;
+    while (input_ != NULLPTR && input_paused_ != paused_) {
+      ExecNode* input = input_;
+      const bool pause = input_paused_ = paused_;
+      lock.unlock();
+      if (pause) {
+        input->PauseProducing(sink_);
+      } else {
+        input->ResumeProducing(sink_);
+      }
+      lock.lock();
+    }
+    signalling_ = false;
+  }
+
+  const BackpressureOptions options_;
+  MemoryPool* pool_;
+  ExecNode* sink_;
+
+  std::mutex mutex_;
+  ExecNode* input_;
+  int64_t queued_bytes_ = 0;
+  // Whether the input should be paused
+  bool paused_ = false;
+  // Whether the input was last requested to pause
+  bool input_paused_ = false;
+  bool signalling_ = false;
+};
+
 class SinkNode : public ExecNode {
  public:
   SinkNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
-           AsyncGenerator<util::optional<ExecBatch>>* generator)
+           AsyncGenerator<util::optional<ExecBatch>>* generator,
+           BackpressureOptions backpressure = {})
       : ExecNode(plan, std::move(inputs), {"collected"}, {},
                  /*num_outputs=*/0),
-        producer_(MakeProducer(generator)) {}
+        backpressure_(MakeBackpressureState(std::move(backpressure))),
+        producer_(MakeProducer(generator, backpressure_)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
     RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "SinkNode"));
 
     const auto& sink_options = checked_cast<const SinkNodeOptions&>(options);
-    return plan->EmplaceNode<SinkNode>(plan, std::move(inputs), sink_options.generator);
+    const auto& backpressure = sink_options.backpressure;
+    if (backpressure.resume_if_below < 0 || backpressure.pause_if_above < 0 ||
+        backpressure.memory_budget < 0 ||
+        (backpressure.pause_if_above > 0 &&
+         backpressure.resume_if_below > backpressure.pause_if_above)) {
+      return Status::Invalid(
+          "Backpressure thresholds must be non-negative and resume_if_below (",
+          backpressure.resume_if_below, ") may not exceed pause_if_above (",
+          backpressure.pause_if_above, ")");
+    }
+    return plan->EmplaceNode<SinkNode>(plan, std::move(inputs), sink_options.generator,
+                                       backpressure);
+  }
+
+  std::shared_ptr<BackpressureState> MakeBackpressureState(
+      BackpressureOptions backpressure) {
+    if (!backpressure.should_apply_backpressure()) return NULLPTR;
+    return std::make_shared<BackpressureState>(
+        std::move(backpressure), plan()->exec_context()->memory_pool(), this);
   }
 
   static PushGenerator<util::optional<ExecBatch>>::Producer MakeProducer(
-      AsyncGenerator<util::optional<ExecBatch>>* out_gen) {
+      AsyncGenerator<util::optional<ExecBatch>>* out_gen,
+      std::shared_ptr<BackpressureState> backpressure = NULLPTR) {
     PushGenerator<util::optional<ExecBatch>> push_gen;
     auto out = push_gen.producer();
-    *out_gen = [push_gen] {
+    *out_gen = [push_gen, backpressure] {
       // Awful workaround for MSVC 19.0 (Visual Studio 2015) bug.
       // For some types including Future<optional<ExecBatch>>,
       // std::is_convertible<T, T>::value will be false causing
@@ -78,7 +181,16 @@ class SinkNode : public ExecNode {
         Future<util::optional<ExecBatch>> ret;
       };
 
-      return ConvertibleToFuture{push_gen()};
+      auto next = push_gen();
+      if (backpressure) {
+        next.AddCallback(
+            [backpressure](const Result<util::optional<ExecBatch>>& maybe_batch) {
+              if (maybe_batch.ok() && *maybe_batch) {
+                backpressure->BatchDequeued((*maybe_batch)->TotalBufferSize());
+              }
+            });
+      }
+      return ConvertibleToFuture{std::move(next)};
     };
     return out;
   }
@@ -108,9 +220,14 @@ class SinkNode : public ExecNode {
   void InputReceived(ExecNode* input, ExecBatch batch) override {
     DCHECK_EQ(input, inputs_[0]);
 
+    const int64_t batch_bytes = backpressure_ ? batch.TotalBufferSize() : 0;
     bool did_push = producer_.Push(std::move(batch));
     if (!did_push) return;  // producer_ was Closed already
 
+    // The batch may have been dequeued already, in which case the queued byte count
+    // is briefly negative; this only delays pausing.
+    if (backpressure_) backpressure_->BatchQueued(batch_bytes);
+
     if (input_counter_.Increment()) {
       Finish();
     }
@@ -135,6 +252,7 @@ class SinkNode : public ExecNode {
 
  protected:
   virtual void Finish() {
+    if (backpressure_) backpressure_->Detach();
     if (producer_.Close()) {
       finished_.MarkFinished();
     }
@@ -143,6 +261,7 @@ class SinkNode : public ExecNode {
   AtomicCounter input_counter_;
   Future<> finished_ = Future<>::MakeFinished();
 
+  std::shared_ptr<BackpressureState> backpressure_;
   PushGenerator<util::optional<ExecBatch>>::Producer producer_;
 };
 
@@ -87,7 +87,7 @@ struct SourceNode : ExecNode {
                   }
                   lock.unlock();
 
-                  return generator_().Then(
+                  return NextBatch().Then(
                       [=](const util::optional<ExecBatch>& batch) -> ControlFlow<int> {
                         std::unique_lock<std::mutex> lock(mutex_);
                         if (IsIterationEnd(batch) || stop_requested_) {
@@ -98,7 +98,7 @@ struct SourceNode : ExecNode {
 
                         if (executor) {
                           auto maybe_future = executor->Submit([=]() {
-                            outputs_[0]->InputReceived(this, *batch);
+                            EmitBatch(outputs_[0], *batch);
                             return Status::OK();
                           });
                           if (!maybe_future.ok()) {
@@ -112,7 +112,7 @@ struct SourceNode : ExecNode {
                             return Break(total_batches);
                           }
                         } else {
-                          outputs_[0]->InputReceived(this, *batch);
+                          EmitBatch(outputs_[0], *batch);
                         }
                         return Continue();
                       },
@@ -130,16 +130,25 @@ struct SourceNode : ExecNode {
                       },
                       options);
                 }).Then([&](int total_batches) {
-      outputs_[0]->InputFinished(this, total_batches);
+      EmitFinished(outputs_[0], total_batches);
       return task_group_.WaitForTasksToFinish();
     });
 
     return Status::OK();
   }
 
-  void PauseProducing(ExecNode* output) override {}
+  void PauseProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (backpressure_future_.is_finished()) {
+      backpressure_future_ = Future<>::Make();
+    }
+  }
 
-  void ResumeProducing(ExecNode* output) override {}
+  void ResumeProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    Resume();
+  }
 
   void StopProducing(ExecNode* output) override {
     DCHECK_EQ(output, outputs_[0]);
@@ -147,15 +156,57 @@ struct SourceNode : ExecNode {
   }
 
   void StopProducing() override {
-    std::unique_lock<std::mutex> lock(mutex_);
-    stop_requested_ = true;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      stop_requested_ = true;
+    }
+    // A paused loop must wake up to notice the stop request
+    Resume();
   }
 
   Future<> finished() override { return finished_; }
 
  private:
+  // Pull the next batch from the generator once our output isn't paused
+  Future<util::optional<ExecBatch>> NextBatch() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto backpressure = backpressure_future_;
+    lock.unlock();
+
+    // Don't continue on the thread resuming us: it may be the consumer of our output
+    CallbackOptions options;
+    if (auto executor = plan()->exec_context()->executor()) {
+      options.executor = executor;
+      options.should_schedule = ShouldSchedule::IfUnfinished;
+    }
+    return backpressure.Then(
+        [this]() -> Future<util::optional<ExecBatch>> {
+          std::unique_lock<std::mutex> lock(mutex_);
+          if (stop_requested_) {
+            return AsyncGeneratorEnd<util::optional<ExecBatch>>();
+          }
+          lock.unlock();
+          return generator_();
+        },
+        {}, options);
+  }
+
+  void Resume() {
+    Future<> to_finish;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (backpressure_future_.is_finished()) return;
+      to_finish = std::move(backpressure_future_);
+      backpressure_future_ = Future<>::MakeFinished();
+    }
+    // Finished outside of the lock since this continues the pulling loop
+    to_finish.MarkFinished();
+  }
+
   std::mutex mutex_;
   bool stop_requested_{false};
+  // Unfinished while our output is paused
+  Future<> backpressure_future_ = Future<>::MakeFinished();
   int batch_count_{0};
   Future<> finished_ = Future<>::MakeFinished();
   util::AsyncTaskGroup task_group_;
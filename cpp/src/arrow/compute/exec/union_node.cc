@@ -80,7 +80,7 @@ class UnionNode : public ExecNode {
     if (finished_.is_finished()) {
       return;
     }
-    outputs_[0]->InputReceived(this, std::move(batch));
+    EmitBatch(outputs_[0], std::move(batch));
     if (batch_count_.Increment()) {
       finished_.MarkFinished();
     }
@@ -99,7 +99,7 @@ class UnionNode : public ExecNode {
     total_batches_.fetch_add(total_batches);
 
     if (input_count_.Increment()) {
-      outputs_[0]->InputFinished(this, total_batches_.load());
+      EmitFinished(outputs_[0], total_batches_.load());
       if (batch_count_.SetTotal(total_batches_.load())) {
         finished_.MarkFinished();
       }
@@ -111,9 +111,19 @@ class UnionNode : public ExecNode {
     return Status::OK();
   }
 
-  void PauseProducing(ExecNode* output) override {}
+  void PauseProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    for (auto&& input : inputs_) {
+      input->PauseProducing(this);
+    }
+  }
 
-  void ResumeProducing(ExecNode* output) override {}
+  void ResumeProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    for (auto&& input : inputs_) {
+      input->ResumeProducing(this);
+    }
+  }
 
   void StopProducing(ExecNode* output) override {
     DCHECK_EQ(output, outputs_[0]);
@@ -0,0 +1,617 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec/exec_plan.h"
+
+#include <mutex>
+#include <sstream>
+
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/int_util_internal.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/unreachable.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace {
+
+enum class WindowFunctionKind {
+  ROW_NUMBER,
+  RANK,
+  DENSE_RANK,
+  CUMULATIVE_SUM,
+  LAG,
+  LEAD,
+};
+
+Result<WindowFunctionKind> GetWindowFunctionKind(const std::string& name) {
+  if (name == "row_number") return WindowFunctionKind::ROW_NUMBER;
+  if (name == "rank") return WindowFunctionKind::RANK;
+  if (name == "dense_rank") return WindowFunctionKind::DENSE_RANK;
+  if (name == "cumulative_sum") return WindowFunctionKind::CUMULATIVE_SUM;
+  if (name == "lag") return WindowFunctionKind::LAG;
+  if (name == "lead") return WindowFunctionKind::LEAD;
+  return Status::Invalid("Unknown window function '", name, "'");
+}
+
+bool HasTarget(WindowFunctionKind kind) {
+  return kind == WindowFunctionKind::CUMULATIVE_SUM || kind == WindowFunctionKind::LAG ||
+         kind == WindowFunctionKind::LEAD;
+}
+
+// The type in which cumulative sums of the given type are accumulated,
+// like the "sum" aggregate function.
+Result<std::shared_ptr<DataType>> CumulativeSumType(const DataType& type) {
+  if (is_signed_integer(type.id())) return int64();
+  if (is_unsigned_integer(type.id())) return uint64();
+  if (is_floating(type.id())) return float64();
+  return Status::TypeError("cumulative_sum is not implemented for type ", type);
+}
+
+// Partition and peer boundaries of rows in sorted order.  Two consecutive
+// rows are peers if they have equal sort keys within the same partition.
+struct WindowFrames {
+  bool NewPartition(int64_t i) const {
+    return i == 0 ||
+           (partition_ids != nullptr && partition_ids[i] != partition_ids[i - 1]);
+  }
+
+  bool NewPeerGroup(int64_t i) const {
+    return i == 0 || peer_ids[i] != peer_ids[i - 1];
+  }
+
+  bool SamePartition(int64_t i, int64_t j) const {
+    return partition_ids == nullptr || partition_ids[i] == partition_ids[j];
+  }
+
+  int64_t length;
+  const uint32_t* partition_ids;
+  const uint32_t* peer_ids;
+};
+
+class WindowNode : public ExecNode {
+ public:
+  WindowNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+             std::shared_ptr<Schema> output_schema, std::vector<WindowFunction> functions,
+             std::vector<WindowFunctionKind> kinds, std::vector<int> target_field_ids,
+             std::vector<int> partition_field_ids, std::vector<SortKey> sort_keys)
+      : ExecNode(plan, std::move(inputs), {"target"}, std::move(output_schema),
+                 /*num_outputs=*/1),
+        ctx_(plan->exec_context()),
+        functions_(std::move(functions)),
+        kinds_(std::move(kinds)),
+        target_field_ids_(std::move(target_field_ids)),
+        partition_field_ids_(std::move(partition_field_ids)),
+        sort_keys_(std::move(sort_keys)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "WindowNode"));
+
+    const auto& window_options = checked_cast<const WindowNodeOptions&>(options);
+    const auto& functions = window_options.functions;
+    if (window_options.targets.size() != functions.size() ||
+        window_options.names.size() != functions.size()) {
+      return Status::Invalid("WindowNode expects one target and one name per function");
+    }
+
+    auto input_schema = inputs[0]->output_schema();
+
+    // Find input field indices for partition keys
+    std::vector<int> partition_field_ids(window_options.partition_keys.size());
+    for (size_t i = 0; i < partition_field_ids.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto match,
+                            window_options.partition_keys[i].FindOne(*input_schema));
+      partition_field_ids[i] = match[0];
+    }
+
+    for (const auto& sort_key : window_options.sort_keys) {
+      RETURN_NOT_OK(FieldRef(sort_key.name).FindOne(*input_schema));
+    }
+
+    // Resolve window functions and build the output schema
+    FieldVector output_fields = input_schema->fields();
+    std::vector<WindowFunctionKind> kinds(functions.size());
+    std::vector<int> target_field_ids(functions.size(), -1);
+    for (size_t i = 0; i < functions.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(kinds[i], GetWindowFunctionKind(functions[i].function));
+
+      std::shared_ptr<DataType> out_type = int64();
+      if (HasTarget(kinds[i])) {
+        ARROW_ASSIGN_OR_RAISE(auto match,
+                              window_options.targets[i].FindOne(*input_schema));
+        target_field_ids[i] = match[0];
+        out_type = input_schema->field(target_field_ids[i])->type();
+      }
+      if (kinds[i] == WindowFunctionKind::CUMULATIVE_SUM) {
+        ARROW_ASSIGN_OR_RAISE(out_type, CumulativeSumType(*out_type));
+      }
+      if ((kinds[i] == WindowFunctionKind::LAG || kinds[i] == WindowFunctionKind::LEAD) &&
+          functions[i].offset < 0) {
+        return Status::Invalid("Offset of window function '", functions[i].function,
+                               "' must be non-negative, got ", functions[i].offset);
+      }
+      output_fields.push_back(field(window_options.names[i], std::move(out_type)));
+    }
+
+    return plan->EmplaceNode<WindowNode>(
+        plan, std::move(inputs), schema(std::move(output_fields)), functions,
+        std::move(kinds), std::move(target_field_ids), std::move(partition_field_ids),
+        window_options.sort_keys);
+  }
+
+  const char* kind_name() const override { return "WindowNode"; }
+
+  void InputReceived(ExecNode* input, ExecBatch batch) override {
+    // bail if StopProducing was called
+    if (finished_.is_finished()) return;
+
+    DCHECK_EQ(input, inputs_[0]);
+
+    // Accumulate data
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto maybe_batch =
+          batch.ToRecordBatch(inputs_[0]->output_schema(), ctx_->memory_pool());
+      if (ErrorIfNotOk(maybe_batch.status())) return;
+      batches_.push_back(maybe_batch.MoveValueUnsafe());
+    }
+
+    if (input_counter_.Increment()) {
+      ErrorIfNotOk(OutputResult());
+    }
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK_EQ(input, inputs_[0]);
+
+    outputs_[0]->ErrorReceived(this, std::move(error));
+  }
+
+  void InputFinished(ExecNode* input, int total_batches) override {
+    // bail if StopProducing was called
+    if (finished_.is_finished()) return;
+
+    DCHECK_EQ(input, inputs_[0]);
+
+    if (input_counter_.SetTotal(total_batches)) {
+      ErrorIfNotOk(OutputResult());
+    }
+  }
+
+  Status StartProducing() override {
+    finished_ = Future<>::Make();
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->PauseProducing(this);
+  }
+
+  void ResumeProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->ResumeProducing(this);
+  }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+
+    if (input_counter_.Cancel()) {
+      finished_.MarkFinished();
+    } else if (output_counter_.Cancel()) {
+      finished_.MarkFinished();
+    }
+    inputs_[0]->StopProducing(this);
+  }
+
+  void StopProducing() override { StopProducing(outputs_[0]); }
+
+  Future<> finished() override { return finished_; }
+
+ protected:
+  std::string ToStringExtra() const override {
+    std::stringstream ss;
+    const auto input_schema = inputs_[0]->output_schema();
+    ss << "partition_keys=[";
+    for (size_t i = 0; i < partition_field_ids_.size(); i++) {
+      if (i > 0) ss << ", ";
+      ss << '"' << input_schema->field(partition_field_ids_[i])->name() << '"';
+    }
+    ss << "], sort_keys=[";
+    for (size_t i = 0; i < sort_keys_.size(); i++) {
+      if (i > 0) ss << ", ";
+      ss << sort_keys_[i].ToString();
+    }
+    ss << "], functions=[";
+    for (size_t i = 0; i < functions_.size(); i++) {
+      if (i > 0) ss << ", ";
+      ss << functions_[i].function << "(";
+      if (target_field_ids_[i] >= 0) {
+        ss << input_schema->field(target_field_ids_[i])->name();
+      }
+      ss << ")";
+    }
+    ss << "]";
+    return ss.str();
+  }
+
+ private:
+  // Assign an id to each row of the table, such that rows with equal values
+  // in all of the given fields have equal ids.
+  Result<std::shared_ptr<ChunkedArray>> GroupIds(const Table& table,
+                                                 const std::vector<int>& field_ids) {
+    std::vector<ValueDescr> descrs;
+    for (int field_id : field_ids) {
+      descrs.emplace_back(table.schema()->field(field_id)->type(), ValueDescr::ARRAY);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto grouper, internal::Grouper::Make(descrs, ctx_));
+
+    TableBatchReader reader(table);
+    ArrayVector ids;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (!batch) break;
+      std::vector<Datum> keys;
+      for (int field_id : field_ids) {
+        keys.emplace_back(batch->column(field_id));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto key_batch, ExecBatch::Make(std::move(keys)));
+      ARROW_ASSIGN_OR_RAISE(Datum batch_ids, grouper->Consume(key_batch));
+      ids.push_back(batch_ids.make_array());
+    }
+    return std::make_shared<ChunkedArray>(std::move(ids), uint32());
+  }
+
+  // Sort rows by partition then by sort keys, and compute the frames of the
+  // sorted rows.
+  Result<std::shared_ptr<Table>> SortInput(const Table& input,
+                                           std::shared_ptr<ArrayData>* partition_ids,
+                                           std::shared_ptr<ArrayData>* peer_ids) {
+    const auto& input_schema = *input.schema();
+
+    FieldVector sort_fields;
+    ChunkedArrayVector sort_columns;
+    std::vector<SortKey> sort_keys;
+    std::shared_ptr<ChunkedArray> unsorted_partition_ids;
+    if (!partition_field_ids_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(unsorted_partition_ids,
+                            GroupIds(input, partition_field_ids_));
+    }
+    // Order partitions by their keys, so that the output doesn't depend on the
+    // order in which input batches arrived
+    for (size_t i = 0; i < partition_field_ids_.size(); ++i) {
+      const int field_id = partition_field_ids_[i];
+      auto name = "partition_key_" + std::to_string(i);
+      sort_fields.push_back(field(name, input_schema.field(field_id)->type()));
+      sort_columns.push_back(input.column(field_id));
+      sort_keys.emplace_back(std::move(name));
+    }
+
+    // Peers share partition keys and sort keys
+    std::vector<int> peer_field_ids = partition_field_ids_;
+    for (size_t i = 0; i < sort_keys_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto match,
+                            FieldRef(sort_keys_[i].name).FindOne(input_schema));
+      peer_field_ids.push_back(match[0]);
+
+      auto name = "sort_key_" + std::to_string(i);
+      sort_fields.push_back(field(name, input_schema.field(match[0])->type()));
+      sort_columns.push_back(input.column(match[0]));
+      sort_keys.emplace_back(std::move(name), sort_keys_[i].order);
+    }
+    std::shared_ptr<ChunkedArray> unsorted_peer_ids;
+    if (peer_field_ids.empty()) {
+      // A single partition of peers
+      ARROW_ASSIGN_OR_RAISE(
+          auto zeros, MakeArrayFromScalar(UInt32Scalar(0), input.num_rows(),
+                                          ctx_->memory_pool()));
+      unsorted_peer_ids = std::make_shared<ChunkedArray>(std::move(zeros));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(unsorted_peer_ids, GroupIds(input, peer_field_ids));
+    }
+
+    std::shared_ptr<Table> sorted = input.Slice(0);
+    if (!sort_keys.empty()) {
+      auto sort_table =
+          Table::Make(schema(std::move(sort_fields)), std::move(sort_columns),
+                      input.num_rows());
+      ARROW_ASSIGN_OR_RAISE(
+          auto indices, SortIndices(Datum(sort_table), SortOptions(sort_keys), ctx_));
+      ARROW_ASSIGN_OR_RAISE(Datum taken, Take(Datum(input.Slice(0)), Datum(indices),
+                                              TakeOptions::NoBoundsCheck(), ctx_));
+      sorted = taken.table();
+      if (unsorted_partition_ids) {
+        ARROW_ASSIGN_OR_RAISE(taken, Take(Datum(unsorted_partition_ids), Datum(indices),
+                                          TakeOptions::NoBoundsCheck(), ctx_));
+        unsorted_partition_ids = taken.chunked_array();
+      }
+      ARROW_ASSIGN_OR_RAISE(taken, Take(Datum(unsorted_peer_ids), Datum(indices),
+                                        TakeOptions::NoBoundsCheck(), ctx_));
+      unsorted_peer_ids = taken.chunked_array();
+    }
+
+    if (unsorted_partition_ids) {
+      ARROW_ASSIGN_OR_RAISE(auto ids, MakeContiguous(*unsorted_partition_ids));
+      *partition_ids = ids->data();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto ids, MakeContiguous(*unsorted_peer_ids));
+    *peer_ids = ids->data();
+    return sorted;
+  }
+
+  Result<std::shared_ptr<Array>> MakeContiguous(const ChunkedArray& chunked_array) {
+    if (chunked_array.num_chunks() == 1) {
+      return chunked_array.chunk(0);
+    }
+    if (chunked_array.num_chunks() == 0) {
+      return MakeArrayOfNull(chunked_array.type(), 0, ctx_->memory_pool());
+    }
+    return Concatenate(chunked_array.chunks(), ctx_->memory_pool());
+  }
+
+  Result<std::shared_ptr<Array>> RowNumbers(const WindowFrames& frames) {
+    Int64Builder builder(ctx_->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(frames.length));
+    int64_t row_number = 0;
+    for (int64_t i = 0; i < frames.length; ++i) {
+      row_number = frames.NewPartition(i) ? 1 : row_number + 1;
+      builder.UnsafeAppend(row_number);
+    }
+    return builder.Finish();
+  }
+
+  Result<std::shared_ptr<Array>> Ranks(const WindowFrames& frames, bool dense) {
+    Int64Builder builder(ctx_->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(frames.length));
+    int64_t row_number = 0, rank = 0;
+    for (int64_t i = 0; i < frames.length; ++i) {
+      if (frames.NewPartition(i)) {
+        row_number = rank = 1;
+      } else {
+        ++row_number;
+        if (frames.NewPeerGroup(i)) {
+          rank = dense ? rank + 1 : row_number;
+        }
+      }
+      builder.UnsafeAppend(rank);
+    }
+    return builder.Finish();
+  }
+
+  // Add `value` to `*sum`, returning false if an integer sum overflows
+  template <typename CType>
+  static enable_if_t<std::is_integral<CType>::value, bool> Accumulate(CType value,
+                                                                     CType* sum) {
+    return !::arrow::internal::AddWithOverflow(*sum, value, sum);
+  }
+
+  template <typename CType>
+  static enable_if_t<std::is_floating_point<CType>::value, bool> Accumulate(
+      CType value, CType* sum) {
+    *sum += value;
+    return true;
+  }
+
+  template <typename Type>
+  Result<std::shared_ptr<Array>> CumulativeSum(const WindowFrames& frames,
+                                               const Array& values) {
+    using c_type = typename Type::c_type;
+    const auto& typed_values = checked_cast<const NumericArray<Type>&>(values);
+
+    NumericBuilder<Type> builder(ctx_->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(frames.length));
+    c_type sum = 0;
+    bool any_valid = false;
+    for (int64_t i = 0; i < frames.length; ++i) {
+      if (frames.NewPartition(i)) {
+        sum = 0;
+        any_valid = false;
+      }
+      // Nulls are skipped; the sum is null until a non-null value is seen
+      if (typed_values.IsValid(i)) {
+        if (ARROW_PREDICT_FALSE(!Accumulate(typed_values.Value(i), &sum))) {
+          return Status::Invalid("overflow");
+        }
+        any_valid = true;
+      }
+      if (any_valid) {
+        builder.UnsafeAppend(sum);
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    return builder.Finish();
+  }
+
+  Result<std::shared_ptr<Array>> CumulativeSum(const WindowFrames& frames,
+                                               const std::shared_ptr<Array>& values) {
+    ARROW_ASSIGN_OR_RAISE(auto sum_type, CumulativeSumType(*values->type()));
+    ARROW_ASSIGN_OR_RAISE(auto cast_values,
+                          Cast(*values, sum_type, CastOptions::Safe(), ctx_));
+    switch (sum_type->id()) {
+      case Type::INT64:
+        return CumulativeSum<Int64Type>(frames, *cast_values);
+      case Type::UINT64:
+        return CumulativeSum<UInt64Type>(frames, *cast_values);
+      default:
+        return CumulativeSum<DoubleType>(frames, *cast_values);
+    }
+  }
+
+  // Take the value `offset` rows before (or after) in the same partition
+  Result<std::shared_ptr<Array>> Shift(const WindowFrames& frames,
+                                       const std::shared_ptr<Array>& values,
+                                       int64_t offset) {
+    Int64Builder builder(ctx_->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(frames.length));
+    for (int64_t i = 0; i < frames.length; ++i) {
+      const int64_t j = i + offset;
+      if (j >= 0 && j < frames.length && frames.SamePartition(i, j)) {
+        builder.UnsafeAppend(j);
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto indices, builder.Finish());
+    return Take(*values, *indices, TakeOptions::NoBoundsCheck(), ctx_);
+  }
+
+  Result<std::shared_ptr<Array>> EvaluateFunction(size_t i, const WindowFrames& frames,
+                                                  const std::shared_ptr<Array>& target) {
+    switch (kinds_[i]) {
+      case WindowFunctionKind::ROW_NUMBER:
+        return RowNumbers(frames);
+      case WindowFunctionKind::RANK:
+        return Ranks(frames, /*dense=*/false);
+      case WindowFunctionKind::DENSE_RANK:
+        return Ranks(frames, /*dense=*/true);
+      case WindowFunctionKind::CUMULATIVE_SUM:
+        return CumulativeSum(frames, target);
+      case WindowFunctionKind::LAG:
+        return Shift(frames, target, -functions_[i].offset);
+      case WindowFunctionKind::LEAD:
+        return Shift(frames, target, functions_[i].offset);
+    }
+    Unreachable("unknown window function kind");
+  }
+
+  Result<std::shared_ptr<Table>> Evaluate() {
+    std::shared_ptr<Table> input;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ARROW_ASSIGN_OR_RAISE(input, Table::FromRecordBatches(inputs_[0]->output_schema(),
+                                                            std::move(batches_)));
+    }
+
+    std::shared_ptr<ArrayData> partition_ids, peer_ids;
+    ARROW_ASSIGN_OR_RAISE(auto sorted, SortInput(*input, &partition_ids, &peer_ids));
+
+    WindowFrames frames;
+    frames.length = sorted->num_rows();
+    frames.partition_ids =
+        partition_ids ? partition_ids->GetValues<uint32_t>(1) : nullptr;
+    frames.peer_ids = peer_ids->GetValues<uint32_t>(1);
+
+    ChunkedArrayVector columns = sorted->columns();
+    for (size_t i = 0; i < functions_.size(); ++i) {
+      std::shared_ptr<Array> target;
+      if (target_field_ids_[i] >= 0) {
+        ARROW_ASSIGN_OR_RAISE(target,
+                              MakeContiguous(*sorted->column(target_field_ids_[i])));
+      }
+
+      ARROW_ASSIGN_OR_RAISE(auto result, EvaluateFunction(i, frames, target));
+      columns.push_back(std::make_shared<ChunkedArray>(std::move(result)));
+    }
+    return Table::Make(output_schema_, std::move(columns), frames.length);
+  }
+
+  Status OutputResult() {
+    ARROW_ASSIGN_OR_RAISE(auto out_table, Evaluate());
+
+    TableBatchReader reader(*out_table);
+    reader.set_chunksize(output_batch_size());
+    RETURN_NOT_OK(reader.ReadAll(&out_batches_));
+
+    int num_output_batches = static_cast<int>(out_batches_.size());
+    EmitFinished(outputs_[0], num_output_batches);
+    if (output_counter_.SetTotal(num_output_batches)) {
+      // this will be hit if there are no output batches
+      finished_.MarkFinished();
+    }
+
+    auto executor = ctx_->executor();
+    for (int i = 0; i < num_output_batches; ++i) {
+      if (executor) {
+        // bail if StopProducing was called
+        if (finished_.is_finished()) break;
+
+        auto plan = this->plan()->shared_from_this();
+        RETURN_NOT_OK(executor->Spawn([plan, this, i] { OutputNthBatch(i); }));
+      } else {
+        OutputNthBatch(i);
+      }
+    }
+    return Status::OK();
+  }
+
+  void OutputNthBatch(int n) {
+    // bail if StopProducing was called
+    if (finished_.is_finished()) return;
+
+    EmitBatch(outputs_[0], ExecBatch(*out_batches_[n]));
+
+    if (output_counter_.Increment()) {
+      finished_.MarkFinished();
+    }
+  }
+
+  int output_batch_size() const {
+    int result = static_cast<int>(ctx_->exec_chunksize());
+    if (result < 0) {
+      result = 32 * 1024;
+    }
+    return result;
+  }
+
+  ExecContext* ctx_;
+  Future<> finished_ = Future<>::MakeFinished();
+
+  const std::vector<WindowFunction> functions_;
+  const std::vector<WindowFunctionKind> kinds_;
+  // -1 for functions without a target
+  const std::vector<int> target_field_ids_;
+  const std::vector<int> partition_field_ids_;
+  const std::vector<SortKey> sort_keys_;
+
+  AtomicCounter input_counter_, output_counter_;
+
+  std::mutex mutex_;
+  RecordBatchVector batches_;
+  RecordBatchVector out_batches_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterWindowNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory("window", WindowNode::Make));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
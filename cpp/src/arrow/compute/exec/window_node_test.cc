@@ -0,0 +1,225 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/api.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/matchers.h"
+
+using testing::ElementsAreArray;
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+BatchesWithSchema MakeWindowBatches(int multiplicity = 1) {
+  BatchesWithSchema out;
+
+  out.batches = {ExecBatchFromJSON({int32(), utf8()}, R"([
+                   [12, "alfa"],
+                   [7,  "beta"],
+                   [3,  "alfa"]
+                 ])"),
+                 ExecBatchFromJSON({int32(), utf8()}, R"([
+                   [-2, "alfa"],
+                   [-1, "gama"],
+                   [3,  "alfa"]
+                 ])"),
+                 ExecBatchFromJSON({int32(), utf8()}, R"([
+                   [5,  "gama"],
+                   [null, "beta"],
+                   [-8, "alfa"]
+                 ])")};
+
+  size_t batch_count = out.batches.size();
+  for (int repeat = 1; repeat < multiplicity; ++repeat) {
+    for (size_t i = 0; i < batch_count; ++i) {
+      out.batches.push_back(out.batches[i]);
+    }
+  }
+
+  out.schema = schema({field("i32", int32()), field("str", utf8())});
+
+  return out;
+}
+
+Result<std::shared_ptr<Table>> RunWindowPlan(const BatchesWithSchema& input,
+                                             WindowNodeOptions options, bool parallel) {
+  ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto sink,
+      Declaration::Sequence(
+          {
+              {"source",
+               SourceNodeOptions{input.schema, input.gen(parallel, /*slow=*/false)}},
+              {"window", std::move(options)},
+              {"sink", SinkNodeOptions{&sink_gen}},
+          })
+          .AddToPlan(plan.get()));
+
+  auto output_schema = sink->inputs()[0]->output_schema();
+  auto collected = StartAndCollect(plan.get(), sink_gen);
+  ARROW_ASSIGN_OR_RAISE(auto batches, collected.result());
+  RecordBatchVector record_batches;
+  for (const auto& batch : batches) {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch, batch.ToRecordBatch(output_schema));
+    record_batches.push_back(std::move(record_batch));
+  }
+  return Table::FromRecordBatches(output_schema, std::move(record_batches));
+}
+
+}  // namespace
+
+TEST(WindowNode, PartitionedFunctions) {
+  auto input = MakeWindowBatches();
+
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+  ASSERT_OK(Declaration::Sequence(
+                {
+                    {"source", SourceNodeOptions{input.schema,
+                                                 input.gen(/*parallel=*/false,
+                                                           /*slow=*/false)}},
+                    {"window", WindowNodeOptions{/*functions=*/{"row_number", "rank",
+                                                                "dense_rank",
+                                                                "cumulative_sum", "lag",
+                                                                {"lead", 2}},
+                                                 /*targets=*/{"", "", "", "i32", "i32",
+                                                              "i32"},
+                                                 /*names=*/{"row_number", "rank",
+                                                            "dense_rank", "sum", "lag",
+                                                            "lead"},
+                                                 /*partition_keys=*/{"str"},
+                                                 /*sort_keys=*/{SortKey("i32")}}},
+                    {"sink", SinkNodeOptions{&sink_gen}},
+                })
+                .AddToPlan(plan.get()));
+
+  // Partitions are ordered by partition keys, nulls are sorted at the end
+  ASSERT_THAT(StartAndCollect(plan.get(), sink_gen),
+              Finishes(ResultWith(ElementsAreArray({ExecBatchFromJSON(
+                  {int32(), utf8(), int64(), int64(), int64(), int64(), int32(),
+                   int32()},
+                  R"([
+                    [-8,   "alfa", 1, 1, 1, -8,   null, 3],
+                    [-2,   "alfa", 2, 2, 2, -10,  -8,   3],
+                    [3,    "alfa", 3, 3, 3, -7,   -2,   12],
+                    [3,    "alfa", 4, 3, 3, -4,   3,    null],
+                    [12,   "alfa", 5, 5, 4, 8,    3,    null],
+                    [7,    "beta", 1, 1, 1, 7,    null, null],
+                    [null, "beta", 2, 2, 2, 7,    7,    null],
+                    [-1,   "gama", 1, 1, 1, -1,   null, null],
+                    [5,    "gama", 2, 2, 2, 4,    -1,   null]
+                  ])")}))));
+}
+
+TEST(WindowNode, NoPartitions) {
+  auto input = MakeWindowBatches();
+  WindowNodeOptions options{/*functions=*/{"rank", "cumulative_sum"},
+                            /*targets=*/{"", "i32"},
+                            /*names=*/{"rank", "sum"},
+                            /*partition_keys=*/{},
+                            /*sort_keys=*/{SortKey("str", SortOrder::Descending),
+                                           SortKey("i32")}};
+
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+  ASSERT_OK(Declaration::Sequence(
+                {
+                    {"source", SourceNodeOptions{input.schema,
+                                                 input.gen(/*parallel=*/false,
+                                                           /*slow=*/false)}},
+                    {"window", std::move(options)},
+                    {"sink", SinkNodeOptions{&sink_gen}},
+                })
+                .AddToPlan(plan.get()));
+
+  ASSERT_THAT(StartAndCollect(plan.get(), sink_gen),
+              Finishes(ResultWith(ElementsAreArray({ExecBatchFromJSON(
+                  {int32(), utf8(), int64(), int64()},
+                  R"([
+                    [-1,   "gama", 1, -1],
+                    [5,    "gama", 2, 4],
+                    [7,    "beta", 3, 11],
+                    [null, "beta", 4, 11],
+                    [-8,   "alfa", 5, 3],
+                    [-2,   "alfa", 6, 1],
+                    [3,    "alfa", 7, 4],
+                    [3,    "alfa", 7, 7],
+                    [12,   "alfa", 9, 19]
+                  ])")}))));
+}
+
+TEST(WindowNode, Parallel) {
+  auto input = MakeWindowBatches(/*multiplicity=*/100);
+  WindowNodeOptions options{/*functions=*/{"dense_rank", "cumulative_sum"},
+                            /*targets=*/{"", "i32"},
+                            /*names=*/{"dense_rank", "sum"},
+                            /*partition_keys=*/{"str"},
+                            /*sort_keys=*/{SortKey("i32")}};
+
+  ASSERT_OK_AND_ASSIGN(auto serial, RunWindowPlan(input, options, /*parallel=*/false));
+  ASSERT_OK_AND_ASSIGN(auto parallel, RunWindowPlan(input, options, /*parallel=*/true));
+  ASSERT_EQ(serial->num_rows(), 900);
+
+  // Rows are only reordered among identical rows, so the output is the same
+  AssertTablesEqual(*serial, *parallel, /*same_chunk_layout=*/false);
+}
+
+TEST(WindowNode, CumulativeSumOverflow) {
+  BatchesWithSchema input;
+  input.schema = schema({field("i64", int64())});
+  input.batches = {ExecBatchFromJSON({int64()}, "[[9223372036854775807], [1]]")};
+
+  WindowNodeOptions options{{"cumulative_sum"}, {"i64"}, {"x"}};
+
+  ASSERT_RAISES(Invalid, RunWindowPlan(input, options, /*parallel=*/false));
+}
+
+TEST(WindowNode, Errors) {
+  auto input = MakeWindowBatches();
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(auto source,
+                       MakeExecNode("source", plan.get(), {},
+                                    SourceNodeOptions{input.schema,
+                                                      input.gen(/*parallel=*/false,
+                                                                /*slow=*/false)}));
+
+  ASSERT_RAISES(Invalid, MakeExecNode("window", plan.get(), {source},
+                                      WindowNodeOptions{{"percent_rank"}, {""}, {"x"}}));
+  ASSERT_RAISES(Invalid,
+                MakeExecNode("window", plan.get(), {source},
+                             WindowNodeOptions{{"rank", "rank"}, {"", ""}, {"x"}}));
+  ASSERT_RAISES(TypeError,
+                MakeExecNode("window", plan.get(), {source},
+                             WindowNodeOptions{{"cumulative_sum"}, {"str"}, {"x"}}));
+  ASSERT_RAISES(Invalid,
+                MakeExecNode("window", plan.get(), {source},
+                             WindowNodeOptions{{{"lag", -1}}, {"i32"}, {"x"}}));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -90,6 +90,60 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, null, true, true, false]");
+  const auto& bool_mask = checked_cast<const BooleanArray&>(*mask);
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(bool_mask));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 4]"), *MakeArray(sel_vector->data()));
+
+  auto sliced_mask = mask->Slice(1);
+  ASSERT_OK_AND_ASSIGN(sel_vector, SelectionVector::FromMask(
+                                       checked_cast<const BooleanArray&>(*sliced_mask)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 3]"), *MakeArray(sel_vector->data()));
+
+  // Narrow an existing selection
+  auto narrow_mask = ArrayFromJSON(boolean(), "[false, true]");
+  ASSERT_OK_AND_ASSIGN(
+      auto narrowed, sel_vector->Filter(checked_cast<const BooleanArray&>(*narrow_mask)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[3]"), *MakeArray(narrowed->data()));
+
+  auto sliced = sel_vector->Slice(1, 5);
+  ASSERT_EQ(1, sliced->length());
+  ASSERT_EQ(3, sliced->indices()[0]);
+}
+
+TEST(ExecBatch, MaterializeSelection) {
+  ExecBatch batch({ArrayFromJSON(int32(), "[1, 2, 3, 4]"),
+                   ArrayFromJSON(utf8(), R"(["a", "b", null, "d"])"), Datum(7)},
+                  4);
+  ASSERT_OK_AND_ASSIGN(auto materialized, batch.MaterializeSelection());
+  ASSERT_EQ(materialized, batch);
+
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 2, 3]"));
+  batch.length = 3;
+  ExecBatch expected({ArrayFromJSON(int32(), "[1, 3, 4]"),
+                      ArrayFromJSON(utf8(), R"(["a", null, "d"])"), Datum(7)},
+                     3);
+  ASSERT_OK_AND_ASSIGN(materialized, batch.MaterializeSelection());
+  ASSERT_EQ(materialized, expected);
+  auto batch_schema =
+      schema({field("a", int32()), field("b", utf8()), field("c", int32())});
+  ASSERT_OK_AND_ASSIGN(auto record_batch, batch.ToRecordBatch(batch_schema));
+  ASSERT_EQ(ExecBatch(*record_batch).values[1], expected.values[1]);
+
+  // Only the requested columns are gathered
+  ASSERT_OK_AND_ASSIGN(materialized, batch.MaterializeSelection({1}));
+  ASSERT_EQ(materialized.values[0].kind(), Datum::NONE);
+  ASSERT_EQ(materialized.values[1], expected.values[1]);
+
+  // Slicing applies to the selection
+  auto sliced = batch.Slice(1, 2);
+  ASSERT_EQ(sliced.length, 2);
+  ASSERT_OK_AND_ASSIGN(materialized, sliced.MaterializeSelection());
+  ASSERT_EQ(materialized, expected.Slice(1, 2));
+}
+
 void AssertValidityZeroExtraBits(const ArrayData& arr) {
   const Buffer& buf = *arr.buffers[0];
 
@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/array/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/hyperloglog.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+using arrow::internal::HyperLogLog;
+
+template <typename ArrowType>
+struct ApproximateCountDistinctImpl : public ScalarAggregator {
+  using ThisType = ApproximateCountDistinctImpl<ArrowType>;
+
+  explicit ApproximateCountDistinctImpl(const ApproximateCountDistinctOptions& options)
+      : sketch{options.precision} {}
+
+  Status Consume(KernelContext* ctx, const ExecBatch& batch) override {
+    if (batch[0].is_array()) {
+      ConsumeArray(*batch[0].array());
+    } else if (batch[0].scalar()->is_valid) {
+      // Adding a value several times doesn't change the sketch
+      ARROW_ASSIGN_OR_RAISE(
+          auto array, MakeArrayFromScalar(*batch[0].scalar(), 1, ctx->memory_pool()));
+      ConsumeArray(*array->data());
+    }
+    return Status::OK();
+  }
+
+  void ConsumeArray(const ArrayData& data) {
+    VisitApproximateDistinctHashes<ArrowType>(
+        data, [&](uint64_t hash) { this->sketch.Add(hash); }, [] {});
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    return this->sketch.Merge(other.sketch);
+  }
+
+  Status Finalize(KernelContext*, Datum* out) override {
+    *out = Datum(this->sketch.Estimate());
+    return Status::OK();
+  }
+
+  HyperLogLog sketch;
+};
+
+struct ApproximateCountDistinctInitState {
+  std::unique_ptr<KernelState> state;
+  const DataType& in_type;
+  const ApproximateCountDistinctOptions& options;
+
+  ApproximateCountDistinctInitState(const DataType& in_type,
+                                    const ApproximateCountDistinctOptions& options)
+      : in_type(in_type), options(options) {}
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Approximate distinct count of data of type ", type);
+  }
+
+  template <typename Type>
+  enable_if_approximate_distinct<Type, Status> Visit(const Type&) {
+    state.reset(new ApproximateCountDistinctImpl<Type>(options));
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<KernelState>> Create() {
+    RETURN_NOT_OK(HyperLogLog::ValidatePrecision(options.precision));
+    RETURN_NOT_OK(VisitTypeInline(in_type, this));
+    return std::move(state);
+  }
+};
+
+Result<std::unique_ptr<KernelState>> ApproximateCountDistinctInit(
+    KernelContext*, const KernelInitArgs& args) {
+  ApproximateCountDistinctInitState visitor(
+      *args.inputs[0].type,
+      static_cast<const ApproximateCountDistinctOptions&>(*args.options));
+  return visitor.Create();
+}
+
+const FunctionDoc approximate_count_distinct_doc{
+    "Approximate number of distinct values with the HyperLogLog algorithm",
+    ("Nulls are ignored.  The sketch size, and hence the accuracy, is\n"
+     "controlled by ApproximateCountDistinctOptions.\n"
+     "NaNs and signed zeroes are not normalized."),
+    {"array"},
+    "ApproximateCountDistinctOptions"};
+
+std::shared_ptr<ScalarAggregateFunction> AddApproximateCountDistinctAggKernels() {
+  static auto default_options = ApproximateCountDistinctOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "approximate_count_distinct", Arity::Unary(), &approximate_count_distinct_doc,
+      &default_options);
+  // Unsupported types are rejected when initializing the kernel state
+  AddAggKernel(KernelSignature::Make({InputType()}, int64()),
+               ApproximateCountDistinctInit, func.get());
+  return func;
+}
+
+}  // namespace
+
+void RegisterScalarAggregateApproximateCountDistinct(FunctionRegistry* registry) {
+  DCHECK_OK(registry->AddFunction(AddApproximateCountDistinctAggKernels()));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
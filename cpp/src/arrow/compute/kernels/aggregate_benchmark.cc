@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "arrow/compute/api.h"
+#include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
@@ -306,9 +307,11 @@ BENCHMARK_TEMPLATE(ReferenceSum, SumBitmapVectorizeUnroll<int64_t>)
 
 static void BenchmarkGroupBy(benchmark::State& state,
                              std::vector<internal::Aggregate> aggregates,
-                             std::vector<Datum> arguments, std::vector<Datum> keys) {
+                             std::vector<Datum> arguments, std::vector<Datum> keys,
+                             ExecContext* ctx = default_exec_context()) {
   for (auto _ : state) {
-    ABORT_NOT_OK(GroupBy(arguments, keys, aggregates).status());
+    ABORT_NOT_OK(GroupBy(arguments, keys, aggregates, /*use_threads=*/false, ctx)
+                     .status());
   }
 }
 
@@ -463,6 +466,39 @@ GROUP_BY_BENCHMARK(SumDoublesGroupedByMediumIntStringPairSet, [&] {
   BenchmarkGroupBy(state, {{"hash_sum", NULLPTR}}, {summand}, {int_key, str_key});
 });
 
+GROUP_BY_BENCHMARK(SumDoublesGroupedByLargeIntegerSet, [&] {
+  auto summand = rng.Float64(args.size,
+                             /*min=*/0.0,
+                             /*max=*/1.0e14,
+                             /*null_probability=*/args.null_proportion,
+                             /*nan_probability=*/args.null_proportion / 10);
+
+  auto key = rng.Int64(args.size,
+                       /*min=*/0,
+                       /*max=*/(1 << 20) - 1);
+
+  BenchmarkGroupBy(state, {{"hash_sum", NULLPTR}}, {summand}, {key});
+});
+
+// Same as above, with the hash tables and accumulators backed by huge pages
+GROUP_BY_BENCHMARK(SumDoublesGroupedByLargeIntegerSetHugePages, [&] {
+  auto summand = rng.Float64(args.size,
+                             /*min=*/0.0,
+                             /*max=*/1.0e14,
+                             /*null_probability=*/args.null_proportion,
+                             /*nan_probability=*/args.null_proportion / 10);
+
+  auto key = rng.Int64(args.size,
+                       /*min=*/0,
+                       /*max=*/(1 << 20) - 1);
+
+  auto options = HugePageMemoryPoolOptions::Defaults();
+  options.bind_to_local_numa_node = true;
+  HugePageMemoryPool pool(default_memory_pool(), options);
+  ExecContext ctx(&pool);
+  BenchmarkGroupBy(state, {{"hash_sum", NULLPTR}}, {summand}, {key}, &ctx);
+});
+
 //
 // Sum
 //
@@ -17,11 +17,15 @@
 
 #pragma once
 
+#include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_run_reader.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
 #include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 namespace compute {
@@ -106,6 +110,36 @@ void AddAggKernel(std::shared_ptr<KernelSignature> sig, KernelInit init,
                   ScalarAggregateFunction* func,
                   SimdLevel::type simd_level = SimdLevel::NONE);
 
+// Helpers for approximate distinct counting with HyperLogLog sketches
+
+template <typename T, typename R = void>
+using enable_if_approximate_distinct =
+    enable_if_t<has_c_type<T>::value || is_base_binary_type<T>::value ||
+                    is_fixed_size_binary_type<T>::value,
+                R>;
+
+// Hash the bytes of a value, so that all bits of the hash are well mixed.
+// NaNs and signed zeroes are not normalized.
+template <typename CType>
+uint64_t ApproximateDistinctHash(const CType& value) {
+  return ::arrow::internal::HyperLogLog::MixHash(
+      ::arrow::internal::ComputeStringHash<0>(&value, sizeof(CType)));
+}
+
+inline uint64_t ApproximateDistinctHash(util::string_view value) {
+  return ::arrow::internal::HyperLogLog::MixHash(::arrow::internal::ComputeStringHash<0>(
+      value.data(), static_cast<int64_t>(value.size())));
+}
+
+template <typename Type, typename HashFunc, typename NullFunc>
+void VisitApproximateDistinctHashes(const ArrayData& data, HashFunc&& hash_func,
+                                    NullFunc&& null_func) {
+  using ValueType = typename internal::GetViewType<Type>::PhysicalType;
+  VisitArrayDataInline<Type>(
+      data, [&](ValueType value) { hash_func(ApproximateDistinctHash(value)); },
+      std::forward<NullFunc>(null_func));
+}
+
 namespace detail {
 
 using arrow::internal::VisitSetBitRunsVoid;
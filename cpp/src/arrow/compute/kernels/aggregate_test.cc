@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <type_traits>
@@ -3447,5 +3448,72 @@ TEST(TestTDigestKernel, Options) {
               ResultWith(ArrayFromJSON(ty, "[null]")));
 }
 
+//
+// ApproximateCountDistinct
+//
+
+void CheckApproximateCountDistinct(const Datum& input, int64_t expected,
+                                   const ApproximateCountDistinctOptions& options =
+                                       ApproximateCountDistinctOptions::Defaults()) {
+  ASSERT_OK_AND_ASSIGN(Datum out, ApproximateCountDistinct(input, options));
+  ValidateOutput(out);
+  AssertDatumsEqual(Datum(expected), out);
+}
+
+TEST(TestApproximateCountDistinctKernel, Basics) {
+  // Linear counting is exact for so few values
+  for (const auto& ty : NumericTypes()) {
+    ARROW_SCOPED_TRACE("type = ", *ty);
+    CheckApproximateCountDistinct(ArrayFromJSON(ty, "[]"), 0);
+    CheckApproximateCountDistinct(ArrayFromJSON(ty, "[null, null]"), 0);
+    CheckApproximateCountDistinct(ArrayFromJSON(ty, "[1, 2, null, 3, 2]"), 3);
+    CheckApproximateCountDistinct(
+        ChunkedArrayFromJSON(ty, {"[1, 2]", "[]", "[null, 3, 2]", "[4]"}), 4);
+  }
+  for (const auto& ty : {utf8(), large_binary(), fixed_size_binary(3)}) {
+    ARROW_SCOPED_TRACE("type = ", *ty);
+    CheckApproximateCountDistinct(
+        ChunkedArrayFromJSON(ty, {R"(["aaa", "bbb"])", R"([null, "ccc", "aaa"])"}), 3);
+  }
+  CheckApproximateCountDistinct(ArrayFromJSON(boolean(), "[true, null, true]"), 1);
+  CheckApproximateCountDistinct(ArrayFromJSON(boolean(), "[true, false, true]"), 2);
+  CheckApproximateCountDistinct(ArrayFromJSON(decimal(5, 2), R"(["1.00", "1.00"])"), 1);
+  CheckApproximateCountDistinct(ArrayFromJSON(timestamp(TimeUnit::SECOND), "[1, 2]"), 2);
+}
+
+TEST(TestApproximateCountDistinctKernel, Scalar) {
+  CheckApproximateCountDistinct(ScalarFromJSON(int32(), "5"), 1);
+  CheckApproximateCountDistinct(ScalarFromJSON(utf8(), R"("foo")"), 1);
+  CheckApproximateCountDistinct(ScalarFromJSON(int32(), "null"), 0);
+}
+
+TEST(TestApproximateCountDistinctKernel, Random) {
+  auto rand = random::RandomArrayGenerator(0x5487656);
+  // 100000 values drawn from about 50000 distinct values
+  auto array = rand.Int64(100000, /*min=*/0, /*max=*/50000, /*null_probability=*/0.1);
+  ASSERT_OK_AND_ASSIGN(auto uniques, Unique(array));
+  const int64_t expected = uniques->length() - (uniques->null_count() > 0 ? 1 : 0);
+
+  for (uint32_t precision : {10, 12, 16}) {
+    ARROW_SCOPED_TRACE("precision = ", precision);
+    ApproximateCountDistinctOptions options(precision);
+    ASSERT_OK_AND_ASSIGN(Datum out, ApproximateCountDistinct(array, options));
+    const auto estimate = out.scalar_as<Int64Scalar>().value;
+    // Allow for 4 standard errors
+    const double error = 4 * 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    ASSERT_NEAR(static_cast<double>(estimate), static_cast<double>(expected),
+                error * static_cast<double>(expected));
+  }
+}
+
+TEST(TestApproximateCountDistinctKernel, Errors) {
+  ASSERT_RAISES(Invalid, ApproximateCountDistinct(ArrayFromJSON(int32(), "[1]"),
+                                                  ApproximateCountDistinctOptions(3)));
+  ASSERT_RAISES(Invalid, ApproximateCountDistinct(ArrayFromJSON(int32(), "[1]"),
+                                                  ApproximateCountDistinctOptions(19)));
+  ASSERT_RAISES(NotImplemented,
+                ApproximateCountDistinct(ArrayFromJSON(list(int32()), "[[1]]")));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -24,6 +24,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "arrow/array/util.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/api_vector.h"
@@ -2342,6 +2343,116 @@ Result<std::unique_ptr<KernelState>> GroupedDistinctInit(KernelContext* ctx,
   return std::move(impl);
 }
 
+// ----------------------------------------------------------------------
+// ApproximateCountDistinct implementation
+
+using arrow::internal::HyperLogLog;
+
+// Keeps one HyperLogLog sketch per group, stored contiguously
+template <typename Type>
+struct GroupedApproximateCountDistinctImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const FunctionOptions* options) override {
+    options_ = checked_cast<const ApproximateCountDistinctOptions&>(*options);
+    RETURN_NOT_OK(HyperLogLog::ValidatePrecision(options_.precision));
+    pool_ = ctx->memory_pool();
+    registers_ = TypedBufferBuilder<uint8_t>(pool_);
+    return Status::OK();
+  }
+
+  int64_t num_registers() const { return HyperLogLog::NumRegisters(options_.precision); }
+
+  Status Resize(int64_t new_num_groups) override {
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    return registers_.Append(added_groups * num_registers(), 0);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    uint8_t* registers = registers_.mutable_data();
+    const uint32_t precision = options_.precision;
+    const int64_t stride = num_registers();
+    auto g = batch[1].array()->GetValues<uint32_t>(1);
+
+    if (batch[0].is_array()) {
+      VisitApproximateDistinctHashes<Type>(
+          *batch[0].array(),
+          [&](uint64_t hash) {
+            HyperLogLog::Add(registers + *g++ * stride, precision, hash);
+          },
+          [&] { ++g; });
+    } else if (batch[0].scalar()->is_valid) {
+      ARROW_ASSIGN_OR_RAISE(auto array,
+                            MakeArrayFromScalar(*batch[0].scalar(), 1, pool_));
+      uint64_t scalar_hash = 0;
+      VisitApproximateDistinctHashes<Type>(
+          *array->data(), [&](uint64_t hash) { scalar_hash = hash; }, [] {});
+      for (int64_t i = 0; i < batch.length; ++i) {
+        HyperLogLog::Add(registers + g[i] * stride, precision, scalar_hash);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedApproximateCountDistinctImpl*>(&raw_other);
+
+    uint8_t* registers = registers_.mutable_data();
+    const uint8_t* other_registers = other->registers_.data();
+    const int64_t stride = num_registers();
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      HyperLogLog::Merge(registers + *g * stride, other_registers + other_g * stride,
+                         options_.precision);
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                          AllocateBuffer(num_groups_ * sizeof(int64_t), pool_));
+    int64_t* counts = reinterpret_cast<int64_t*>(values->mutable_data());
+    const uint8_t* registers = registers_.data();
+    const int64_t stride = num_registers();
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      counts[i] = HyperLogLog::Estimate(registers + i * stride, options_.precision);
+    }
+    return ArrayData::Make(int64(), num_groups_, {nullptr, std::move(values)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+  int64_t num_groups_ = 0;
+  ApproximateCountDistinctOptions options_;
+  TypedBufferBuilder<uint8_t> registers_;
+  MemoryPool* pool_;
+};
+
+struct GroupedApproximateCountDistinctInitState {
+  template <typename Type>
+  enable_if_approximate_distinct<Type, Status> Visit(const Type&) {
+    return HashAggregateInit<GroupedApproximateCountDistinctImpl<Type>>(ctx, args)
+        .Value(&state);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Approximate distinct count of data of type ", type);
+  }
+
+  KernelContext* ctx;
+  const KernelInitArgs& args;
+  std::unique_ptr<KernelState> state;
+};
+
+Result<std::unique_ptr<KernelState>> GroupedApproximateCountDistinctInit(
+    KernelContext* ctx, const KernelInitArgs& args) {
+  GroupedApproximateCountDistinctInitState visitor{ctx, args, nullptr};
+  RETURN_NOT_OK(VisitTypeInline(*args.inputs[0].type, &visitor));
+  return std::move(visitor.state);
+}
+
 }  // namespace
 
 Result<std::vector<const HashAggregateKernel*>> GetKernels(
@@ -2684,6 +2795,14 @@ const FunctionDoc hash_count_distinct_doc{
     {"array", "group_id_array"},
     "CountOptions"};
 
+const FunctionDoc hash_approximate_count_distinct_doc{
+    "Approximate number of distinct values in each group with HyperLogLog",
+    ("Nulls are ignored.  The sketch size, and hence the accuracy, is\n"
+     "controlled by ApproximateCountDistinctOptions.\n"
+     "NaNs and signed zeroes are not normalized."),
+    {"array", "group_id_array"},
+    "ApproximateCountDistinctOptions"};
+
 const FunctionDoc hash_distinct_doc{
     "Keep the distinct values in each group",
     ("Whether nulls/values are kept is controlled by CountOptions.\n"
@@ -2697,6 +2816,8 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
   static auto default_scalar_aggregate_options = ScalarAggregateOptions::Defaults();
   static auto default_tdigest_options = TDigestOptions::Defaults();
   static auto default_variance_options = VarianceOptions::Defaults();
+  static auto default_approximate_count_distinct_options =
+      ApproximateCountDistinctOptions::Defaults();
 
   {
     auto func = std::make_shared<HashAggregateFunction>(
@@ -2843,6 +2964,17 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_approximate_count_distinct", Arity::Binary(),
+        &hash_approximate_count_distinct_doc,
+        &default_approximate_count_distinct_options);
+    // Unsupported types are rejected when initializing the kernel state
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(ValueDescr::ARRAY, GroupedApproximateCountDistinctInit)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
   {
     auto func = std::make_shared<HashAggregateFunction>(
         "hash_distinct", Arity::Binary(), &hash_distinct_doc, &default_count_options);
@@ -1909,6 +1909,120 @@ TEST(GroupBy, CountDistinct) {
   }
 }
 
+TEST(GroupBy, ApproximateCountDistinct) {
+  ApproximateCountDistinctOptions options;
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+
+    auto table = TableFromJSON(schema({field("argument", float64()),
+                                       field("str", utf8()), field("key", int64())}),
+                               {R"([
+    [1,    "foo",  1],
+    [1,    "foo",  1]
+])",
+                                R"([
+    [0,    "bar",  2],
+    [null, null,   3],
+    [null, null,   3]
+])",
+                                R"([
+    [null, null,   4],
+    [null, null,   4]
+])",
+                                R"([
+    [4,    "baz",  null],
+    [1,    "foo",  3]
+])",
+                                R"([
+    [0,    "bar",  2],
+    [-1,   "spam", 2]
+])",
+                                R"([
+    [1,    "eggs", null],
+    [NaN,  "ham",  3]
+  ])",
+                                R"([
+    [2,    "a",    null],
+    [3,    "b",    null]
+  ])"});
+
+    // Linear counting is exact for so few values
+    ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                         internal::GroupBy(
+                             {
+                                 table->GetColumnByName("argument"),
+                                 table->GetColumnByName("str"),
+                             },
+                             {
+                                 table->GetColumnByName("key"),
+                             },
+                             {
+                                 {"hash_approximate_count_distinct", &options},
+                                 {"hash_approximate_count_distinct", &options},
+                             },
+                             use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+    ValidateOutput(aggregated_and_grouped);
+
+    AssertDatumsEqual(ArrayFromJSON(struct_({
+                                        field("hash_approximate_count_distinct", int64()),
+                                        field("hash_approximate_count_distinct", int64()),
+                                        field("key_0", int64()),
+                                    }),
+                                    R"([
+    [1, 1, 1],
+    [2, 2, 2],
+    [2, 2, 3],
+    [0, 0, 4],
+    [4, 4, null]
+  ])"),
+                      aggregated_and_grouped,
+                      /*verbose=*/true);
+  }
+}
+
+TEST(GroupBy, ApproximateCountDistinctManyValues) {
+  constexpr int64_t kNumGroups = 3;
+  constexpr int64_t kNumValues = 30000;
+  constexpr int64_t kChunkSize = 1000;
+
+  // Group g gets values g, g + 3, g + 6... so each has kNumValues / 3 distinct values,
+  // spread over many chunks whose sketches are merged
+  ArrayVector values, keys;
+  for (int64_t offset = 0; offset < kNumValues; offset += kChunkSize) {
+    Int64Builder value_builder, key_builder;
+    for (int64_t i = offset; i < offset + kChunkSize; ++i) {
+      ASSERT_OK(value_builder.Append(i));
+      ASSERT_OK(key_builder.Append(i % kNumGroups));
+    }
+    ASSERT_OK_AND_ASSIGN(auto value_array, value_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto key_array, key_builder.Finish());
+    values.push_back(std::move(value_array));
+    keys.push_back(std::move(key_array));
+  }
+
+  ApproximateCountDistinctOptions options;
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    ASSERT_OK_AND_ASSIGN(
+        Datum aggregated_and_grouped,
+        internal::GroupBy({std::make_shared<ChunkedArray>(values)},
+                          {std::make_shared<ChunkedArray>(keys)},
+                          {{"hash_approximate_count_distinct", &options}}, use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+    ValidateOutput(aggregated_and_grouped);
+
+    const auto& result = *aggregated_and_grouped.array_as<StructArray>();
+    const auto& estimates = checked_cast<const Int64Array&>(*result.field(0));
+    ASSERT_EQ(estimates.length(), kNumGroups);
+    for (int64_t g = 0; g < kNumGroups; ++g) {
+      // Allow for 4 standard errors
+      ASSERT_NEAR(static_cast<double>(estimates.Value(g)), kNumValues / kNumGroups,
+                  4 * 1.04 / 64 * kNumValues / kNumGroups);
+    }
+  }
+}
+
 TEST(GroupBy, Distinct) {
   CountOptions all(CountOptions::ALL);
   CountOptions only_valid(CountOptions::ONLY_VALID);
@@ -15,7 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <mutex>
 
 #include "arrow/array/array_base.h"
@@ -28,8 +30,11 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -712,6 +717,175 @@ const FunctionDoc value_counts_doc(
      "Nulls in the input are ignored."),
     {"array"});
 
+// ----------------------------------------------------------------------
+// Parallel hashing of chunked arrays
+
+// Minimum number of rows hashed by each parallel task
+constexpr int64_t kMinParallelHashLength = 1 << 16;
+
+::arrow::internal::Executor* GetExecutor(ExecContext* ctx) {
+  return ctx->executor() ? ctx->executor() : ::arrow::internal::GetCpuThreadPool();
+}
+
+// Split the chunks of `value` into contiguous ranges of similar length, one
+// per parallel task.  Return an empty vector if parallel hashing is not
+// worthwhile.
+std::vector<std::shared_ptr<ChunkedArray>> SplitForParallelHash(const Datum& value,
+                                                                ExecContext* ctx) {
+  if (!ctx->use_threads() || value.kind() != Datum::CHUNKED_ARRAY) {
+    return {};
+  }
+  const ChunkedArray& chunked = *value.chunked_array();
+  // Dictionary inputs are unified by the kernels themselves
+  if (chunked.num_chunks() < 2 || chunked.type()->id() == Type::DICTIONARY) {
+    return {};
+  }
+  auto executor = GetExecutor(ctx);
+  // Don't block a worker thread waiting for tasks submitted to its own pool
+  if (executor->OwnsThisThread()) {
+    return {};
+  }
+  const int64_t num_tasks =
+      std::min({static_cast<int64_t>(chunked.num_chunks()),
+                static_cast<int64_t>(executor->GetCapacity()),
+                chunked.length() / kMinParallelHashLength});
+  if (num_tasks < 2) {
+    return {};
+  }
+
+  const int64_t range_length = BitUtil::CeilDiv(chunked.length(), num_tasks);
+  std::vector<std::shared_ptr<ChunkedArray>> ranges;
+  ArrayVector range_chunks;
+  int64_t length = 0;
+  for (const auto& chunk : chunked.chunks()) {
+    range_chunks.push_back(chunk);
+    length += chunk->length();
+    if (length >= range_length) {
+      ranges.push_back(
+          std::make_shared<ChunkedArray>(std::move(range_chunks), chunked.type()));
+      range_chunks.clear();
+      length = 0;
+    }
+  }
+  if (!range_chunks.empty()) {
+    ranges.push_back(
+        std::make_shared<ChunkedArray>(std::move(range_chunks), chunked.type()));
+  }
+  if (ranges.size() < 2) {
+    return {};
+  }
+  return ranges;
+}
+
+// A hash function which hashes the ranges of a large chunked array in parallel, each
+// with a memo table of its own, then merges their results in range order, which keeps
+// values in order of first occurrence as a serial execution would.
+class ParallelHashFunction : public VectorFunction {
+ public:
+  using VectorFunction::VectorFunction;
+
+  Result<Datum> Execute(const std::vector<Datum>& args, const FunctionOptions* options,
+                        ExecContext* ctx) const override {
+    if (ctx == nullptr) {
+      ExecContext default_ctx;
+      return Execute(args, options, &default_ctx);
+    }
+    std::vector<std::shared_ptr<ChunkedArray>> ranges;
+    if (args.size() == 1) {
+      ranges = SplitForParallelHash(args[0], ctx);
+    }
+    if (ranges.empty()) {
+      return VectorFunction::Execute(args, options, ctx);
+    }
+
+    std::vector<Datum> range_results(ranges.size());
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        static_cast<int>(ranges.size()),
+        [&](int i) -> Status {
+          ARROW_ASSIGN_OR_RAISE(range_results[i], VectorFunction::Execute(
+                                                      {Datum(ranges[i])}, options, ctx));
+          return Status::OK();
+        },
+        GetExecutor(ctx)));
+    return Merge(std::move(range_results), ctx);
+  }
+
+ protected:
+  virtual Result<Datum> Merge(std::vector<Datum> range_results,
+                              ExecContext* ctx) const = 0;
+};
+
+class ParallelUniqueFunction : public ParallelHashFunction {
+ public:
+  using ParallelHashFunction::ParallelHashFunction;
+
+ protected:
+  Result<Datum> Merge(std::vector<Datum> range_results, ExecContext* ctx) const override {
+    ArrayVector range_uniques;
+    for (const auto& uniques : range_results) {
+      range_uniques.push_back(uniques.make_array());
+    }
+    // Uniques of the concatenated per-range uniques, in order of first occurrence
+    ARROW_ASSIGN_OR_RAISE(auto all_uniques,
+                          Concatenate(range_uniques, ctx->memory_pool()));
+    return VectorFunction::Execute({Datum(all_uniques)}, /*options=*/nullptr, ctx);
+  }
+};
+
+class ParallelDictionaryEncodeFunction : public ParallelHashFunction {
+ public:
+  using ParallelHashFunction::ParallelHashFunction;
+
+ protected:
+  Result<Datum> Merge(std::vector<Datum> range_results, ExecContext* ctx) const override {
+    std::vector<ArrayVector> range_encoded(range_results.size());
+    ArrayVector range_dicts(range_results.size());
+    for (size_t i = 0; i < range_results.size(); ++i) {
+      range_encoded[i] = range_results[i].chunked_array()->chunks();
+      // All chunks of a range share the same dictionary
+      range_dicts[i] =
+          checked_cast<const DictionaryArray&>(*range_encoded[i][0]).dictionary();
+    }
+
+    // Dictionary-encode the concatenated per-range dictionaries: the merged indices
+    // map them to the merged dictionary. DictionaryUnifier isn't used as it rejects
+    // dictionaries with a null, which null_encoding=ENCODE produces.
+    ARROW_ASSIGN_OR_RAISE(auto all_values, Concatenate(range_dicts, ctx->memory_pool()));
+    const auto encode_nulls = DictionaryEncodeOptions(DictionaryEncodeOptions::ENCODE);
+    ARROW_ASSIGN_OR_RAISE(
+        Datum merged_datum,
+        VectorFunction::Execute({Datum(all_values)}, &encode_nulls, ctx));
+    auto merged = checked_pointer_cast<DictionaryArray>(merged_datum.make_array());
+    const auto& merged_indices = checked_cast<const Int32Array&>(*merged->indices());
+    const auto out_type = dictionary(int32(), merged->dictionary()->type());
+
+    // Remap the indices of each range to the merged dictionary
+    std::vector<int64_t> range_offsets(range_results.size(), 0);
+    for (size_t i = 1; i < range_results.size(); ++i) {
+      range_offsets[i] = range_offsets[i - 1] + range_dicts[i - 1]->length();
+    }
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        static_cast<int>(range_results.size()),
+        [&](int i) -> Status {
+          const int32_t* transpose_map = merged_indices.raw_values() + range_offsets[i];
+          for (auto& chunk : range_encoded[i]) {
+            ARROW_ASSIGN_OR_RAISE(
+                chunk, checked_cast<const DictionaryArray&>(*chunk).Transpose(
+                           out_type, merged->dictionary(), transpose_map,
+                           ctx->memory_pool()));
+          }
+          return Status::OK();
+        },
+        GetExecutor(ctx)));
+
+    ArrayVector chunks;
+    for (auto& encoded : range_encoded) {
+      std::move(encoded.begin(), encoded.end(), std::back_inserter(chunks));
+    }
+    return std::make_shared<ChunkedArray>(std::move(chunks), out_type);
+  }
+};
+
 const auto kDefaultDictionaryEncodeOptions = DictionaryEncodeOptions::Defaults();
 const FunctionDoc dictionary_encode_doc(
     "Dictionary-encode array",
@@ -729,7 +903,8 @@ void RegisterVectorHash(FunctionRegistry* registry) {
 
   base.finalize = UniqueFinalize;
   base.output_chunked = false;
-  auto unique = std::make_shared<VectorFunction>("unique", Arity::Unary(), &unique_doc);
+  auto unique =
+      std::make_shared<ParallelUniqueFunction>("unique", Arity::Unary(), &unique_doc);
   AddHashKernels<UniqueAction>(unique.get(), base, OutputType(FirstType));
 
   // Dictionary unique
@@ -765,9 +940,9 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   base.finalize = DictEncodeFinalize;
   // Unique and ValueCounts output unchunked arrays
   base.output_chunked = true;
-  auto dict_encode = std::make_shared<VectorFunction>("dictionary_encode", Arity::Unary(),
-                                                      &dictionary_encode_doc,
-                                                      &kDefaultDictionaryEncodeOptions);
+  auto dict_encode = std::make_shared<ParallelDictionaryEncodeFunction>(
+      "dictionary_encode", Arity::Unary(), &dictionary_encode_doc,
+      &kDefaultDictionaryEncodeOptions);
   AddHashKernels<DictEncodeAction>(dict_encode.get(), base, OutputType(DictEncodeOutput));
 
   // Calling dictionary_encode on dictionary input not supported, but if it
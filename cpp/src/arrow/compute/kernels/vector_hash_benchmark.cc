@@ -20,10 +20,14 @@
 #include <vector>
 
 #include "arrow/array/builder_binary.h"
+#include "arrow/chunked_array.h"
 #include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/visitor_inline.h"
 
 #include "arrow/compute/api.h"
 
@@ -225,6 +229,103 @@ static void UniqueString100bytes(benchmark::State& state) {
   BenchUnique(state, HashParams<StringType>{general_bench_cases[state.range(0)], 100});
 }
 
+// clang-format off
+std::vector<HashBenchCase> high_cardinality_bench_cases = {
+  {kHashBenchmarkLength, 1 << 20, 0},
+  {kHashBenchmarkLength, 1 << 20, 0.1},
+  {kHashBenchmarkLength, kHashBenchmarkLength, 0},
+};
+// clang-format on
+
+// Memoize the values of an array the way the hash kernels do, to compare
+// hash table implementations on the same data as the kernel benchmarks
+template <typename Type, typename MemoTableType, typename ValueType, typename ParamType>
+void BenchMemoTable(benchmark::State& state, const ParamType& params) {
+  std::shared_ptr<Array> arr;
+  params.GenerateTestData(&arr);
+
+  while (state.KeepRunning()) {
+    MemoTableType memo_table(default_memory_pool(), 0);
+    int32_t unused_memo_index;
+    ABORT_NOT_OK(VisitArrayDataInline<Type>(
+        *arr->data(),
+        [&](ValueType value) {
+          return memo_table.GetOrInsert(value, &unused_memo_index);
+        },
+        [&]() {
+          memo_table.GetOrInsertNull();
+          return Status::OK();
+        }));
+    benchmark::DoNotOptimize(memo_table.size());
+  }
+  params.SetMetadata(state);
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableInt64(benchmark::State& state) {
+  using MemoTableType =
+      ::arrow::internal::ScalarMemoTable<int64_t, HashTableTemplateType>;
+  BenchMemoTable<Int64Type, MemoTableType, int64_t>(
+      state, HashParams<Int64Type>{high_cardinality_bench_cases[state.range(0)]});
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableString10bytes(benchmark::State& state) {
+  using MemoTableType =
+      ::arrow::internal::BinaryMemoTable<BinaryBuilder, HashTableTemplateType>;
+  BenchMemoTable<StringType, MemoTableType, util::string_view>(
+      state,
+      HashParams<StringType>{high_cardinality_bench_cases[state.range(0)], 10});
+}
+
+static void UniqueInt64HighCardinality(benchmark::State& state) {
+  BenchUnique(state, HashParams<Int64Type>{high_cardinality_bench_cases[state.range(0)]});
+}
+
+static void UniqueString10bytesHighCardinality(benchmark::State& state) {
+  BenchUnique(state,
+              HashParams<StringType>{high_cardinality_bench_cases[state.range(0)], 10});
+}
+
+// Split the test data into 64 chunks and hash it serially or in parallel,
+// depending on state.range(1)
+template <typename ParamType, typename BenchFunc>
+void BenchChunked(benchmark::State& state, const ParamType& params,
+                  BenchFunc&& bench_func) {
+  std::shared_ptr<Array> arr;
+  params.GenerateTestData(&arr);
+  const int64_t num_chunks = 64;
+  const int64_t chunk_length = BitUtil::CeilDiv(arr->length(), num_chunks);
+  ArrayVector chunks;
+  for (int64_t offset = 0; offset < arr->length(); offset += chunk_length) {
+    chunks.push_back(arr->Slice(offset, chunk_length));
+  }
+  auto chunked = std::make_shared<ChunkedArray>(chunks);
+
+  ExecContext ctx;
+  ctx.set_use_threads(state.range(1) != 0);
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(bench_func(chunked, &ctx));
+  }
+  params.SetMetadata(state);
+}
+
+static void UniqueChunkedInt64(benchmark::State& state) {
+  BenchChunked(state, HashParams<Int64Type>{high_cardinality_bench_cases[state.range(0)]},
+               [](const std::shared_ptr<ChunkedArray>& values, ExecContext* ctx) {
+                 return Unique(values, ctx).status();
+               });
+}
+
+static void DictionaryEncodeChunkedString10bytes(benchmark::State& state) {
+  BenchChunked(
+      state, HashParams<StringType>{high_cardinality_bench_cases[state.range(0)], 10},
+      [](const std::shared_ptr<ChunkedArray>& values, ExecContext* ctx) {
+        return DictionaryEncode(values, DictionaryEncodeOptions::Defaults(), ctx)
+            .status();
+      });
+}
+
 void HashSetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(general_bench_cases.size()); ++i) {
     bench->Arg(i);
@@ -238,6 +339,34 @@ BENCHMARK(UniqueInt64)->Apply(HashSetArgs);
 BENCHMARK(UniqueString10bytes)->Apply(HashSetArgs);
 BENCHMARK(UniqueString100bytes)->Apply(HashSetArgs);
 
+void HighCardinalityArgs(benchmark::internal::Benchmark* bench) {
+  for (int i = 0; i < static_cast<int>(high_cardinality_bench_cases.size()); ++i) {
+    bench->Arg(i);
+  }
+}
+
+void ChunkedArgs(benchmark::internal::Benchmark* bench) {
+  for (int i = 0; i < static_cast<int>(high_cardinality_bench_cases.size()); ++i) {
+    for (int use_threads : {0, 1}) {
+      bench->Args({i, use_threads});
+    }
+  }
+  bench->UseRealTime();
+}
+
+BENCHMARK(UniqueChunkedInt64)->Apply(ChunkedArgs);
+BENCHMARK(DictionaryEncodeChunkedString10bytes)->Apply(ChunkedArgs);
+
+using ::arrow::internal::HashTable;
+using ::arrow::internal::SwissHashTable;
+
+BENCHMARK(UniqueInt64HighCardinality)->Apply(HighCardinalityArgs);
+BENCHMARK(UniqueString10bytesHighCardinality)->Apply(HighCardinalityArgs);
+BENCHMARK_TEMPLATE(MemoTableInt64, HashTable)->Apply(HighCardinalityArgs);
+BENCHMARK_TEMPLATE(MemoTableInt64, SwissHashTable)->Apply(HighCardinalityArgs);
+BENCHMARK_TEMPLATE(MemoTableString10bytes, HashTable)->Apply(HighCardinalityArgs);
+BENCHMARK_TEMPLATE(MemoTableString10bytes, SwissHashTable)->Apply(HighCardinalityArgs);
+
 void UInt8SetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(uint8_bench_cases.size()); ++i) {
     bench->Arg(i);
@@ -34,12 +34,14 @@
 #include "arrow/chunked_array.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util.h"
@@ -743,5 +745,54 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+TEST_F(TestHashKernel, ParallelChunkedArray) {
+  // Large enough to be hashed in parallel, with values repeated across chunks
+  const int64_t num_chunks = 16, chunk_length = 20000;
+  random::RandomArrayGenerator rng(42);
+  ASSERT_OK_AND_ASSIGN(auto pool, ::arrow::internal::ThreadPool::Make(4));
+  for (const auto& values :
+       {rng.Int64(num_chunks * chunk_length, 0, 50000, /*null_probability=*/0.01),
+        rng.StringWithRepeats(num_chunks * chunk_length, /*unique=*/30000,
+                              /*min_length=*/0, /*max_length=*/10,
+                              /*null_probability=*/0.01)}) {
+    ARROW_SCOPED_TRACE("type = ", *values->type());
+    ArrayVector chunks;
+    for (int64_t i = 0; i < num_chunks; ++i) {
+      chunks.push_back(values->Slice(i * chunk_length, chunk_length));
+    }
+    auto chunked = std::make_shared<ChunkedArray>(chunks);
+
+    ExecContext serial_ctx;
+    serial_ctx.set_use_threads(false);
+    // Use a pool of its own, so the chunks are hashed in parallel regardless of the
+    // capacity of the CPU thread pool
+    ExecContext parallel_ctx(default_memory_pool(), pool.get());
+    parallel_ctx.set_use_threads(true);
+
+    ASSERT_OK_AND_ASSIGN(auto expected_unique, Unique(chunked, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(auto actual_unique, Unique(chunked, &parallel_ctx));
+    ValidateOutput(*actual_unique);
+    AssertArraysEqual(*expected_unique, *actual_unique);
+    // Through the function registry as well
+    ASSERT_OK_AND_ASSIGN(Datum called_unique,
+                         CallFunction("unique", {chunked}, &parallel_ctx));
+    AssertArraysEqual(*expected_unique, *called_unique.make_array());
+
+    for (auto null_encoding :
+         {DictionaryEncodeOptions::MASK, DictionaryEncodeOptions::ENCODE}) {
+      DictionaryEncodeOptions options(null_encoding);
+      ASSERT_OK_AND_ASSIGN(Datum expected,
+                           DictionaryEncode(chunked, options, &serial_ctx));
+      ASSERT_OK_AND_ASSIGN(Datum actual,
+                           DictionaryEncode(chunked, options, &parallel_ctx));
+      ValidateOutput(actual);
+      AssertChunkedEqual(*expected.chunked_array(), *actual.chunked_array());
+      ASSERT_OK_AND_ASSIGN(
+          actual, CallFunction("dictionary_encode", {chunked}, &options, &parallel_ctx));
+      AssertChunkedEqual(*expected.chunked_array(), *actual.chunked_array());
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -16,8 +16,10 @@
 // under the License.
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
+#include <mutex>
 #include <numeric>
 #include <queue>
 #include <type_traits>
@@ -35,6 +37,8 @@
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -788,6 +792,179 @@ void AddSortingKernels(VectorKernel base, VectorFunction* func) {
   DCHECK_OK(func->AddKernel(base));
 }
 
+// ----------------------------------------------------------------------
+// Parallel merging of sorted runs
+
+// Inputs shorter than this are sorted and merged on the calling thread, and
+// merges are split in segments of (at least) this many output indices.
+constexpr int64_t kMinParallelSortLength = 1 << 16;
+
+::arrow::internal::Executor* GetSortExecutor(ExecContext* ctx) {
+  return ctx->executor() != nullptr ? ctx->executor()
+                                    : ::arrow::internal::GetCpuThreadPool();
+}
+
+// Like OptionalParallelFor, except that the calling thread runs tasks too, so that
+// sorting from a task of the executor (e.g. in an ExecPlan node) can't deadlock.
+template <typename Function>
+Status SortParallelFor(bool use_threads, int num_tasks, Function&& func,
+                       ::arrow::internal::Executor* executor) {
+  if (!use_threads) {
+    return ::arrow::internal::OptionalParallelFor(false, num_tasks,
+                                                  std::forward<Function>(func));
+  }
+  struct State {
+    std::atomic<int> next_task{0};
+    std::vector<Future<>> finished;
+  };
+  auto state = std::make_shared<State>();
+  for (int i = 0; i < num_tasks; ++i) {
+    state->finished.push_back(Future<>::Make());
+  }
+  // Threads claim tasks until none is left, so `func` is only called for tasks
+  // claimed before this returns
+  auto run_tasks = [state, num_tasks, &func]() {
+    for (int i = state->next_task++; i < num_tasks; i = state->next_task++) {
+      state->finished[i].MarkFinished(func(i));
+    }
+  };
+  for (int i = 1; i < num_tasks; ++i) {
+    if (!executor->Spawn(run_tasks).ok()) break;
+  }
+  run_tasks();
+  Status st;
+  for (const auto& finished : state->finished) {
+    st &= finished.status();
+  }
+  return st;
+}
+
+// Two adjacent sorted ranges [begin, middle) and [middle, end) to be merged.
+struct MergeRange {
+  uint64_t* begin;
+  uint64_t* middle;
+  uint64_t* end;
+};
+
+// Find how many elements of the left range come before output position
+// `diagonal` when stably merging the left and right ranges.
+//
+// This is a binary search along the "merge path" (see Odeh et al., "Merge
+// Path - Parallel Merging Made Simple"): cutting all merges along the same
+// diagonals gives independent, equally sized pieces of work.
+template <typename Comparator>
+int64_t MergePathSplit(const uint64_t* left, int64_t left_length, const uint64_t* right,
+                       int64_t right_length, int64_t diagonal, Comparator&& compare) {
+  int64_t lo = std::max<int64_t>(0, diagonal - right_length);
+  int64_t hi = std::min(diagonal, left_length);
+  while (lo < hi) {
+    const int64_t mid = lo + (hi - lo) / 2;
+    // Ties are resolved in favour of the left range, so left[mid] is output
+    // after right[diagonal - mid - 1] only if the latter is strictly smaller.
+    if (compare(right[diagonal - mid - 1], left[mid])) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+// Stably merge all given ranges in place.
+//
+// Each merge is cut along its merge path into segments of roughly
+// kMinParallelSortLength output indices, and all segments of all merges are
+// processed as independent tasks.  `temp_indices` must provide as much room
+// as the indices range starting at `indices_begin`.
+//
+// `make_comparator` is called once per task and must return a new comparator,
+// as comparators (through ChunkedArrayResolver) cache state and therefore
+// cannot be shared between threads.
+template <typename MakeComparator>
+Status MergeRanges(ExecContext* ctx, const std::vector<MergeRange>& merges,
+                   uint64_t* indices_begin, uint64_t* temp_indices,
+                   MakeComparator&& make_comparator) {
+  struct MergeSegment {
+    const MergeRange* merge;
+    // Range of output positions, relative to merge->begin
+    int64_t out_begin;
+    int64_t out_end;
+  };
+
+  std::vector<MergeSegment> segments;
+  for (const auto& merge : merges) {
+    const int64_t length = merge.end - merge.begin;
+    const int64_t num_segments =
+        ctx->use_threads() ? std::max<int64_t>(1, length / kMinParallelSortLength) : 1;
+    for (int64_t i = 0; i < num_segments; ++i) {
+      segments.push_back(
+          {&merge, length * i / num_segments, length * (i + 1) / num_segments});
+    }
+  }
+  const auto num_segments = static_cast<int>(segments.size());
+  const bool use_threads = ctx->use_threads() && num_segments > 1;
+  auto executor = GetSortExecutor(ctx);
+
+  RETURN_NOT_OK(SortParallelFor(
+      use_threads, num_segments,
+      [&](int i) {
+        const auto& segment = segments[i];
+        const auto& merge = *segment.merge;
+        const int64_t left_length = merge.middle - merge.begin;
+        const int64_t right_length = merge.end - merge.middle;
+        auto compare = make_comparator();
+        const int64_t left_begin =
+            MergePathSplit(merge.begin, left_length, merge.middle, right_length,
+                           segment.out_begin, compare);
+        const int64_t left_end =
+            MergePathSplit(merge.begin, left_length, merge.middle, right_length,
+                           segment.out_end, compare);
+        std::merge(merge.begin + left_begin, merge.begin + left_end,
+                   merge.middle + (segment.out_begin - left_begin),
+                   merge.middle + (segment.out_end - left_end),
+                   temp_indices + (merge.begin - indices_begin) + segment.out_begin,
+                   compare);
+        return Status::OK();
+      },
+      executor));
+
+  // Copy back temp area into main buffer
+  return SortParallelFor(
+      use_threads, num_segments,
+      [&](int i) {
+        const auto& segment = segments[i];
+        const auto* temp_begin = temp_indices + (segment.merge->begin - indices_begin);
+        std::copy(temp_begin + segment.out_begin, temp_begin + segment.out_end,
+                  segment.merge->begin + segment.out_begin);
+        return Status::OK();
+      },
+      executor);
+}
+
+// Merge adjacent sorted runs, delimited by `run_bounds`, pairwise until
+// a single sorted run remains.  `temp_indices` must provide as much room as
+// the whole range of runs.
+template <typename MakeComparator>
+Status MergeSortedRuns(ExecContext* ctx, std::vector<uint64_t*> run_bounds,
+                       uint64_t* temp_indices, MakeComparator&& make_comparator) {
+  while (run_bounds.size() > 2) {
+    std::vector<MergeRange> merges;
+    std::vector<uint64_t*> next_bounds;
+    size_t i = 0;
+    for (; i + 2 < run_bounds.size(); i += 2) {
+      merges.push_back({run_bounds[i], run_bounds[i + 1], run_bounds[i + 2]});
+      next_bounds.push_back(run_bounds[i]);
+    }
+    for (; i < run_bounds.size(); ++i) {
+      next_bounds.push_back(run_bounds[i]);
+    }
+    RETURN_NOT_OK(
+        MergeRanges(ctx, merges, run_bounds.front(), temp_indices, make_comparator));
+    run_bounds = std::move(next_bounds);
+  }
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // ChunkedArray sorting implementations
 
@@ -831,9 +1008,9 @@ class ChunkedArrayCompareSorter {
 
 // Sort a chunked array by sorting each array in the chunked array.
 //
-// TODO: This is a naive implementation. We'll be able to improve
-// performance of this. For example, we'll be able to use threads for
-// sorting each array.
+// Chunks are sorted independently, then merged by pairs.  If threads are
+// allowed, chunks are sorted in parallel and each level of merges is split
+// into independent tasks (see MergeRanges).
 class ChunkedArraySorter : public TypeVisitor {
  public:
   ChunkedArraySorter(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end,
@@ -872,51 +1049,57 @@ class ChunkedArraySorter : public TypeVisitor {
 
     if (can_use_array_sorter_) {
       // Sort each chunk independently and merge to sorted indices.
-      // This is a serial implementation.
-      ArraySorter<Type> sorter;
       std::vector<NullPartitionResult> sorted(num_chunks);
-
-      // First sort all individual chunks
-      int64_t begin_offset = 0;
-      int64_t end_offset = 0;
+      std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
       int64_t null_count = 0;
       for (int i = 0; i < num_chunks; ++i) {
-        const auto array = checked_cast<const ArrayType*>(arrays[i]);
-        end_offset += array->length();
-        null_count += array->null_count();
-        sorted[i] =
-            sorter.impl.Sort(indices_begin_ + begin_offset, indices_begin_ + end_offset,
-                             *array, begin_offset, options);
-        begin_offset = end_offset;
+        chunk_offsets[i + 1] = chunk_offsets[i] + arrays[i]->length();
+        null_count += arrays[i]->null_count();
       }
-      DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
+      DCHECK_EQ(chunk_offsets[num_chunks], indices_end_ - indices_begin_);
+
+      // First sort all individual chunks
+      const bool use_threads = ctx_->use_threads() && num_chunks > 1 &&
+                               chunk_offsets[num_chunks] >= kMinParallelSortLength;
+      RETURN_NOT_OK(SortParallelFor(
+          use_threads, num_chunks,
+          [&](int i) {
+            ArraySorter<Type> sorter;
+            sorted[i] = sorter.impl.Sort(indices_begin_ + chunk_offsets[i],
+                                         indices_begin_ + chunk_offsets[i + 1],
+                                         checked_cast<const ArrayType&>(*arrays[i]),
+                                         chunk_offsets[i], options);
+            return Status::OK();
+          },
+          GetSortExecutor(ctx_)));
 
       std::unique_ptr<Buffer> temp_buffer;
       uint64_t* temp_indices = nullptr;
       if (sorted.size() > 1) {
         ARROW_ASSIGN_OR_RAISE(
             temp_buffer,
-            AllocateBuffer(sizeof(int64_t) * (indices_end_ - indices_begin_ - null_count),
+            AllocateBuffer(sizeof(int64_t) * (indices_end_ - indices_begin_),
                            ctx_->memory_pool()));
         temp_indices = reinterpret_cast<uint64_t*>(temp_buffer->mutable_data());
       }
 
       // Then merge them by pairs, recursively
       while (sorted.size() > 1) {
+        std::vector<MergeRange> merges;
         auto out_it = sorted.begin();
         auto it = sorted.begin();
         while (it < sorted.end() - 1) {
           const auto& left = *it++;
           const auto& right = *it++;
           DCHECK_EQ(left.overall_end(), right.overall_begin());
-          const auto merged =
-              Merge<ArrayType>(left, right, arrays, null_count, temp_indices);
+          const auto merged = Merge<ArrayType>(left, right, arrays, null_count, &merges);
           *out_it++ = merged;
         }
         if (it < sorted.end()) {
           *out_it++ = *it++;
         }
         sorted.erase(out_it, sorted.end());
+        RETURN_NOT_OK(MergeNonNulls<ArrayType>(merges, arrays, temp_indices));
       }
       DCHECK_EQ(sorted.size(), 1);
       DCHECK_EQ(sorted[0].overall_begin(), indices_begin_);
@@ -932,16 +1115,19 @@ class ChunkedArraySorter : public TypeVisitor {
     return Status::OK();
   }
 
-  // Merge two adjacent sorted indices arrays
+  // Merge the null partitions of two adjacent sorted indices arrays.
+  //
+  // The merge of non-null values is deferred and appended to `merges`,
+  // so that all merges of a given level can be processed together.
   template <typename ArrayType>
   NullPartitionResult Merge(const NullPartitionResult& left,
                             const NullPartitionResult& right,
                             const std::vector<const Array*>& arrays, int64_t null_count,
-                            uint64_t* temp_indices) {
+                            std::vector<MergeRange>* merges) {
     if (null_placement_ == NullPlacement::AtStart) {
-      return MergeNullsAtStart<ArrayType>(left, right, arrays, null_count, temp_indices);
+      return MergeNullsAtStart<ArrayType>(left, right, arrays, null_count, merges);
     } else {
-      return MergeNullsAtEnd<ArrayType>(left, right, arrays, null_count, temp_indices);
+      return MergeNullsAtEnd<ArrayType>(left, right, arrays, null_count, merges);
     }
   }
 
@@ -949,7 +1135,8 @@ class ChunkedArraySorter : public TypeVisitor {
   NullPartitionResult MergeNullsAtStart(const NullPartitionResult& left,
                                         const NullPartitionResult& right,
                                         const std::vector<const Array*>& arrays,
-                                        int64_t null_count, uint64_t* temp_indices) {
+                                        int64_t null_count,
+                                        std::vector<MergeRange>* merges) {
     // Input layout:
     // [left nulls .... left non-nulls .... right nulls .... right non-nulls]
     DCHECK_EQ(left.nulls_end, left.non_nulls_begin);
@@ -973,11 +1160,10 @@ class ChunkedArraySorter : public TypeVisitor {
                                             null_placement_);
     }
 
-    // Merge the non-null values into temp area
+    // The non-null values still need merging
     DCHECK_EQ(right.non_nulls_begin - p.non_nulls_begin, left.non_null_count());
     DCHECK_EQ(p.non_nulls_end - right.non_nulls_begin, right.non_null_count());
-    MergeNonNulls<ArrayType>(p.non_nulls_begin, right.non_nulls_begin, p.non_nulls_end,
-                             arrays, temp_indices);
+    merges->push_back({p.non_nulls_begin, right.non_nulls_begin, p.non_nulls_end});
     return p;
   }
 
@@ -985,7 +1171,8 @@ class ChunkedArraySorter : public TypeVisitor {
   NullPartitionResult MergeNullsAtEnd(const NullPartitionResult& left,
                                       const NullPartitionResult& right,
                                       const std::vector<const Array*>& arrays,
-                                      int64_t null_count, uint64_t* temp_indices) {
+                                      int64_t null_count,
+                                      std::vector<MergeRange>* merges) {
     // Input layout:
     // [left non-nulls .... left nulls .... right non-nulls .... right nulls]
     DCHECK_EQ(left.non_nulls_end, left.nulls_begin);
@@ -1009,40 +1196,29 @@ class ChunkedArraySorter : public TypeVisitor {
                                             null_placement_);
     }
 
-    // Merge the non-null values into temp area
+    // The non-null values still need merging
     DCHECK_EQ(left.non_nulls_end - p.non_nulls_begin, left.non_null_count());
     DCHECK_EQ(p.non_nulls_end - left.non_nulls_end, right.non_null_count());
-    MergeNonNulls<ArrayType>(p.non_nulls_begin, left.non_nulls_end, p.non_nulls_end,
-                             arrays, temp_indices);
+    merges->push_back({p.non_nulls_begin, left.non_nulls_end, p.non_nulls_end});
     return p;
   }
 
   template <typename ArrayType>
-  void MergeNonNulls(uint64_t* range_begin, uint64_t* range_middle, uint64_t* range_end,
-                     const std::vector<const Array*>& arrays, uint64_t* temp_indices) {
-    const ChunkedArrayResolver left_resolver(arrays);
-    const ChunkedArrayResolver right_resolver(arrays);
-
-    if (order_ == SortOrder::Ascending) {
-      std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
-                 [&](uint64_t left, uint64_t right) {
-                   const auto chunk_left = left_resolver.Resolve<ArrayType>(left);
-                   const auto chunk_right = right_resolver.Resolve<ArrayType>(right);
-                   return chunk_left.Value() < chunk_right.Value();
-                 });
-    } else {
-      std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
-                 [&](uint64_t left, uint64_t right) {
-                   const auto chunk_left = left_resolver.Resolve<ArrayType>(left);
-                   const auto chunk_right = right_resolver.Resolve<ArrayType>(right);
-                   // We don't use 'left > right' here to reduce required
-                   // operator. If we use 'right < left' here, '<' is only
-                   // required.
-                   return chunk_right.Value() < chunk_left.Value();
-                 });
-    }
-    // Copy back temp area into main buffer
-    std::copy(temp_indices, temp_indices + (range_end - range_begin), range_begin);
+  Status MergeNonNulls(const std::vector<MergeRange>& merges,
+                       const std::vector<const Array*>& arrays, uint64_t* temp_indices) {
+    const bool ascending = order_ == SortOrder::Ascending;
+    return MergeRanges(ctx_, merges, indices_begin_, temp_indices, [&]() {
+      const ChunkedArrayResolver left_resolver(arrays);
+      const ChunkedArrayResolver right_resolver(arrays);
+      return [left_resolver, right_resolver, ascending](uint64_t left, uint64_t right) {
+        const auto chunk_left = left_resolver.Resolve<ArrayType>(left);
+        const auto chunk_right = right_resolver.Resolve<ArrayType>(right);
+        // We don't use 'left > right' here to reduce required operator.
+        // If we use 'right < left' here, '<' is only required.
+        return ascending ? chunk_left.Value() < chunk_right.Value()
+                         : chunk_right.Value() < chunk_left.Value();
+      };
+    });
   }
 
   uint64_t* indices_begin_;
@@ -1635,9 +1811,11 @@ class MultipleKeyTableSorter : public TypeVisitor {
   using Comparator = MultipleKeyComparator<ResolvedSortKey>;
 
  public:
-  MultipleKeyTableSorter(uint64_t* indices_begin, uint64_t* indices_end,
-                         const Table& table, const SortOptions& options)
-      : indices_begin_(indices_begin),
+  MultipleKeyTableSorter(ExecContext* ctx, uint64_t* indices_begin,
+                         uint64_t* indices_end, const Table& table,
+                         const SortOptions& options)
+      : ctx_(ctx),
+        indices_begin_(indices_begin),
         indices_end_(indices_end),
         sort_keys_(ResolveSortKeys(table, options.sort_keys, &status_)),
         null_placement_(options.null_placement),
@@ -1674,35 +1852,107 @@ class MultipleKeyTableSorter : public TypeVisitor {
     return resolved;
   }
 
+  // Comparison state for sorting non-null values of the first sort key.
+  //
+  // Chunk resolvers cache the last accessed chunk and the comparator keeps
+  // per-call state, so each task needs its own copy of this.
+  template <typename ArrayType>
+  class RowComparator {
+   public:
+    RowComparator(const std::vector<ResolvedSortKey>& sort_keys,
+                  NullPlacement null_placement)
+        : sort_keys_(sort_keys), comparator_(sort_keys_, null_placement) {}
+
+    ARROW_DISALLOW_COPY_AND_ASSIGN(RowComparator);
+
+    bool operator()(uint64_t left, uint64_t right) {
+      // Both values are never null nor NaN.
+      const auto& first_sort_key = sort_keys_[0];
+      auto chunk_left = first_sort_key.template GetChunk<ArrayType>(left);
+      auto chunk_right = first_sort_key.template GetChunk<ArrayType>(right);
+      auto value_left = chunk_left.Value();
+      auto value_right = chunk_right.Value();
+      if (value_left == value_right) {
+        // If the left value equals to the right value,
+        // we need to compare the second and following
+        // sort keys.
+        return comparator_.Compare(left, right, 1);
+      } else {
+        auto compared = value_left < value_right;
+        if (first_sort_key.order == SortOrder::Ascending) {
+          return compared;
+        } else {
+          return !compared;
+        }
+      }
+    }
+
+    Status status() const { return comparator_.status(); }
+
+   private:
+    const std::vector<ResolvedSortKey> sort_keys_;
+    Comparator comparator_;
+  };
+
   template <typename Type>
   Status SortInternal() {
     using ArrayType = typename TypeTraits<Type>::ArrayType;
 
-    auto& comparator = comparator_;
     const auto& first_sort_key = sort_keys_[0];
     const auto p = PartitionNullsInternal<Type>(first_sort_key);
-
-    std::stable_sort(p.non_nulls_begin, p.non_nulls_end,
-                     [&](uint64_t left, uint64_t right) {
-                       // Both values are never null nor NaN.
-                       auto chunk_left = first_sort_key.GetChunk<ArrayType>(left);
-                       auto chunk_right = first_sort_key.GetChunk<ArrayType>(right);
-                       auto value_left = chunk_left.Value();
-                       auto value_right = chunk_right.Value();
-                       if (value_left == value_right) {
-                         // If the left value equals to the right value,
-                         // we need to compare the second and following
-                         // sort keys.
-                         return comparator.Compare(left, right, 1);
-                       } else {
-                         auto compared = value_left < value_right;
-                         if (first_sort_key.order == SortOrder::Ascending) {
-                           return compared;
-                         } else {
-                           return !compared;
-                         }
-                       }
-                     });
+    const int64_t num_non_nulls = p.non_nulls_end - p.non_nulls_begin;
+
+    // Sort the non-null values as independent runs, then merge the runs.
+    auto executor = GetSortExecutor(ctx_);
+    int64_t num_runs = 1;
+    if (ctx_->use_threads() && num_non_nulls >= 2 * kMinParallelSortLength) {
+      num_runs = std::min<int64_t>(num_non_nulls / kMinParallelSortLength,
+                                   std::max(2, executor->GetCapacity()));
+    }
+    std::vector<uint64_t*> run_bounds(num_runs + 1);
+    for (int64_t i = 0; i <= num_runs; ++i) {
+      run_bounds[i] = p.non_nulls_begin + num_non_nulls * i / num_runs;
+    }
+
+    // RowComparator is not copyable, so share it between copies of
+    // the comparison function (which are all used from the same task).
+    // The comparators are kept to collect their errors after the merge.
+    std::mutex merge_comparators_mutex;
+    std::vector<std::shared_ptr<RowComparator<ArrayType>>> merge_comparators;
+    auto make_comparator = [&]() {
+      auto comparator =
+          std::make_shared<RowComparator<ArrayType>>(sort_keys_, null_placement_);
+      {
+        std::lock_guard<std::mutex> lock(merge_comparators_mutex);
+        merge_comparators.push_back(comparator);
+      }
+      return [comparator](uint64_t left, uint64_t right) {
+        return (*comparator)(left, right);
+      };
+    };
+    RETURN_NOT_OK(SortParallelFor(
+        num_runs > 1, static_cast<int>(num_runs),
+        [&](int i) {
+          RowComparator<ArrayType> comparator(sort_keys_, null_placement_);
+          std::stable_sort(run_bounds[i], run_bounds[i + 1],
+                           [&](uint64_t left, uint64_t right) {
+                             return comparator(left, right);
+                           });
+          return comparator.status();
+        },
+        executor));
+
+    if (num_runs > 1) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto temp_buffer,
+          AllocateBuffer(sizeof(int64_t) * num_non_nulls, ctx_->memory_pool()));
+      auto temp_indices = reinterpret_cast<uint64_t*>(temp_buffer->mutable_data());
+      RETURN_NOT_OK(MergeSortedRuns(ctx_, std::move(run_bounds), temp_indices,
+                                    make_comparator));
+      for (const auto& comparator : merge_comparators) {
+        RETURN_NOT_OK(comparator->status());
+      }
+    }
     return comparator_.status();
   }
 
@@ -1733,6 +1983,7 @@ class MultipleKeyTableSorter : public TypeVisitor {
     return q;
   }
 
+  ExecContext* ctx_;
   uint64_t* indices_begin_;
   uint64_t* indices_end_;
   Status status_;
@@ -1900,7 +2151,7 @@ class SortIndicesMetaFunction : public MetaFunction {
     //
     // TableRadixSorter sorter;
     // ARROW_RETURN_NOT_OK(sorter.Sort(ctx, out_begin, out_end, table, options));
-    MultipleKeyTableSorter sorter(out_begin, out_end, table, options);
+    MultipleKeyTableSorter sorter(ctx, out_begin, out_end, table, options);
     ARROW_RETURN_NOT_OK(sorter.Sort());
     return Datum(out);
   }
@@ -31,11 +31,13 @@
 #include "arrow/result.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -982,6 +984,49 @@ class TestChunkedArrayRandomNarrow : public TestChunkedArrayRandomBase<Type> {
 TYPED_TEST_SUITE(TestChunkedArrayRandomNarrow, IntegralArrowTypes);
 TYPED_TEST(TestChunkedArrayRandomNarrow, SortIndices) { this->TestSortIndices(1000); }
 
+// Large enough for chunks to be sorted and merged in parallel
+TEST_F(TestChunkedArraySortIndices, Parallel) {
+  const int64_t length = 300000;
+  ::arrow::random::RandomArrayGenerator rng(0x5487655);
+  const ArrayVector columns = {
+      rng.Int64(length, -1000, 1000, /*null_probability=*/0.1),
+      rng.Float64(length, -1.0, 1.0, /*null_probability=*/0.1,
+                  /*nan_probability=*/0.1),
+      rng.StringWithRepeats(length, /*unique=*/1000, /*min_length=*/5,
+                            /*max_length=*/15, /*null_probability=*/0.1),
+  };
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext parallel_ctx;
+  parallel_ctx.set_use_threads(true);
+
+  for (const auto& column : columns) {
+    ARROW_SCOPED_TRACE("type = ", column->type()->ToString());
+    for (const int64_t num_chunks : {2, 7, 16}) {
+      ARROW_SCOPED_TRACE("num_chunks = ", num_chunks);
+      ArrayVector chunks;
+      const int64_t chunk_length = length / num_chunks;
+      for (int64_t i = 0; i < num_chunks; ++i) {
+        const int64_t offset = i * chunk_length;
+        chunks.push_back(column->Slice(
+            offset, i + 1 < num_chunks ? chunk_length : length - offset));
+      }
+      ASSERT_OK_AND_ASSIGN(auto chunked_array, ChunkedArray::Make(chunks));
+      for (auto order : AllOrders()) {
+        for (auto null_placement : AllNullPlacements()) {
+          ArraySortOptions options(order, null_placement);
+          ASSERT_OK_AND_ASSIGN(auto expected,
+                               SortIndices(*chunked_array, options, &serial_ctx));
+          ASSERT_OK_AND_ASSIGN(auto actual,
+                               SortIndices(*chunked_array, options, &parallel_ctx));
+          // The sort is stable, so results must be identical
+          AssertArraysEqual(*expected, *actual);
+        }
+      }
+    }
+  }
+}
+
 // Test basic cases for record batch.
 class TestRecordBatchSortIndices : public ::testing::Test {};
 
@@ -1607,6 +1652,73 @@ TEST_P(TestTableSortIndicesRandom, Sort) {
   }
 }
 
+// Large enough for runs to be sorted and merged in parallel
+TEST_F(TestTableSortIndices, Parallel) {
+  const int64_t length = 300000;
+  ::arrow::random::RandomArrayGenerator rng(0x61549225);
+  const auto table =
+      Table::Make(schema({field("a", int32()), field("b", utf8())}),
+                  {rng.Int32(length, 0, 100, /*null_probability=*/0.1),
+                   rng.StringWithRepeats(length, /*unique=*/1000, /*min_length=*/5,
+                                         /*max_length=*/15, /*null_probability=*/0.1)},
+                  length);
+  TableBatchReader reader(*table);
+  reader.set_chunksize(length / 10);
+  ASSERT_OK_AND_ASSIGN(auto chunked_table, Table::FromRecordBatchReader(&reader));
+
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext parallel_ctx;
+  parallel_ctx.set_use_threads(true);
+
+  for (auto null_placement : AllNullPlacements()) {
+    SortOptions options({SortKey("a", SortOrder::Descending), SortKey("b")},
+                        null_placement);
+    ASSERT_OK_AND_ASSIGN(auto expected,
+                         SortIndices(Datum(*chunked_table), options, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         SortIndices(Datum(*chunked_table), options, &parallel_ctx));
+    // The sort is stable, so results must be identical
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
+// Sorting from a task of the ExecContext executor must not wait on the tasks
+// queued behind it
+TEST_F(TestTableSortIndices, ParallelFromExecutorTask) {
+  const int64_t length = 200000;
+  ::arrow::random::RandomArrayGenerator rng(0x3948a1);
+  const auto a = rng.Int64(length, -1000, 1000, /*null_probability=*/0.1);
+  const auto b = rng.Int32(length, 0, 100, /*null_probability=*/0.1);
+  ASSERT_OK_AND_ASSIGN(auto chunked_a, ChunkedArray::Make({a->Slice(0, length / 2),
+                                                           a->Slice(length / 2)}));
+  ASSERT_OK_AND_ASSIGN(auto chunked_b, ChunkedArray::Make({b->Slice(0, length / 2),
+                                                           b->Slice(length / 2)}));
+  const auto table = Table::Make(schema({field("a", int64()), field("b", int32())}),
+                                 {chunked_a, chunked_b});
+
+  ASSERT_OK_AND_ASSIGN(auto pool, ::arrow::internal::ThreadPool::Make(1));
+  ExecContext ctx(default_memory_pool(), pool.get());
+  ctx.set_use_threads(true);
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+
+  ASSERT_OK_AND_ASSIGN(auto expected, SortIndices(*chunked_a, ArraySortOptions(),
+                                                  &serial_ctx));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto actual, DeferNotOk(pool->Submit([&] {
+                                  return SortIndices(*chunked_a, ArraySortOptions(),
+                                                     &ctx);
+                                })));
+  AssertArraysEqual(*expected, *actual);
+
+  SortOptions options({SortKey("a"), SortKey("b", SortOrder::Descending)});
+  ASSERT_OK_AND_ASSIGN(expected, SortIndices(Datum(table), options, &serial_ctx));
+  ASSERT_FINISHES_OK_AND_ASSIGN(actual, DeferNotOk(pool->Submit([&] {
+                                  return SortIndices(Datum(table), options, &ctx);
+                                })));
+  AssertArraysEqual(*expected, *actual);
+}
+
 // Some first keys will have duplicates, others not
 static const auto first_sort_keys = testing::Values("uint8", "int16", "uint64", "float",
                                                     "boolean", "string", "decimal128");
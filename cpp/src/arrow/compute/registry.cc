@@ -179,6 +179,7 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
   RegisterScalarAggregateMode(registry.get());
   RegisterScalarAggregateQuantile(registry.get());
   RegisterScalarAggregateTDigest(registry.get());
+  RegisterScalarAggregateApproximateCountDistinct(registry.get());
   RegisterScalarAggregateVariance(registry.get());
   RegisterHashAggregateBasic(registry.get());
 
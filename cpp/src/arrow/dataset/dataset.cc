@@ -60,6 +60,15 @@ Future<util::optional<int64_t>> Fragment::CountRows(compute::Expression,
   return Future<util::optional<int64_t>>::MakeFinished(util::nullopt);
 }
 
+Future<FragmentStatistics> Fragment::GetStatistics(compute::Expression,
+                                                   const std::vector<FieldRef>& columns,
+                                                   const std::shared_ptr<ScanOptions>&) {
+  FragmentStatistics statistics;
+  statistics.columns.resize(columns.size());
+  statistics.remainder = shared_from_this();
+  return Future<FragmentStatistics>::MakeFinished(std::move(statistics));
+}
+
 Result<std::shared_ptr<Schema>> InMemoryFragment::ReadPhysicalSchemaImpl() {
   return physical_schema_;
 }
@@ -37,6 +37,25 @@ namespace dataset {
 
 using RecordBatchGenerator = std::function<Future<std::shared_ptr<RecordBatch>>()>;
 
+/// \brief Statistics of the rows of a Fragment matching a predicate, as recorded in
+/// metadata (e.g. Parquet row group statistics).
+struct ARROW_DS_EXPORT FragmentStatistics {
+  /// \brief Statistics of a single column
+  struct ColumnStatistics {
+    /// The number of null values
+    int64_t null_count = 0;
+    /// The smallest and largest non-null values, or null if all values are null
+    std::shared_ptr<Scalar> min, max;
+  };
+
+  /// The number of rows summarized by these statistics
+  int64_t num_rows = 0;
+  /// Statistics of each requested column over the summarized rows
+  std::vector<ColumnStatistics> columns;
+  /// The rows which could not be summarized and must be scanned instead, if any
+  std::shared_ptr<Fragment> remainder;
+};
+
 /// \brief A granular piece of a Dataset, such as an individual file.
 ///
 /// A Fragment can be read/scanned separately from other fragments. It yields a
@@ -79,6 +98,17 @@ class ARROW_DS_EXPORT Fragment : public std::enable_shared_from_this<Fragment> {
   virtual Future<util::optional<int64_t>> CountRows(
       compute::Expression predicate, const std::shared_ptr<ScanOptions>& options);
 
+  /// \brief Summarize the rows in this fragment matching the filter using metadata
+  /// only. That is, this method may perform I/O, but will not load data.
+  ///
+  /// Rows which cannot be summarized, for instance because they only partially match
+  /// the predicate or lack statistics for one of the columns, are returned as a
+  /// remainder Fragment to be scanned. The default implementation summarizes no rows
+  /// and returns the whole fragment as the remainder.
+  virtual Future<FragmentStatistics> GetStatistics(
+      compute::Expression predicate, const std::vector<FieldRef>& columns,
+      const std::shared_ptr<ScanOptions>& options);
+
   virtual std::string type_name() const = 0;
   virtual std::string ToString() const { return type_name(); }
 
@@ -95,6 +95,15 @@ Future<util::optional<int64_t>> FileFormat::CountRows(
   return Future<util::optional<int64_t>>::MakeFinished(util::nullopt);
 }
 
+Future<FragmentStatistics> FileFormat::GetStatistics(
+    const std::shared_ptr<FileFragment>& file, compute::Expression,
+    const std::vector<FieldRef>& columns, const std::shared_ptr<ScanOptions>&) {
+  FragmentStatistics statistics;
+  statistics.columns.resize(columns.size());
+  statistics.remainder = file;
+  return Future<FragmentStatistics>::MakeFinished(std::move(statistics));
+}
+
 Result<std::shared_ptr<FileFragment>> FileFormat::MakeFragment(
     FileSource source, std::shared_ptr<Schema> physical_schema) {
   return MakeFragment(std::move(source), compute::literal(true),
@@ -191,6 +200,20 @@ Future<util::optional<int64_t>> FileFragment::CountRows(
   return format()->CountRows(self, std::move(predicate), options);
 }
 
+Future<FragmentStatistics> FileFragment::GetStatistics(
+    compute::Expression predicate, const std::vector<FieldRef>& columns,
+    const std::shared_ptr<ScanOptions>& options) {
+  ARROW_ASSIGN_OR_RAISE(predicate, compute::SimplifyWithGuarantee(std::move(predicate),
+                                                                  partition_expression_));
+  if (!predicate.IsSatisfiable()) {
+    FragmentStatistics statistics;
+    statistics.columns.resize(columns.size());
+    return Future<FragmentStatistics>::MakeFinished(std::move(statistics));
+  }
+  auto self = checked_pointer_cast<FileFragment>(shared_from_this());
+  return format()->GetStatistics(self, std::move(predicate), columns, options);
+}
+
 struct FileSystemDataset::FragmentSubtrees {
   // Forest for skipping fragments based on extracted subtree expressions
   compute::Forest forest;
@@ -99,6 +99,10 @@ class ARROW_DS_EXPORT FileSource {
     return filesystem_ ? file_info_.path() : buffer_ ? buffer_path : custom_open_path;
   }
 
+  /// \brief Return the file info, if any. Only valid when file source wraps a path;
+  /// its size and modification time may be unknown.
+  const fs::FileInfo& file_info() const { return file_info_; }
+
   /// \brief Return the filesystem, if any. Otherwise returns nullptr
   const std::shared_ptr<fs::FileSystem>& filesystem() const { return filesystem_; }
 
@@ -159,6 +163,9 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
   virtual Future<util::optional<int64_t>> CountRows(
       const std::shared_ptr<FileFragment>& file, compute::Expression predicate,
       const std::shared_ptr<ScanOptions>& options);
+  virtual Future<FragmentStatistics> GetStatistics(
+      const std::shared_ptr<FileFragment>& file, compute::Expression predicate,
+      const std::vector<FieldRef>& columns, const std::shared_ptr<ScanOptions>& options);
 
   /// \brief Open a fragment
   virtual Result<std::shared_ptr<FileFragment>> MakeFragment(
@@ -192,6 +199,9 @@ class ARROW_DS_EXPORT FileFragment : public Fragment {
   Future<util::optional<int64_t>> CountRows(
       compute::Expression predicate,
       const std::shared_ptr<ScanOptions>& options) override;
+  Future<FragmentStatistics> GetStatistics(
+      compute::Expression predicate, const std::vector<FieldRef>& columns,
+      const std::shared_ptr<ScanOptions>& options) override;
 
   std::string type_name() const override { return format_->type_name(); }
   std::string ToString() const override { return source_.path(); };
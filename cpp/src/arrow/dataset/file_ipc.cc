@@ -25,8 +25,11 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/io/file.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -43,10 +46,26 @@ static inline ipc::IpcReadOptions default_read_options() {
   return options;
 }
 
+// Whether the file should be memory-mapped rather than opened through its filesystem
+static inline bool UseMemoryMap(const FileSource& source,
+                                const IpcFragmentScanOptions* ipc_scan_options) {
+  return ipc_scan_options != nullptr && ipc_scan_options->use_mmap &&
+         source.filesystem() != nullptr && source.filesystem()->type_name() == "local";
+}
+
+static inline Result<std::shared_ptr<io::RandomAccessFile>> OpenInput(
+    const FileSource& source, const IpcFragmentScanOptions* ipc_scan_options) {
+  if (UseMemoryMap(source, ipc_scan_options)) {
+    return io::MemoryMappedFile::Open(source.path(), io::FileMode::READ);
+  }
+  return source.Open();
+}
+
 static inline Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
     const FileSource& source,
-    const ipc::IpcReadOptions& options = default_read_options()) {
-  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+    const ipc::IpcReadOptions& options = default_read_options(),
+    const IpcFragmentScanOptions* ipc_scan_options = nullptr) {
+  ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, ipc_scan_options));
 
   std::shared_ptr<ipc::RecordBatchFileReader> reader;
 
@@ -88,12 +107,15 @@ static inline Result<std::vector<int>> GetIncludedFields(
   return included_fields;
 }
 
+static inline Result<std::shared_ptr<IpcFragmentScanOptions>> GetIpcScanOptions(
+    const FileFormat& format, const ScanOptions& scan_options) {
+  return GetFragmentScanOptions<IpcFragmentScanOptions>(
+      kIpcTypeName, &scan_options, format.default_fragment_scan_options);
+}
+
 static inline Result<ipc::IpcReadOptions> GetReadOptions(
     const Schema& schema, const FileFormat& format, const ScanOptions& scan_options) {
-  ARROW_ASSIGN_OR_RAISE(
-      auto ipc_scan_options,
-      GetFragmentScanOptions<IpcFragmentScanOptions>(
-          kIpcTypeName, &scan_options, format.default_fragment_scan_options));
+  ARROW_ASSIGN_OR_RAISE(auto ipc_scan_options, GetIpcScanOptions(format, scan_options));
   auto options =
       ipc_scan_options->options ? *ipc_scan_options->options : default_read_options();
   options.memory_pool = scan_options.pool;
@@ -108,6 +130,74 @@ static inline Result<ipc::IpcReadOptions> GetReadOptions(
   return options;
 }
 
+/// \brief Synchronously read the record batches of an Ipc file, in batch_size chunks.
+class IpcRecordBatchIterator {
+ public:
+  /// If lazy is true, the file is only opened on the first call to Next().
+  static Result<RecordBatchIterator> Make(FileSource source,
+                                          std::shared_ptr<const FileFormat> format,
+                                          std::shared_ptr<ScanOptions> scan_options,
+                                          bool lazy = false) {
+    IpcRecordBatchIterator it(std::move(source), std::move(format),
+                              std::move(scan_options));
+    if (!lazy) {
+      RETURN_NOT_OK(it.Open());
+    }
+    return RecordBatchIterator(std::move(it));
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (!reader_) {
+      RETURN_NOT_OK(Open());
+    }
+    if (leftover_) {
+      if (leftover_->num_rows() > batch_size_) {
+        auto chunk = leftover_->Slice(0, batch_size_);
+        leftover_ = leftover_->Slice(batch_size_);
+        return chunk;
+      }
+      return std::move(leftover_);
+    }
+    if (i_ == reader_->num_record_batches()) {
+      return nullptr;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader_->ReadRecordBatch(i_++));
+    if (batch->num_rows() > batch_size_) {
+      leftover_ = batch->Slice(batch_size_);
+      return batch->Slice(0, batch_size_);
+    }
+    return batch;
+  }
+
+ private:
+  IpcRecordBatchIterator(FileSource source, std::shared_ptr<const FileFormat> format,
+                         std::shared_ptr<ScanOptions> scan_options)
+      : source_(std::move(source)),
+        format_(std::move(format)),
+        scan_options_(std::move(scan_options)),
+        batch_size_(scan_options_->batch_size) {}
+
+  Status Open() {
+    ARROW_ASSIGN_OR_RAISE(auto ipc_scan_options,
+                          GetIpcScanOptions(*format_, *scan_options_));
+    ARROW_ASSIGN_OR_RAISE(
+        auto reader, OpenReader(source_, default_read_options(), ipc_scan_options.get()));
+    ARROW_ASSIGN_OR_RAISE(auto options,
+                          GetReadOptions(*reader->schema(), *format_, *scan_options_));
+    ARROW_ASSIGN_OR_RAISE(reader_, OpenReader(source_, options, ipc_scan_options.get()));
+    return Status::OK();
+  }
+
+  FileSource source_;
+  std::shared_ptr<const FileFormat> format_;
+  std::shared_ptr<ScanOptions> scan_options_;
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  const int64_t batch_size_;
+  std::shared_ptr<RecordBatch> leftover_;
+  int i_ = 0;
+};
+
 /// \brief A ScanTask backed by an Ipc file.
 class IpcScanTask : public ScanTask {
  public:
@@ -116,47 +206,8 @@ class IpcScanTask : public ScanTask {
       : ScanTask(std::move(options), fragment), source_(fragment->source()) {}
 
   Result<RecordBatchIterator> Execute() override {
-    struct Impl {
-      static Result<RecordBatchIterator> Make(const FileSource& source,
-                                              const FileFormat& format,
-                                              const ScanOptions& scan_options) {
-        ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
-        ARROW_ASSIGN_OR_RAISE(auto options,
-                              GetReadOptions(*reader->schema(), format, scan_options));
-        ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, options));
-        return RecordBatchIterator(
-            Impl{std::move(reader), scan_options.batch_size, nullptr, 0});
-      }
-
-      Result<std::shared_ptr<RecordBatch>> Next() {
-        if (leftover_) {
-          if (leftover_->num_rows() > batch_size) {
-            auto chunk = leftover_->Slice(0, batch_size);
-            leftover_ = leftover_->Slice(batch_size);
-            return chunk;
-          }
-          return std::move(leftover_);
-        }
-        if (i_ == reader_->num_record_batches()) {
-          return nullptr;
-        }
-
-        ARROW_ASSIGN_OR_RAISE(auto batch, reader_->ReadRecordBatch(i_++));
-        if (batch->num_rows() > batch_size) {
-          leftover_ = batch->Slice(batch_size);
-          return batch->Slice(0, batch_size);
-        }
-        return batch;
-      }
-
-      std::shared_ptr<ipc::RecordBatchFileReader> reader_;
-      const int64_t batch_size;
-      std::shared_ptr<RecordBatch> leftover_;
-      int i_;
-    };
-
-    return Impl::Make(source_, *checked_pointer_cast<FileFragment>(fragment_)->format(),
-                      *options_);
+    return IpcRecordBatchIterator::Make(
+        source_, checked_pointer_cast<FileFragment>(fragment_)->format(), options_);
   }
 
  private:
@@ -211,6 +262,25 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
     const std::shared_ptr<FileFragment>& file) const {
   auto self = shared_from_this();
   auto source = file->source();
+
+  ARROW_ASSIGN_OR_RAISE(auto ipc_scan_options, GetIpcScanOptions(*this, *options));
+  if (UseMemoryMap(source, ipc_scan_options.get())) {
+    // Reading a record batch from a memory-mapped file neither copies nor waits
+    // on I/O, so synchronous reads replace the asynchronous reader.  Reading
+    // batch_readahead batches ahead advises the OS (madvise) to page in the
+    // projected fields of the upcoming batches.
+    ARROW_ASSIGN_OR_RAISE(
+        auto batches,
+        IpcRecordBatchIterator::Make(source, self, options, /*lazy=*/true));
+    const int max_q = std::max(1, options->batch_readahead);
+    ARROW_ASSIGN_OR_RAISE(
+        auto generator,
+        MakeBackgroundGenerator(std::move(batches), options->io_context.executor(),
+                                max_q, /*q_restart=*/std::max(1, max_q / 2)));
+    return MakeTransferredGenerator(std::move(generator),
+                                    ::arrow::internal::GetCpuThreadPool());
+  }
+
   auto open_reader = OpenReaderAsync(source);
   auto reopen_reader = [self, options,
                         source](std::shared_ptr<ipc::RecordBatchFileReader> reader)
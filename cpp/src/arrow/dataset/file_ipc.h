@@ -84,6 +84,12 @@ class ARROW_DS_EXPORT IpcFragmentScanOptions : public FragmentScanOptions {
   /// If present, the async scanner will enable I/O coalescing.
   /// This is ignored by the sync scanner.
   std::shared_ptr<io::CacheOptions> cache_options;
+  /// If true, files on the local filesystem are memory-mapped.  Record batches
+  /// then reference the mapped pages directly (unless compressed), and only the
+  /// pages of the projected fields are paged in.  The async scanner reads up to
+  /// ScanOptions::batch_readahead batches ahead, which advises the OS to read
+  /// their pages ahead.  cache_options is ignored for memory-mapped files.
+  bool use_mmap = false;
 };
 
 class ARROW_DS_EXPORT IpcFileWriteOptions : public FileWriteOptions {
@@ -27,6 +27,7 @@
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/scanner_internal.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/localfs.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
@@ -163,6 +164,48 @@ TEST_P(TestIpcFileFormatScan, FragmentScanOptions) {
   ASSERT_OK_AND_ASSIGN(auto batches, scan_task->Execute());
   ASSERT_RAISES(Invalid, batches.Next());
 }
+
+TEST_P(TestIpcFileFormatScan, ScanMemoryMapped) {
+  auto f64 = field("f64", float64());
+  auto i32 = field("i32", int32());
+  auto i64 = field("i64", int64());
+  SetSchema({f64, i64, i32});
+  Project({"f64"});
+  SetFilter(equal(field_ref("i32"), literal(0)));
+  auto expected_schema = schema({f64, i32});
+
+  // Memory mapping only applies to files of the local filesystem
+  auto reader = GetRecordBatchReader(opts_->dataset_schema);
+  ASSERT_OK_AND_ASSIGN(auto buffer, IpcFormatHelper::Write(reader.get()));
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("test-ipc-mmap-"));
+  auto path = temp_dir->path().ToString() + "data.arrow";
+  auto local_fs = std::make_shared<fs::LocalFileSystem>();
+  ASSERT_OK_AND_ASSIGN(auto sink, local_fs->OpenOutputStream(path));
+  ASSERT_OK(sink->Write(buffer));
+  ASSERT_OK(sink->Close());
+
+  auto fragment_scan_options = std::make_shared<IpcFragmentScanOptions>();
+  fragment_scan_options->use_mmap = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+  auto fragment = MakeFragment(FileSource(path, local_fs));
+
+  int64_t row_count = 0;
+  for (auto maybe_batch : PhysicalBatches(fragment)) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    row_count += batch->num_rows();
+    AssertSchemaEqual(*batch->schema(), *expected_schema, /*check_metadata=*/false);
+    // Buffers reference the read-only mapping rather than being copied
+    for (const auto& column : batch->columns()) {
+      for (const auto& column_buffer : column->data()->buffers) {
+        if (column_buffer != nullptr && column_buffer->size() > 0) {
+          ASSERT_FALSE(column_buffer->is_mutable());
+        }
+      }
+    }
+  }
+  ASSERT_EQ(row_count, expected_rows());
+}
+
 INSTANTIATE_TEST_SUITE_P(TestScan, TestIpcFileFormatScan,
                          ::testing::ValuesIn(TestFormatParams::Values()),
                          TestFormatParams::ToTestNameString);
@@ -0,0 +1,344 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+namespace dataset {
+
+namespace {
+
+using adapters::orc::ORCFileReader;
+using adapters::orc::StripeFieldStatistics;
+
+Result<std::unique_ptr<ORCFileReader>> OpenORCReader(
+    const FileSource& source, MemoryPool* pool = default_memory_pool()) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+
+  auto reader = ORCFileReader::Open(std::move(input), pool);
+  auto status = reader.status();
+  if (!status.ok()) {
+    return status.WithMessage("Could not open ORC input source '", source.path(),
+                              "': ", status.message());
+  }
+  return reader;
+}
+
+// The number of ORC columns (types) used to store a field of this type
+int NumOrcColumns(const DataType& type) {
+  if (type.id() == Type::MAP) {
+    // ORC maps have the key and item as direct children
+    const auto& map_type = checked_cast<const MapType&>(type);
+    return 1 + NumOrcColumns(*map_type.key_type()) +
+           NumOrcColumns(*map_type.item_type());
+  }
+  int num_columns = 1;
+  for (const auto& child : type.fields()) {
+    num_columns += NumOrcColumns(*child->type());
+  }
+  return num_columns;
+}
+
+// ORC selects columns by their id, which is their position in a pre-order traversal
+// of the file's type tree (the top-level struct having id 0).  Selecting a column
+// also selects its children.
+Result<std::vector<int>> GetIncludedColumnIds(
+    const Schema& schema, const std::vector<std::string>& materialized_fields) {
+  std::vector<int> column_ids(schema.num_fields());
+  int column_id = 1;
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    column_ids[i] = column_id;
+    column_id += NumOrcColumns(*schema.field(i)->type());
+  }
+
+  std::vector<int> included_ids;
+  for (FieldRef ref : materialized_fields) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(schema));
+    if (match.indices().empty()) continue;
+
+    included_ids.push_back(column_ids[match.indices()[0]]);
+  }
+  std::sort(included_ids.begin(), included_ids.end());
+  included_ids.erase(std::unique(included_ids.begin(), included_ids.end()),
+                     included_ids.end());
+  return included_ids;
+}
+
+util::optional<compute::Expression> StripeStatisticsAsExpression(
+    const Field& field, const StripeFieldStatistics& statistics) {
+  if (statistics.num_values < 0) {
+    return util::nullopt;
+  }
+
+  auto field_expr = compute::field_ref(field.name());
+
+  // Optimize for corner case where all values are nulls
+  if (statistics.num_values == 0 && statistics.has_null) {
+    return is_null(std::move(field_expr));
+  }
+
+  if (statistics.min == nullptr || statistics.max == nullptr) {
+    return util::nullopt;
+  }
+  if (statistics.min->Equals(*statistics.max)) {
+    return compute::equal(std::move(field_expr), compute::literal(statistics.min));
+  }
+
+  auto lower_bound = compute::greater_equal(field_expr, compute::literal(statistics.min));
+  auto upper_bound =
+      compute::less_equal(std::move(field_expr), compute::literal(statistics.max));
+  return compute::and_(std::move(lower_bound), std::move(upper_bound));
+}
+
+inline void FoldingAnd(compute::Expression* l, compute::Expression r) {
+  if (*l == compute::literal(true)) {
+    *l = std::move(r);
+  } else {
+    *l = and_(std::move(*l), std::move(r));
+  }
+}
+
+// Simplify the predicate against the statistics of each stripe.  A stripe whose
+// simplified predicate is not satisfiable may be skipped entirely.
+Result<std::vector<compute::Expression>> TestStripes(
+    ORCFileReader* reader, const Schema& schema, const compute::Expression& predicate) {
+  const int64_t num_stripes = reader->NumberOfStripes();
+  if (!ExpressionHasFieldRefs(predicate)) {
+    return std::vector<compute::Expression>(num_stripes, predicate);
+  }
+
+  std::vector<int> field_indices;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(schema));
+    if (match.empty()) continue;
+    field_indices.push_back(match[0]);
+  }
+
+  std::vector<compute::Expression> stripes(num_stripes);
+  for (int64_t stripe = 0; stripe < num_stripes; ++stripe) {
+    compute::Expression guarantee = compute::literal(true);
+    if (!field_indices.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto statistics, reader->ReadStripeStatistics(stripe));
+      for (int i : field_indices) {
+        if (auto minmax = StripeStatisticsAsExpression(*schema.field(i), statistics[i])) {
+          FoldingAnd(&guarantee, std::move(*minmax));
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(guarantee, guarantee.Bind(schema));
+    }
+    ARROW_ASSIGN_OR_RAISE(stripes[stripe],
+                          compute::SimplifyWithGuarantee(predicate, guarantee));
+  }
+  return stripes;
+}
+
+/// \brief An iterator over the batches of the stripes of an ORC file which may
+/// satisfy the scan filter.
+///
+/// The file is opened lazily so that all I/O happens on the thread pulling batches.
+class OrcScanBatchIterator {
+ public:
+  static RecordBatchIterator Make(FileSource source, compute::Expression predicate,
+                                  std::shared_ptr<ScanOptions> options) {
+    return RecordBatchIterator(OrcScanBatchIterator(
+        std::move(source), std::move(predicate), std::move(options)));
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (!reader_) {
+      RETURN_NOT_OK(Open());
+    }
+    while (true) {
+      if (stripe_reader_) {
+        std::shared_ptr<RecordBatch> batch;
+        RETURN_NOT_OK(stripe_reader_->ReadNext(&batch));
+        if (batch) return batch;
+        stripe_reader_.reset();
+      }
+      if (next_stripe_ == stripes_.size()) {
+        return nullptr;
+      }
+      const int64_t stripe = stripes_[next_stripe_++];
+      ARROW_ASSIGN_OR_RAISE(auto num_rows, reader_->NumberOfRowsInStripe(stripe));
+      if (num_rows == 0) continue;
+      if (included_ids_.empty()) {
+        // No column is needed, only emit the number of rows
+        return RecordBatch::Make(arrow::schema({}), num_rows, ArrayVector{});
+      }
+      RETURN_NOT_OK(reader_->Seek(first_rows_[stripe]));
+      ARROW_ASSIGN_OR_RAISE(
+          stripe_reader_, reader_->NextStripeReader(options_->batch_size, included_ids_));
+    }
+  }
+
+ private:
+  OrcScanBatchIterator(FileSource source, compute::Expression predicate,
+                       std::shared_ptr<ScanOptions> options)
+      : source_(std::move(source)),
+        predicate_(std::move(predicate)),
+        options_(std::move(options)) {}
+
+  Status Open() {
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenORCReader(source_, options_->pool));
+    ARROW_ASSIGN_OR_RAISE(auto schema, reader->ReadSchema());
+    ARROW_ASSIGN_OR_RAISE(included_ids_,
+                          GetIncludedColumnIds(*schema, options_->MaterializedFields()));
+
+    ARROW_ASSIGN_OR_RAISE(auto expressions,
+                          TestStripes(reader.get(), *schema, predicate_));
+    int64_t first_row = 0;
+    for (int64_t stripe = 0; stripe < reader->NumberOfStripes(); ++stripe) {
+      first_rows_.push_back(first_row);
+      ARROW_ASSIGN_OR_RAISE(auto num_rows, reader->NumberOfRowsInStripe(stripe));
+      first_row += num_rows;
+      if (expressions[stripe].IsSatisfiable()) {
+        stripes_.push_back(stripe);
+      }
+    }
+    reader_ = std::move(reader);
+    return Status::OK();
+  }
+
+  FileSource source_;
+  compute::Expression predicate_;
+  std::shared_ptr<ScanOptions> options_;
+
+  std::shared_ptr<ORCFileReader> reader_;
+  std::vector<int> included_ids_;
+  // The first row of each stripe of the file
+  std::vector<int64_t> first_rows_;
+  // The stripes to scan
+  std::vector<int64_t> stripes_;
+  size_t next_stripe_ = 0;
+  std::shared_ptr<RecordBatchReader> stripe_reader_;
+};
+
+Result<compute::Expression> ScanPredicate(const FileFragment& fragment,
+                                          const ScanOptions& options) {
+  return compute::SimplifyWithGuarantee(options.filter,
+                                        fragment.partition_expression());
+}
+
+/// \brief A ScanTask backed by an ORC file.
+class OrcScanTask : public ScanTask {
+ public:
+  OrcScanTask(std::shared_ptr<FileFragment> fragment,
+              std::shared_ptr<ScanOptions> options)
+      : ScanTask(std::move(options), fragment), source_(fragment->source()) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    const auto& fragment = checked_cast<const FileFragment&>(*fragment_);
+    ARROW_ASSIGN_OR_RAISE(auto predicate, ScanPredicate(fragment, *options_));
+    return OrcScanBatchIterator::Make(source_, std::move(predicate), options_);
+  }
+
+ private:
+  FileSource source_;
+};
+
+}  // namespace
+
+Result<bool> OrcFileFormat::IsSupported(const FileSource& source) const {
+  RETURN_NOT_OK(source.Open().status());
+  return OpenORCReader(source).ok();
+}
+
+Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenORCReader(source));
+  return reader->ReadSchema();
+}
+
+Result<ScanTaskIterator> OrcFileFormat::ScanFile(
+    const std::shared_ptr<ScanOptions>& options,
+    const std::shared_ptr<FileFragment>& fragment) const {
+  ScanTaskVector tasks{std::make_shared<OrcScanTask>(fragment, options)};
+  return MakeVectorIterator(std::move(tasks));
+}
+
+Result<RecordBatchGenerator> OrcFileFormat::ScanBatchesAsync(
+    const std::shared_ptr<ScanOptions>& options,
+    const std::shared_ptr<FileFragment>& file) const {
+  ARROW_ASSIGN_OR_RAISE(auto predicate, ScanPredicate(*file, *options));
+  auto batch_it =
+      OrcScanBatchIterator::Make(file->source(), std::move(predicate), options);
+  // The ORC reader is synchronous: read stripes on the I/O thread pool and decode
+  // the next ones while the current batches are processed
+  ARROW_ASSIGN_OR_RAISE(auto generator,
+                        MakeBackgroundGenerator(std::move(batch_it),
+                                                options->io_context.executor()));
+  generator = MakeTransferredGenerator(std::move(generator),
+                                       ::arrow::internal::GetCpuThreadPool());
+  return MakeChunkedBatchGenerator(std::move(generator), options->batch_size);
+}
+
+Future<util::optional<int64_t>> OrcFileFormat::CountRows(
+    const std::shared_ptr<FileFragment>& file, compute::Expression predicate,
+    const std::shared_ptr<ScanOptions>& options) {
+  auto self = checked_pointer_cast<OrcFileFormat>(shared_from_this());
+  return DeferNotOk(options->io_context.executor()->Submit(
+      [self, file, predicate]() -> Result<util::optional<int64_t>> {
+        ARROW_ASSIGN_OR_RAISE(auto reader, OpenORCReader(file->source()));
+        if (!ExpressionHasFieldRefs(predicate)) {
+          return reader->NumberOfRows();
+        }
+        ARROW_ASSIGN_OR_RAISE(auto schema, reader->ReadSchema());
+        ARROW_ASSIGN_OR_RAISE(auto expressions,
+                              TestStripes(reader.get(), *schema, predicate));
+        int64_t rows = 0;
+        for (int64_t stripe = 0; stripe < reader->NumberOfStripes(); ++stripe) {
+          // If the stripe is entirely excluded, exclude it from the row count
+          if (!expressions[stripe].IsSatisfiable()) continue;
+          // Unless the stripe is entirely included, bail out of fast path
+          if (expressions[stripe] != compute::literal(true)) return util::nullopt;
+          ARROW_ASSIGN_OR_RAISE(auto num_rows, reader->NumberOfRowsInStripe(stripe));
+          rows += num_rows;
+        }
+        return rows;
+      }));
+}
+
+// Writing ORC files through the dataset layer is not supported yet
+std::shared_ptr<FileWriteOptions> OrcFileFormat::DefaultWriteOptions() { return nullptr; }
+
+Result<std::shared_ptr<FileWriter>> OrcFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<FileWriteOptions> options,
+    fs::FileLocator destination_locator) const {
+  return Status::NotImplemented("ORC writer not yet implemented.");
+}
+
+}  // namespace dataset
+}  // namespace arrow
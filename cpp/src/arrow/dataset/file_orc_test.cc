@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner_internal.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+
+namespace arrow {
+namespace dataset {
+
+class OrcFormatHelper {
+ public:
+  using FormatType = OrcFileFormat;
+  static Result<std::shared_ptr<Buffer>> Write(RecordBatchReader* reader) {
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+    ARROW_ASSIGN_OR_RAISE(auto writer, adapters::orc::ORCFileWriter::Open(sink.get()));
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(reader->ReadAll(&table));
+    RETURN_NOT_OK(writer->Write(*table));
+    RETURN_NOT_OK(writer->Close());
+    return sink->Finish();
+  }
+
+  static std::shared_ptr<OrcFileFormat> MakeFormat() {
+    return std::make_shared<OrcFileFormat>();
+  }
+};
+
+class TestOrcFileFormat : public FileFormatFixtureMixin<OrcFormatHelper> {};
+
+TEST_F(TestOrcFileFormat, InspectFailureWithRelevantError) {
+  TestInspectFailureWithRelevantError(StatusCode::IOError, "ORC");
+}
+TEST_F(TestOrcFileFormat, Inspect) { TestInspect(); }
+TEST_F(TestOrcFileFormat, IsSupported) { TestIsSupported(); }
+TEST_F(TestOrcFileFormat, CountRows) { TestCountRows(); }
+
+TEST_F(TestOrcFileFormat, CountRowsPredicatePushdown) {
+  auto table = TableFromJSON(schema({field("i64", int64())}), {"[[1], [2], [3], [4]]"});
+  TableBatchReader reader(*table);
+  auto source = GetFileSource(&reader);
+  auto fragment = MakeFragment(*source);
+  auto options = std::make_shared<ScanOptions>();
+
+  auto count_rows = [&](compute::Expression predicate) {
+    EXPECT_OK_AND_ASSIGN(predicate, predicate.Bind(*table->schema()));
+    return fragment->CountRows(std::move(predicate), options);
+  };
+
+  // The stripe statistics show whether all or none of the rows satisfy these
+  ASSERT_FINISHES_OK_AND_EQ(util::make_optional<int64_t>(4),
+                            count_rows(greater_equal(field_ref("i64"), literal(1))));
+  ASSERT_FINISHES_OK_AND_EQ(util::make_optional<int64_t>(0),
+                            count_rows(greater(field_ref("i64"), literal(4))));
+  // ...but not for this one
+  ASSERT_FINISHES_OK_AND_EQ(util::nullopt,
+                            count_rows(equal(field_ref("i64"), literal(2))));
+}
+
+class TestOrcFileFormatScan : public FileFormatScanMixin<OrcFormatHelper> {};
+
+TEST_P(TestOrcFileFormatScan, ScanRecordBatchReader) { TestScan(); }
+TEST_P(TestOrcFileFormatScan, ScanBatchSize) { TestScanBatchSize(); }
+TEST_P(TestOrcFileFormatScan, ScanRecordBatchReaderWithVirtualColumn) {
+  TestScanWithVirtualColumn();
+}
+TEST_P(TestOrcFileFormatScan, ScanRecordBatchReaderProjected) { TestScanProjected(); }
+TEST_P(TestOrcFileFormatScan, ScanRecordBatchReaderProjectedMissingCols) {
+  TestScanProjectedMissingCols();
+}
+TEST_P(TestOrcFileFormatScan, PruneStripes) {
+  auto table = TableFromJSON(schema({field("i64", int64())}), {"[[1], [2], [3], [4]]"});
+  TableBatchReader reader(*table);
+  auto source = GetFileSource(&reader);
+  SetSchema(table->schema()->fields());
+  auto fragment = MakeFragment(*source);
+
+  auto count_scanned_rows = [&](compute::Expression filter) {
+    SetFilter(std::move(filter));
+    int64_t row_count = 0;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      row_count += batch->num_rows();
+    }
+    return row_count;
+  };
+
+  // The stripe statistics show that no row satisfies the filter
+  ASSERT_EQ(count_scanned_rows(greater(field_ref("i64"), literal(4))), 0);
+  // Otherwise the stripe is scanned; the filter itself is applied by the scanner
+  ASSERT_EQ(count_scanned_rows(equal(field_ref("i64"), literal(2))), 4);
+}
+INSTANTIATE_TEST_SUITE_P(TestScan, TestOrcFileFormatScan,
+                         ::testing::ValuesIn(TestFormatParams::Values()),
+                         TestFormatParams::ToTestNameString);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,19 +17,27 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/builder_base.h"
+#include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/table.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/config.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -38,9 +46,14 @@
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
 #include "parquet/file_reader.h"
+#include "parquet/metadata_cache.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
+#ifdef ARROW_S3
+#include "arrow/filesystem/s3fs.h"
+#endif
+
 namespace arrow {
 
 using internal::checked_cast;
@@ -219,6 +232,77 @@ util::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
   return util::nullopt;
 }
 
+// Whether the statistics of a column of this type can be used in place of its data.
+// Statistics of byte arrays may be truncated by writers, and those of nested types
+// don't describe rows.
+bool HasExactStatistics(const DataType& type) {
+  switch (type.id()) {
+    case Type::BOOL:
+    case Type::DATE32:
+    case Type::DATE64:
+    case Type::TIME32:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+      return true;
+    default:
+      return is_integer(type.id()) || is_floating(type.id());
+  }
+}
+
+util::optional<FragmentStatistics::ColumnStatistics> ColumnChunkStatistics(
+    const SchemaField& schema_field, const parquet::RowGroupMetaData& metadata) {
+  // As above, failure to extract statistics just means the row group will be scanned.
+  const auto& field = schema_field.field;
+  if (!schema_field.is_leaf() || !HasExactStatistics(*field->type())) {
+    return util::nullopt;
+  }
+
+  auto column_metadata = metadata.ColumnChunk(schema_field.column_index);
+  auto statistics = column_metadata->statistics();
+  if (statistics == nullptr || !statistics->HasNullCount() ||
+      statistics->num_values() + statistics->null_count() != metadata.num_rows()) {
+    return util::nullopt;
+  }
+
+  FragmentStatistics::ColumnStatistics column_statistics;
+  column_statistics.null_count = statistics->null_count();
+  if (statistics->num_values() == 0) {
+    // All values are null
+    return column_statistics;
+  }
+
+  std::shared_ptr<Scalar> min, max;
+  if (!statistics->HasMinMax() || !StatisticsAsScalars(*statistics, &min, &max).ok()) {
+    return util::nullopt;
+  }
+
+  auto maybe_min = min->CastTo(field->type());
+  auto maybe_max = max->CastTo(field->type());
+  if (!maybe_min.ok() || !maybe_max.ok()) {
+    return util::nullopt;
+  }
+  column_statistics.min = maybe_min.MoveValueUnsafe();
+  column_statistics.max = maybe_max.MoveValueUnsafe();
+  return column_statistics;
+}
+
+// Combine the minimums or maximums of several row groups, skipping null ones
+Result<std::shared_ptr<Scalar>> CombineExtrema(const std::shared_ptr<DataType>& type,
+                                               const ScalarVector& extrema,
+                                               bool maximum) {
+  std::unique_ptr<ArrayBuilder> builder;
+  RETURN_NOT_OK(MakeBuilder(default_memory_pool(), type, &builder));
+  for (const auto& extremum : extrema) {
+    if (extremum) RETURN_NOT_OK(builder->AppendScalar(*extremum));
+  }
+  if (builder->length() == 0) return nullptr;
+  ARROW_ASSIGN_OR_RAISE(auto array, builder->Finish());
+
+  ARROW_ASSIGN_OR_RAISE(auto min_max, compute::MinMax(array));
+  const auto& min_max_scalar = min_max.scalar_as<StructScalar>();
+  return min_max_scalar.value[maximum ? 1 : 0];
+}
+
 void AddColumnIndices(const SchemaField& schema_field,
                       std::vector<int>* column_projection) {
   if (schema_field.is_leaf()) {
@@ -263,6 +347,61 @@ Status WrapSourceError(const Status& status, const std::string& path) {
                             "': ", status.message());
 }
 
+// Return a location for the file which is the same from every filesystem instance
+// reaching it, or null if the filesystem doesn't have one (e.g. in-memory ones).
+util::optional<std::string> CanonicalFileLocation(const fs::FileSystem& filesystem,
+                                                  const std::string& path) {
+  const auto type_name = filesystem.type_name();
+  if (type_name == "subtree") {
+    const auto& subtree = checked_cast<const fs::SubTreeFileSystem&>(filesystem);
+    return CanonicalFileLocation(*subtree.base_fs(),
+                                 fs::internal::ConcatAbstractPath(subtree.base_path(),
+                                                                  path));
+  }
+  if (type_name == "local") {
+    return "local://" + path;
+  }
+#ifdef ARROW_S3
+  if (type_name == "s3") {
+    const auto& s3fs = checked_cast<const fs::S3FileSystem&>(filesystem);
+    const auto options = s3fs.options();
+    const auto& host =
+        options.endpoint_override.empty() ? s3fs.region() : options.endpoint_override;
+    return "s3://" + host + "/" + path;
+  }
+#endif
+  return util::nullopt;
+}
+
+// The identity under which the footer of the source is cached, or nullopt if it must
+// not be: caching is disabled, the source isn't a file of a filesystem or its version
+// can't be told, or the footer needs decrypting.
+util::optional<parquet::FileIdentity> GetFooterCacheKey(
+    const FileSource& source, const ParquetFragmentScanOptions& scan_options,
+    const parquet::ReaderProperties& properties) {
+  if (!scan_options.metadata_cache || !source.filesystem() ||
+      properties.file_decryption_properties()) {
+    return util::nullopt;
+  }
+  fs::FileInfo info = source.file_info();
+  auto location = CanonicalFileLocation(*source.filesystem(), info.path());
+  if (!location) return util::nullopt;
+  if (info.size() == fs::kNoSize || info.mtime() == fs::kNoTime) {
+    // Not filled in by discovery
+    auto maybe_info = source.filesystem()->GetFileInfo(info.path());
+    if (!maybe_info.ok()) return util::nullopt;
+    info = maybe_info.MoveValueUnsafe();
+    if (info.size() == fs::kNoSize || info.mtime() == fs::kNoTime) return util::nullopt;
+  }
+  parquet::FileIdentity identity;
+  identity.path = *std::move(location);
+  identity.size = info.size();
+  identity.mtime_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          info.mtime().time_since_epoch())
+                          .count();
+  return identity;
+}
+
 Result<bool> IsSupportedParquetFile(const ParquetFileFormat& format,
                                     const FileSource& source) {
   BEGIN_PARQUET_CATCH_EXCEPTIONS
@@ -283,6 +422,220 @@ Result<bool> IsSupportedParquetFile(const ParquetFileFormat& format,
   END_PARQUET_CATCH_EXCEPTIONS
 }
 
+// Gaps between selected rows shorter than this are read rather than skipped, and left
+// to the scanner's filter, as skipping them saves less than the extra chunks cost
+constexpr int64_t kMinSkippedRows = 1024;
+
+// A scan which reads the columns referenced by the filter of each row group first,
+// and then only the ranges of rows of the other columns which may satisfy it
+class LateMaterializedScan
+    : public std::enable_shared_from_this<LateMaterializedScan> {
+ public:
+  // Returns nullptr if the scan would not skip any column
+  static Result<std::shared_ptr<LateMaterializedScan>> Make(
+      std::shared_ptr<parquet::arrow::FileReader> reader,
+      const std::shared_ptr<ScanOptions>& options, const Fragment& fragment,
+      const std::vector<int>& column_projection) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto filter,
+        compute::SimplifyWithGuarantee(options->filter, fragment.partition_expression()));
+    if (filter.literal()) {
+      return nullptr;
+    }
+    std::unordered_set<std::string> filter_names;
+    for (const FieldRef& ref : compute::FieldsInExpression(filter)) {
+      if (ref.name() == nullptr) {
+        return nullptr;
+      }
+      filter_names.insert(*ref.name());
+    }
+
+    std::vector<int> filter_columns;
+    for (const auto& schema_field : reader->manifest().schema_fields) {
+      if (filter_names.find(schema_field.field->name()) != filter_names.end()) {
+        AddColumnIndices(schema_field, &filter_columns);
+      }
+    }
+    std::unordered_set<int> filter_column_set(filter_columns.begin(),
+                                              filter_columns.end());
+    std::vector<int> other_columns;
+    for (int column : column_projection) {
+      if (filter_column_set.find(column) == filter_column_set.end()) {
+        other_columns.push_back(column);
+      }
+    }
+    if (filter_columns.empty() || other_columns.empty()) {
+      return nullptr;
+    }
+
+    // The fields of the batches are in the order of the projection, as when reading
+    // all the columns at once, so locate each in the tables read
+    const auto& manifest = reader->manifest();
+    ARROW_ASSIGN_OR_RAISE(auto output_fields,
+                          manifest.GetFieldIndices(column_projection));
+    ARROW_ASSIGN_OR_RAISE(auto filter_fields, manifest.GetFieldIndices(filter_columns));
+    ARROW_ASSIGN_OR_RAISE(auto other_fields, manifest.GetFieldIndices(other_columns));
+    std::vector<std::pair<bool, int>> output_sources;
+    for (int field : output_fields) {
+      auto it = std::find(filter_fields.begin(), filter_fields.end(), field);
+      if (it != filter_fields.end()) {
+        output_sources.emplace_back(true, static_cast<int>(it - filter_fields.begin()));
+        continue;
+      }
+      it = std::find(other_fields.begin(), other_fields.end(), field);
+      DCHECK(it != other_fields.end());
+      output_sources.emplace_back(false, static_cast<int>(it - other_fields.begin()));
+    }
+    return std::make_shared<LateMaterializedScan>(
+        std::move(reader), options, std::move(filter), std::move(filter_columns),
+        std::move(other_columns), std::move(output_sources));
+  }
+
+  LateMaterializedScan(std::shared_ptr<parquet::arrow::FileReader> reader,
+                       std::shared_ptr<ScanOptions> options, compute::Expression filter,
+                       std::vector<int> filter_columns, std::vector<int> other_columns,
+                       std::vector<std::pair<bool, int>> output_sources)
+      : reader_(std::move(reader)),
+        options_(std::move(options)),
+        filter_(std::move(filter)),
+        filter_columns_(std::move(filter_columns)),
+        other_columns_(std::move(other_columns)),
+        output_sources_(std::move(output_sources)) {}
+
+  RecordBatchGenerator ScanRowGroups(std::vector<int> row_groups,
+                                     ::arrow::internal::Executor* cpu_executor) {
+    auto self = shared_from_this();
+    auto next_index = std::make_shared<size_t>(0);
+    auto shared_row_groups = std::make_shared<std::vector<int>>(std::move(row_groups));
+    AsyncGenerator<RecordBatchGenerator> row_group_generator =
+        [=]() -> Future<RecordBatchGenerator> {
+      if (*next_index >= shared_row_groups->size()) {
+        return AsyncGeneratorEnd<RecordBatchGenerator>();
+      }
+      const int row_group = (*shared_row_groups)[(*next_index)++];
+      return DeferNotOk(cpu_executor->Submit([self, row_group, cpu_executor] {
+        return self->ReadRowGroup(row_group, cpu_executor);
+      }));
+    };
+    return MakeConcatenatedGenerator(std::move(row_group_generator));
+  }
+
+ private:
+  // Columns are decoded by tasks of cpu_executor, which this is called from, so the
+  // reads are chained rather than waited for
+  Future<RecordBatchGenerator> ReadRowGroup(int row_group,
+                                            ::arrow::internal::Executor* cpu_executor) {
+    const int64_t num_rows =
+        reader_->parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    if (num_rows == 0) {
+      return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    }
+
+    auto self = shared_from_this();
+    return reader_->ReadRowRanges(row_group, filter_columns_, {{0, num_rows}},
+                                  cpu_executor)
+        .Then([self, row_group, num_rows, cpu_executor](
+                  const std::shared_ptr<Table>& filter_table)
+                  -> Future<RecordBatchGenerator> {
+          return self->ReadOtherColumns(row_group, num_rows, filter_table, cpu_executor);
+        });
+  }
+
+  Future<RecordBatchGenerator> ReadOtherColumns(
+      int row_group, int64_t num_rows, std::shared_ptr<Table> filter_table,
+      ::arrow::internal::Executor* cpu_executor) {
+    // Evaluate the filter on its columns
+    ARROW_ASSIGN_OR_RAISE(filter_table, filter_table->CombineChunks(options_->pool));
+    ArrayVector filter_arrays;
+    for (const auto& column : filter_table->columns()) {
+      filter_arrays.push_back(column->chunk(0));
+    }
+    auto filter_batch =
+        RecordBatch::Make(filter_table->schema(), num_rows, std::move(filter_arrays));
+    compute::ExecContext exec_context(options_->pool);
+    ARROW_ASSIGN_OR_RAISE(
+        Datum mask, compute::ExecuteScalarExpression(filter_, *options_->dataset_schema,
+                                                     filter_batch, &exec_context));
+
+    // Read the ranges of rows which may satisfy it from the other columns
+    auto row_ranges = SelectRowRanges(mask, num_rows);
+    auto self = shared_from_this();
+    return reader_->ReadRowRanges(row_group, other_columns_, row_ranges, cpu_executor)
+        .Then([self, filter_table,
+               row_ranges](const std::shared_ptr<Table>& other_table) {
+          return self->MakeBatches(*filter_table, row_ranges, *other_table);
+        });
+  }
+
+  // Slice the rows of the filter columns to the ranges read from the other columns
+  // and interleave them with the latter in projection order
+  Result<RecordBatchGenerator> MakeBatches(
+      const Table& filter_table, const std::vector<parquet::arrow::RowRange>& row_ranges,
+      const Table& other_table) const {
+    FieldVector fields;
+    ChunkedArrayVector columns;
+    for (const auto& source : output_sources_) {
+      if (!source.first) {
+        fields.push_back(other_table.schema()->field(source.second));
+        columns.push_back(other_table.column(source.second));
+        continue;
+      }
+      const auto& column = filter_table.column(source.second);
+      ArrayVector chunks;
+      for (const auto& range : row_ranges) {
+        chunks.push_back(column->chunk(0)->Slice(range.offset, range.length));
+      }
+      fields.push_back(filter_table.schema()->field(source.second));
+      columns.push_back(
+          std::make_shared<ChunkedArray>(std::move(chunks), column->type()));
+    }
+    auto table = Table::Make(schema(std::move(fields)), std::move(columns),
+                             other_table.num_rows());
+
+    TableBatchReader table_reader(*table);
+    table_reader.set_chunksize(options_->batch_size);
+    RecordBatchVector batches;
+    RETURN_NOT_OK(table_reader.ReadAll(&batches));
+    return MakeVectorGenerator(std::move(batches));
+  }
+
+  // The ranges of rows for which the filter mask isn't false or null
+  static std::vector<parquet::arrow::RowRange> SelectRowRanges(const Datum& mask,
+                                                               int64_t num_rows) {
+    std::vector<parquet::arrow::RowRange> ranges;
+    if (mask.is_scalar()) {
+      const auto& scalar = mask.scalar_as<BooleanScalar>();
+      if (scalar.is_valid && scalar.value) {
+        ranges.push_back({0, num_rows});
+      }
+      return ranges;
+    }
+    const auto& data = *mask.array();
+    ::arrow::internal::SetBitRunReader selected(data.buffers[1]->data(), data.offset,
+                                       data.length);
+    for (auto run = selected.NextRun(); run.length != 0; run = selected.NextRun()) {
+      // Null values are true or false in the data buffer, they are left to the filter
+      if (!ranges.empty() &&
+          run.position - (ranges.back().offset + ranges.back().length) <
+              kMinSkippedRows) {
+        ranges.back().length = run.position + run.length - ranges.back().offset;
+      } else {
+        ranges.push_back({run.position, run.length});
+      }
+    }
+    return ranges;
+  }
+
+  std::shared_ptr<parquet::arrow::FileReader> reader_;
+  std::shared_ptr<ScanOptions> options_;
+  compute::Expression filter_;
+  std::vector<int> filter_columns_;
+  std::vector<int> other_columns_;
+  // For each field of the batches, whether it is read with the filter columns (or
+  // else the other columns) and its index in the table read
+  std::vector<std::pair<bool, int>> output_sources_;
+};
+
 }  // namespace
 
 bool ParquetFileFormat::Equals(const FileFormat& other) const {
@@ -329,9 +682,17 @@ Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
 
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
 
+  const auto& metadata_cache = parquet_scan_options->metadata_cache;
+  auto cache_key = GetFooterCacheKey(source, *parquet_scan_options, properties);
+  std::shared_ptr<parquet::FileMetaData> cached_metadata;
+  if (cache_key) {
+    cached_metadata = metadata_cache->Get(*cache_key);
+  }
+
   auto make_reader = [&]() -> Result<std::unique_ptr<parquet::ParquetFileReader>> {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
-    return parquet::ParquetFileReader::Open(std::move(input), std::move(properties));
+    return parquet::ParquetFileReader::Open(std::move(input), std::move(properties),
+                                            cached_metadata);
     END_PARQUET_CATCH_EXCEPTIONS
   };
 
@@ -341,6 +702,9 @@ Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
   }
   std::unique_ptr<parquet::ParquetFileReader> reader = *std::move(maybe_reader);
   std::shared_ptr<parquet::FileMetaData> metadata = reader->metadata();
+  if (cache_key && !cached_metadata) {
+    metadata_cache->Put(*cache_key, metadata);
+  }
   auto arrow_properties = MakeArrowReaderProperties(*this, *metadata);
 
   if (options) {
@@ -351,6 +715,8 @@ Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
     arrow_properties.set_use_threads(
         parquet_scan_options->enable_parallel_column_conversion);
   }
+  arrow_properties.set_unify_dictionaries(
+      parquet_scan_options->arrow_reader_properties->unify_dictionaries());
 
   std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
   RETURN_NOT_OK(parquet::arrow::FileReader::Make(
@@ -367,9 +733,14 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
   auto properties =
       MakeReaderProperties(*this, parquet_scan_options.get(), options->pool);
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  auto cache_key = GetFooterCacheKey(source, *parquet_scan_options, properties);
+  std::shared_ptr<parquet::FileMetaData> cached_metadata;
+  if (cache_key) {
+    cached_metadata = parquet_scan_options->metadata_cache->Get(*cache_key);
+  }
   // TODO(ARROW-12259): workaround since we have Future<(move-only type)>
-  auto reader_fut =
-      parquet::ParquetFileReader::OpenAsync(std::move(input), std::move(properties));
+  auto reader_fut = parquet::ParquetFileReader::OpenAsync(
+      std::move(input), std::move(properties), cached_metadata);
   auto path = source.path();
   auto self = checked_pointer_cast<const ParquetFileFormat>(shared_from_this());
   return reader_fut.Then(
@@ -378,6 +749,9 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
         ARROW_ASSIGN_OR_RAISE(std::unique_ptr<parquet::ParquetFileReader> reader,
                               reader_fut.MoveResult());
         std::shared_ptr<parquet::FileMetaData> metadata = reader->metadata();
+        if (cache_key && !cached_metadata) {
+          parquet_scan_options->metadata_cache->Put(*cache_key, metadata);
+        }
         auto arrow_properties = MakeArrowReaderProperties(*self, *metadata);
         arrow_properties.set_batch_size(options->batch_size);
         // Must be set here since the sync ScanTask handles pre-buffering itself
@@ -388,6 +762,8 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
         arrow_properties.set_io_context(
             parquet_scan_options->arrow_reader_properties->io_context());
         arrow_properties.set_use_threads(options->use_threads);
+        arrow_properties.set_unify_dictionaries(
+            parquet_scan_options->arrow_reader_properties->unify_dictionaries());
         std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
         RETURN_NOT_OK(parquet::arrow::FileReader::Make(options->pool, std::move(reader),
                                                        std::move(arrow_properties),
@@ -489,6 +865,23 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
         auto parquet_scan_options,
         GetFragmentScanOptions<ParquetFragmentScanOptions>(
             kParquetTypeName, options.get(), default_fragment_scan_options));
+    if (parquet_scan_options->late_materialization) {
+      ARROW_ASSIGN_OR_RAISE(auto late_scan,
+                            LateMaterializedScan::Make(reader, options, *parquet_fragment,
+                                                       column_projection));
+      if (late_scan) {
+        if (reader->properties().pre_buffer()) {
+          BEGIN_PARQUET_CATCH_EXCEPTIONS
+          reader->parquet_reader()->PreBuffer(row_groups, column_projection,
+                                              reader->properties().io_context(),
+                                              reader->properties().cache_options());
+          END_PARQUET_CATCH_EXCEPTIONS
+        }
+        return MakeReadaheadGenerator(
+            late_scan->ScanRowGroups(row_groups, ::arrow::internal::GetCpuThreadPool()),
+            options->batch_readahead);
+      }
+    }
     ARROW_ASSIGN_OR_RAISE(auto generator, reader->GetRecordBatchGenerator(
                                               reader, row_groups, column_projection,
                                               ::arrow::internal::GetCpuThreadPool()));
@@ -515,6 +908,23 @@ Future<util::optional<int64_t>> ParquetFileFormat::CountRows(
   }
 }
 
+Future<FragmentStatistics> ParquetFileFormat::GetStatistics(
+    const std::shared_ptr<FileFragment>& file, compute::Expression predicate,
+    const std::vector<FieldRef>& columns, const std::shared_ptr<ScanOptions>& options) {
+  auto parquet_file = checked_pointer_cast<ParquetFileFragment>(file);
+  if (parquet_file->metadata()) {
+    ARROW_ASSIGN_OR_RAISE(auto statistics,
+                          parquet_file->TryGetStatistics(std::move(predicate), columns));
+    return Future<FragmentStatistics>::MakeFinished(std::move(statistics));
+  } else {
+    return DeferNotOk(options->io_context.executor()->Submit(
+        [parquet_file, predicate, columns]() -> Result<FragmentStatistics> {
+          RETURN_NOT_OK(parquet_file->EnsureCompleteMetadata());
+          return parquet_file->TryGetStatistics(predicate, columns);
+        }));
+  }
+}
+
 Result<std::shared_ptr<ParquetFileFragment>> ParquetFileFormat::MakeFragment(
     FileSource source, compute::Expression partition_expression,
     std::shared_ptr<Schema> physical_schema, std::vector<int> row_groups) {
@@ -779,6 +1189,74 @@ Result<util::optional<int64_t>> ParquetFileFragment::TryCountRows(
   return metadata()->num_rows();
 }
 
+Result<FragmentStatistics> ParquetFileFragment::TryGetStatistics(
+    compute::Expression predicate, const std::vector<FieldRef>& columns) {
+  DCHECK_NE(metadata_, nullptr);
+  ARROW_ASSIGN_OR_RAISE(auto expressions, TestRowGroups(std::move(predicate)));
+
+  // Columns missing from the file have no statistics
+  std::vector<const SchemaField*> schema_fields(columns.size(), nullptr);
+  for (size_t i = 0; i < columns.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto match, columns[i].FindOneOrNone(*physical_schema_));
+    if (match.empty()) continue;
+    schema_fields[i] = &manifest_->schema_fields[match[0]];
+  }
+
+  FragmentStatistics statistics;
+  statistics.columns.resize(columns.size());
+  std::vector<ScalarVector> mins(columns.size()), maxes(columns.size());
+  std::vector<int> remaining_row_groups;
+
+  for (size_t i = 0; i < expressions.size(); ++i) {
+    // If the row group is entirely excluded, it contributes nothing
+    if (!expressions[i].IsSatisfiable()) continue;
+
+    const int row_group = (*row_groups_)[i];
+    // Unless the row group is entirely included, it must be scanned
+    if (expressions[i] != compute::literal(true)) {
+      remaining_row_groups.push_back(row_group);
+      continue;
+    }
+
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    auto row_group_metadata = metadata_->RowGroup(row_group);
+    std::vector<FragmentStatistics::ColumnStatistics> row_group_statistics;
+    for (const SchemaField* schema_field : schema_fields) {
+      if (schema_field == nullptr) break;
+      auto column_statistics = ColumnChunkStatistics(*schema_field, *row_group_metadata);
+      if (!column_statistics) break;
+      row_group_statistics.push_back(std::move(*column_statistics));
+    }
+    // Likewise if the statistics of any column are unusable
+    if (row_group_statistics.size() != columns.size()) {
+      remaining_row_groups.push_back(row_group);
+      continue;
+    }
+
+    statistics.num_rows += row_group_metadata->num_rows();
+    for (size_t j = 0; j < columns.size(); ++j) {
+      statistics.columns[j].null_count += row_group_statistics[j].null_count;
+      mins[j].push_back(std::move(row_group_statistics[j].min));
+      maxes[j].push_back(std::move(row_group_statistics[j].max));
+    }
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  for (size_t j = 0; j < columns.size(); ++j) {
+    if (schema_fields[j] == nullptr || mins[j].empty()) continue;
+    const auto& type = schema_fields[j]->field->type();
+    ARROW_ASSIGN_OR_RAISE(statistics.columns[j].min,
+                          CombineExtrema(type, mins[j], /*maximum=*/false));
+    ARROW_ASSIGN_OR_RAISE(statistics.columns[j].max,
+                          CombineExtrema(type, maxes[j], /*maximum=*/true));
+  }
+
+  if (!remaining_row_groups.empty()) {
+    ARROW_ASSIGN_OR_RAISE(statistics.remainder, Subset(std::move(remaining_row_groups)));
+  }
+  return statistics;
+}
+
 //
 // ParquetFragmentScanOptions
 //
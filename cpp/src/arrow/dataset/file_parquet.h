@@ -38,6 +38,7 @@ class Statistics;
 class ColumnChunkMetaData;
 class RowGroupMetaData;
 class FileMetaData;
+class FileMetaDataCache;
 class FileDecryptionProperties;
 class FileEncryptionProperties;
 
@@ -108,6 +109,11 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
       const std::shared_ptr<FileFragment>& file, compute::Expression predicate,
       const std::shared_ptr<ScanOptions>& options) override;
 
+  Future<FragmentStatistics> GetStatistics(
+      const std::shared_ptr<FileFragment>& file, compute::Expression predicate,
+      const std::vector<FieldRef>& columns,
+      const std::shared_ptr<ScanOptions>& options) override;
+
   using FileFormat::MakeFragment;
 
   /// \brief Create a Fragment targeting all RowGroups.
@@ -191,6 +197,11 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   /// metadata to be present, and expects the predicate to have been
   /// simplified against the partition expression already.
   Result<util::optional<int64_t>> TryCountRows(compute::Expression predicate);
+  /// Summarize the row groups entirely matching the predicate using their
+  /// statistics; other matching row groups are returned as the remainder.
+  /// Same expectations as TryCountRows.
+  Result<FragmentStatistics> TryGetStatistics(compute::Expression predicate,
+                                              const std::vector<FieldRef>& columns);
 
   ParquetFileFormat& parquet_format_;
 
@@ -227,6 +238,17 @@ class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
   /// across files and columns. Only affects the threaded reader; the async reader
   /// will parallelize across columns if use_threads is enabled.
   bool enable_parallel_column_conversion = false;
+  /// EXPERIMENTAL: Read the columns referenced by the filter of each row group first,
+  /// and then only the ranges of rows of the other columns which may satisfy it,
+  /// skipping the pages of these columns which hold none. The scanned batches then
+  /// mostly hold rows which satisfy the filter. Only affects the async scanner.
+  bool late_materialization = false;
+  /// Cache of file footers, shared by all the scans which use it. If set, the footer
+  /// of a file read from a filesystem is looked up by its path, size and modification
+  /// time before being read and parsed. Files with decryption properties are never
+  /// cached. Pass parquet::FileMetaDataCache::Default() to share footers across the
+  /// whole process.
+  std::shared_ptr<parquet::FileMetaDataCache> metadata_cache;
 };
 
 class ARROW_DS_EXPORT ParquetFileWriteOptions : public FileWriteOptions {
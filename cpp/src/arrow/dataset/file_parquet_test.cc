@@ -18,6 +18,7 @@
 #include "arrow/dataset/file_parquet.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -36,6 +37,7 @@
 
 #include "parquet/arrow/writer.h"
 #include "parquet/metadata.h"
+#include "parquet/metadata_cache.h"
 
 namespace arrow {
 
@@ -285,6 +287,61 @@ TEST_F(TestParquetFileFormat, CountRowsPredicatePushdown) {
   }
 }
 
+TEST_F(TestParquetFileFormat, GetStatisticsPredicatePushdown) {
+  constexpr int64_t kNumRowGroups = 16;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  // See PredicatePushdown test below for a description of the generated data
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+  auto options = std::make_shared<ScanOptions>();
+  std::vector<FieldRef> columns{"i64", "u8"};
+
+  auto fragment = MakeFragment(*source);
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto statistics,
+                                fragment->GetStatistics(literal(true), columns, options));
+  ASSERT_EQ(statistics.num_rows, kTotalNumRows);
+  ASSERT_EQ(statistics.remainder, nullptr);
+  ASSERT_EQ(statistics.columns.size(), columns.size());
+  ASSERT_EQ(statistics.columns[0].null_count, 0);
+  AssertScalarsEqual(*MakeScalar<int64_t>(1), *statistics.columns[0].min);
+  AssertScalarsEqual(*MakeScalar<int64_t>(kNumRowGroups), *statistics.columns[0].max);
+  AssertScalarsEqual(*MakeScalar<uint8_t>(1), *statistics.columns[1].min);
+  AssertScalarsEqual(*MakeScalar<uint8_t>(kNumRowGroups), *statistics.columns[1].max);
+
+  for (int i = 1; i <= kNumRowGroups; i++) {
+    SCOPED_TRACE(i);
+    // Row groups are either entirely included or excluded
+    auto predicate = less_equal(field_ref("i64"), literal(i));
+    ASSERT_OK_AND_ASSIGN(predicate, predicate.Bind(*reader->schema()));
+    ASSERT_FINISHES_OK_AND_ASSIGN(statistics,
+                                  fragment->GetStatistics(predicate, columns, options));
+    ASSERT_EQ(statistics.num_rows, i * (i + 1) / 2);
+    ASSERT_EQ(statistics.remainder, nullptr);
+    AssertScalarsEqual(*MakeScalar<int64_t>(1), *statistics.columns[0].min);
+    AssertScalarsEqual(*MakeScalar<int64_t>(i), *statistics.columns[0].max);
+  }
+
+  // The predicate can't be decided from statistics of nested columns, so every row
+  // group may be partially included
+  auto predicate = less_equal(field_ref(FieldRef("struct", "i32")), literal(4));
+  ASSERT_OK_AND_ASSIGN(predicate, predicate.Bind(*reader->schema()));
+  ASSERT_FINISHES_OK_AND_ASSIGN(statistics,
+                                fragment->GetStatistics(predicate, columns, options));
+  ASSERT_EQ(statistics.num_rows, 0);
+  ASSERT_NE(statistics.remainder, nullptr);
+  auto remainder = checked_pointer_cast<ParquetFileFragment>(statistics.remainder);
+  ASSERT_EQ(remainder->row_groups().size(), static_cast<size_t>(kNumRowGroups));
+
+  // Likewise if the statistics of a column can't be used in place of its values
+  columns = {"i64", "list"};
+  ASSERT_FINISHES_OK_AND_ASSIGN(statistics,
+                                fragment->GetStatistics(literal(true), columns, options));
+  ASSERT_EQ(statistics.num_rows, 0);
+  ASSERT_NE(statistics.remainder, nullptr);
+}
+
 TEST_F(TestParquetFileFormat, MultithreadedScan) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -311,6 +368,72 @@ TEST_F(TestParquetFileFormat, MultithreadedScan) {
   ASSERT_EQ(batches.size(), kNumRowGroups);
 }
 
+TEST_F(TestParquetFileFormat, MetadataCache) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("test-parquet-footer-"));
+  auto local_fs = std::make_shared<fs::LocalFileSystem>();
+  auto write_file = [&](const std::shared_ptr<fs::FileSystem>& filesystem,
+                        const std::string& path, std::shared_ptr<Schema> schema) {
+    auto reader = GetRecordBatchReader(std::move(schema));
+    ASSERT_OK_AND_ASSIGN(auto buffer, ParquetFormatHelper::Write(reader.get()));
+    ASSERT_OK_AND_ASSIGN(auto stream, filesystem->OpenOutputStream(path));
+    ASSERT_OK(stream->Write(buffer));
+    ASSERT_OK(stream->Close());
+  };
+  auto path = temp_dir->path().ToString() + "data.parquet";
+  ASSERT_NO_FATAL_FAILURE(write_file(local_fs, path, schema({field("f64", float64())})));
+
+  auto cache = std::make_shared<parquet::FileMetaDataCache>();
+  auto scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  scan_options->metadata_cache = cache;
+  format_->default_fragment_scan_options = scan_options;
+
+  FileSource source(path, local_fs);
+  ASSERT_OK(format_->Inspect(source));
+  ASSERT_OK(format_->Inspect(source));
+  ASSERT_EQ(cache->stats().misses, 1);
+  ASSERT_EQ(cache->stats().hits, 1);
+  ASSERT_EQ(cache->stats().num_entries, 1);
+
+  // Fragments share the cache with everything else
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+  auto parquet_fragment = checked_pointer_cast<ParquetFileFragment>(fragment);
+  ASSERT_OK(parquet_fragment->EnsureCompleteMetadata());
+  ASSERT_EQ(cache->stats().hits, 2);
+
+  // A rewritten file isn't served the stale footer
+  ASSERT_NO_FATAL_FAILURE(write_file(local_fs, path, schema({field("i32", int32())})));
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(source));
+  AssertSchemaEqual(*actual, Schema({field("i32", int32())}), /*check_metadata=*/false);
+  ASSERT_EQ(cache->stats().misses, 2);
+
+  // Files are keyed by their location on the underlying filesystem, so the same
+  // relative path in different subtrees is a different file...
+  auto subtree_path = temp_dir->path().ToString() + "subtree";
+  ASSERT_OK(local_fs->CreateDir(subtree_path));
+  auto subtree_fs = std::make_shared<fs::SubTreeFileSystem>(subtree_path, local_fs);
+  ASSERT_NO_FATAL_FAILURE(
+      write_file(subtree_fs, "data.parquet", schema({field("f64", float64())})));
+  ASSERT_OK_AND_ASSIGN(actual, format_->Inspect(FileSource("data.parquet", subtree_fs)));
+  AssertSchemaEqual(*actual, Schema({field("f64", float64())}), /*check_metadata=*/false);
+  ASSERT_EQ(cache->stats().misses, 3);
+
+  // ...and the same file reached through another filesystem instance is a hit
+  auto other_subtree_fs = std::make_shared<fs::SubTreeFileSystem>(
+      temp_dir->path().ToString(), std::make_shared<fs::LocalFileSystem>());
+  ASSERT_OK(format_->Inspect(FileSource("data.parquet", other_subtree_fs)));
+  ASSERT_EQ(cache->stats().hits, 3);
+  ASSERT_EQ(cache->stats().misses, 3);
+
+  // In-memory filesystems have no location shared by their instances
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(fs::TimePoint::duration(42)));
+  ASSERT_NO_FATAL_FAILURE(
+      write_file(mock_fs, "data.parquet", schema({field("f64", float64())})));
+  ASSERT_OK(format_->Inspect(FileSource("data.parquet", mock_fs)));
+  ASSERT_EQ(cache->stats().misses, 3);
+  ASSERT_EQ(cache->stats().num_entries, 3);
+}
+
 class TestParquetFileSystemDataset : public WriteFileSystemDatasetMixin,
                                      public testing::Test {
  public:
@@ -603,6 +726,59 @@ TEST_P(TestParquetFileFormatScan, PredicatePushdownRowGroupFragmentsUsingStringC
   CountRowGroupsInFragment(fragment, {0, 3}, equal(field_ref("x"), literal("a")));
 }
 
+TEST_P(TestParquetFileFormatScan, LateMaterialization) {
+  if (!GetParam().use_async) GTEST_SKIP() << "Test only applies to async scanner";
+
+  constexpr int64_t kNumRows = 5000;
+  std::vector<int64_t> xs(kNumRows);
+  std::vector<std::string> ss(kNumRows);
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    xs[i] = i;
+    ss[i] = std::to_string(i);
+  }
+  std::shared_ptr<Array> x, s;
+  ArrayFromVector<Int64Type>(xs, &x);
+  ArrayFromVector<StringType, std::string>(ss, &s);
+  auto table = Table::Make(schema({field("x", int64()), field("s", utf8())}),
+                           ArrayVector{x, s});
+  TableBatchReader reader(*table);
+  auto source = GetFileSource(&reader);
+
+  SetSchema(reader.schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->late_materialization = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+
+  // Column "s" is only decoded for the selected rows
+  SetFilter(or_(less(field_ref("x"), literal<int64_t>(100)),
+                greater_equal(field_ref("x"), literal<int64_t>(4000))));
+  ASSERT_OK_AND_ASSIGN(auto batches, PhysicalBatches(fragment).ToVector());
+  ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(table->schema(), batches));
+  std::vector<std::shared_ptr<Table>> slices = {table->Slice(0, 100),
+                                                table->Slice(4000, 1000)};
+  ASSERT_OK_AND_ASSIGN(auto expected, ConcatenateTables(slices));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+  // Filtering on a column which isn't the first keeps the fields in projection order
+  SetFilter(equal(field_ref("s"), literal(std::string("42"))));
+  ASSERT_OK_AND_ASSIGN(batches, PhysicalBatches(fragment).ToVector());
+  ASSERT_FALSE(batches.empty());
+  ASSERT_OK_AND_ASSIGN(actual, Table::FromRecordBatches(batches));
+  AssertSchemaEqual(*table->schema(), *actual->schema(), /*check_metadata=*/false);
+  expected = table->Slice(42, 1);
+  for (const auto& name : {"x", "s"}) {
+    AssertChunkedEquivalent(*expected->GetColumnByName(name),
+                            *actual->GetColumnByName(name));
+  }
+
+  // Nothing selected
+  SetFilter(greater(field_ref("x"), literal(kNumRows)));
+  ASSERT_OK_AND_ASSIGN(batches, PhysicalBatches(fragment).ToVector());
+  ASSERT_OK_AND_ASSIGN(actual, Table::FromRecordBatches(table->schema(), batches));
+  ASSERT_EQ(actual->num_rows(), 0);
+}
+
 INSTANTIATE_TEST_SUITE_P(TestScan, TestParquetFileFormatScan,
                          ::testing::ValuesIn(TestFormatParams::Values()),
                          TestFormatParams::ToTestNameString);
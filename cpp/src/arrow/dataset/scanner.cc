@@ -23,12 +23,16 @@
 #include <mutex>
 #include <sstream>
 
+#include "arrow/array/array_nested.h"
 #include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_base.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/expression_internal.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner_internal.h"
@@ -166,6 +170,11 @@ Result<int64_t> Scanner::CountRows() {
   return count;
 }
 
+Result<std::shared_ptr<Table>> Scanner::AggregateByPartition(
+    compute::AggregateNodeOptions) {
+  return Status::NotImplemented("Aggregation is not supported by this scanner");
+}
+
 namespace {
 class ScannerRecordBatchReader : public RecordBatchReader {
  public:
@@ -431,6 +440,8 @@ class AsyncScanner : public Scanner, public std::enable_shared_from_this<AsyncSc
   Result<EnumeratedRecordBatchGenerator> ScanBatchesUnorderedAsync() override;
   Result<std::shared_ptr<Table>> ToTable() override;
   Result<int64_t> CountRows() override;
+  Result<std::shared_ptr<Table>> AggregateByPartition(
+      compute::AggregateNodeOptions options) override;
 
  private:
   Result<TaggedRecordBatchGenerator> ScanBatchesAsync(Executor* executor);
@@ -812,6 +823,259 @@ Result<int64_t> AsyncScanner::CountRows() {
   return total.load();
 }
 
+// Compute an aggregate of AggregateByPartition from the statistics of a fragment
+Result<std::shared_ptr<Scalar>> AggregateStatistics(
+    const compute::internal::Aggregate& aggregate, const std::shared_ptr<Field>& target,
+    int64_t num_rows, const FragmentStatistics::ColumnStatistics& statistics) {
+  if (aggregate.function == "hash_count") {
+    auto mode = compute::CountOptions::ONLY_VALID;
+    if (aggregate.options) {
+      mode = checked_cast<const compute::CountOptions&>(*aggregate.options).mode;
+    }
+    switch (mode) {
+      case compute::CountOptions::ONLY_NULL:
+        return MakeScalar(statistics.null_count);
+      case compute::CountOptions::ALL:
+        return MakeScalar(num_rows);
+      default:
+        return MakeScalar(num_rows - statistics.null_count);
+    }
+  }
+
+  const auto& extremum =
+      aggregate.function == "hash_min" ? statistics.min : statistics.max;
+  if (!extremum) {
+    // All values are null
+    return MakeNullScalar(target->type());
+  }
+  return extremum->CastTo(target->type());
+}
+
+// State of the partial aggregation of fragments from their metadata, shared by the
+// callbacks of the fragment generator, which the plan may call until it finishes
+struct PartialAggregation {
+  std::shared_ptr<Schema> dataset_schema;
+  std::shared_ptr<ScanOptions> options;
+  std::vector<compute::internal::Aggregate> aggregates;
+  std::vector<FieldRef> targets;
+  FieldVector target_fields, key_fields;
+  std::vector<FieldPath> key_paths;
+
+  std::mutex mutex;
+  // Rows of partial aggregates followed by keys
+  std::vector<ScalarVector> rows;
+};
+
+Result<std::shared_ptr<Table>> AsyncScanner::AggregateByPartition(
+    compute::AggregateNodeOptions aggregate_options) {
+  const auto& dataset_schema = scan_options_->dataset_schema;
+  const auto& aggregates = aggregate_options.aggregates;
+  const size_t num_aggregates = aggregates.size();
+  const size_t num_keys = aggregate_options.keys.size();
+  if (aggregate_options.targets.size() != num_aggregates ||
+      aggregate_options.names.size() != num_aggregates) {
+    return Status::Invalid("Expected one target and one name per aggregate");
+  }
+  if (num_keys == 0) {
+    return Status::Invalid("Aggregating by partition requires at least one key");
+  }
+
+  // Partial aggregates, whether computed from metadata or by scanning, are combined
+  // by a final grouped aggregation
+  std::vector<compute::internal::Aggregate> combine_aggregates;
+  for (const auto& aggregate : aggregates) {
+    if (aggregate.function == "hash_count") {
+      combine_aggregates.push_back({"hash_sum", nullptr});
+      continue;
+    }
+    if (aggregate.function != "hash_min" && aggregate.function != "hash_max") {
+      return Status::NotImplemented("Aggregating by partition with ", aggregate.function);
+    }
+    if (aggregate.options) {
+      const auto& options =
+          checked_cast<const compute::ScalarAggregateOptions&>(*aggregate.options);
+      if (!options.skip_nulls || options.min_count > 1) {
+        return Status::NotImplemented("Aggregating by partition with ",
+                                      aggregate.function, " without skipping nulls");
+      }
+    }
+    combine_aggregates.push_back({aggregate.function, nullptr});
+  }
+
+  // Resolve targets and keys, which are projected before aggregating
+  std::vector<std::string> materialized;
+  std::vector<compute::Expression> exprs;
+  std::vector<std::string> names;
+  FieldVector target_fields, key_fields;
+  std::vector<FieldPath> key_paths;
+  for (size_t i = 0; i < num_aggregates + num_keys; ++i) {
+    const bool is_key = i >= num_aggregates;
+    const FieldRef& ref = is_key ? aggregate_options.keys[i - num_aggregates]
+                                 : aggregate_options.targets[i];
+    ARROW_ASSIGN_OR_RAISE(auto path, ref.FindOne(*dataset_schema));
+    ARROW_ASSIGN_OR_RAISE(auto field, path.Get(*dataset_schema));
+    const auto& name = dataset_schema->field(path[0])->name();
+    if (std::find(materialized.begin(), materialized.end(), name) ==
+        materialized.end()) {
+      materialized.push_back(name);
+    }
+    exprs.push_back(compute::field_ref(ref));
+    if (is_key) {
+      names.push_back(field->name());
+      key_paths.push_back(std::move(path));
+      key_fields.push_back(std::move(field));
+    } else {
+      names.push_back("target_" + std::to_string(i));
+      target_fields.push_back(std::move(field));
+    }
+  }
+
+  const auto options = std::make_shared<ScanOptions>(*scan_options_);
+  RETURN_NOT_OK(SetProjection(options.get(), std::move(materialized)));
+
+  auto partial = std::make_shared<PartialAggregation>();
+  partial->dataset_schema = dataset_schema;
+  partial->options = options;
+  partial->aggregates = aggregates;
+  partial->targets = aggregate_options.targets;
+  partial->target_fields = std::move(target_fields);
+  partial->key_fields = std::move(key_fields);
+  partial->key_paths = std::move(key_paths);
+
+  ARROW_ASSIGN_OR_RAISE(auto fragment_gen, GetFragments());
+  fragment_gen = MakeMappedGenerator(
+      std::move(fragment_gen),
+      [partial](const std::shared_ptr<Fragment>& fragment)
+          -> Future<std::shared_ptr<Fragment>> {
+        // Metadata can only be used if every key is known for the whole fragment
+        ARROW_ASSIGN_OR_RAISE(auto known_values, compute::ExtractKnownFieldValues(
+                                                     fragment->partition_expression()));
+        const size_t num_keys = partial->key_paths.size();
+        ScalarVector key_values(num_keys);
+        for (const auto& ref_value : known_values.map) {
+          if (!ref_value.second.is_scalar()) continue;
+          const auto& value = ref_value.second.scalar();
+          ARROW_ASSIGN_OR_RAISE(auto match,
+                                ref_value.first.FindOneOrNone(*partial->dataset_schema));
+          for (size_t i = 0; i < num_keys; ++i) {
+            if (match == partial->key_paths[i] &&
+                value->type->Equals(*partial->key_fields[i]->type())) {
+              key_values[i] = value;
+            }
+          }
+        }
+        for (const auto& key_value : key_values) {
+          if (!key_value) return fragment;
+        }
+
+        const auto& options = partial->options;
+        return fragment->GetStatistics(options->filter, partial->targets, options)
+            .Then([partial, key_values](const FragmentStatistics& statistics)
+                      -> Result<std::shared_ptr<Fragment>> {
+              if (statistics.num_rows > 0) {
+                // fast path: aggregate the summarized rows from their statistics
+                ScalarVector row;
+                for (size_t i = 0; i < partial->aggregates.size(); ++i) {
+                  ARROW_ASSIGN_OR_RAISE(
+                      auto value,
+                      AggregateStatistics(partial->aggregates[i],
+                                          partial->target_fields[i],
+                                          statistics.num_rows, statistics.columns[i]));
+                  row.push_back(std::move(value));
+                }
+                row.insert(row.end(), key_values.begin(), key_values.end());
+                std::lock_guard<std::mutex> lock(partial->mutex);
+                partial->rows.push_back(std::move(row));
+              }
+
+              // slow path: scan the rows which couldn't be summarized
+              if (statistics.remainder) {
+                return statistics.remainder;
+              }
+              return std::make_shared<InMemoryFragment>(
+                  partial->options->dataset_schema, RecordBatchVector{});
+            });
+      });
+
+  auto cpu_executor =
+      scan_options_->use_threads ? ::arrow::internal::GetCpuThreadPool() : nullptr;
+  compute::ExecContext exec_context(scan_options_->pool, cpu_executor);
+  ARROW_ASSIGN_OR_RAISE(auto plan, compute::ExecPlan::Make(&exec_context));
+
+  std::vector<FieldRef> projected_targets, projected_keys;
+  for (size_t i = 0; i < num_aggregates + num_keys; ++i) {
+    auto& projected = i < num_aggregates ? projected_targets : projected_keys;
+    projected.emplace_back(static_cast<int>(i));
+  }
+
+  AsyncGenerator<util::optional<compute::ExecBatch>> sink_gen;
+  ARROW_ASSIGN_OR_RAISE(
+      auto sink,
+      compute::Declaration::Sequence(
+          {
+              {"scan", ScanNodeOptions{std::make_shared<FragmentDataset>(
+                                           scan_options_->dataset_schema,
+                                           std::move(fragment_gen)),
+                                       options}},
+              {"filter", compute::FilterNodeOptions{options->filter}},
+              {"project",
+               compute::ProjectNodeOptions{std::move(exprs), std::move(names)}},
+              {"aggregate", compute::AggregateNodeOptions{aggregates,
+                                                          std::move(projected_targets),
+                                                          aggregate_options.names,
+                                                          std::move(projected_keys)}},
+              {"sink", compute::SinkNodeOptions{&sink_gen}},
+          })
+          .AddToPlan(plan.get()));
+  const auto output_schema = sink->inputs()[0]->output_schema();
+
+  // The fragment generator may be in use until the plan finishes, even if it fails
+  // to start
+  auto start_status = plan->StartProducing();
+  if (!start_status.ok()) {
+    plan->finished().Wait();
+    return start_status;
+  }
+  auto collected = CollectAsyncGenerator(std::move(sink_gen));
+  auto maybe_batches = collected.result();
+  plan->finished().Wait();
+  ARROW_ASSIGN_OR_RAISE(auto batches, maybe_batches);
+
+  // Combine the partial aggregates of scanned and summarized rows
+  std::vector<ArrayVector> chunks(output_schema->num_fields());
+  for (const auto& batch : batches) {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      chunks[i].push_back(batch->values[i].make_array());
+    }
+  }
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(
+        MakeBuilder(scan_options_->pool, output_schema->field(i)->type(), &builder));
+    for (const auto& row : partial->rows) {
+      RETURN_NOT_OK(builder->AppendScalar(*row[i]));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto partial, builder->Finish());
+    chunks[i].push_back(std::move(partial));
+  }
+
+  ArrayVector columns(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(columns[i], Concatenate(chunks[i], scan_options_->pool));
+  }
+  if (columns[0]->length() == 0) {
+    return Table::Make(output_schema, columns);
+  }
+
+  std::vector<Datum> arguments(columns.begin(), columns.begin() + num_aggregates);
+  std::vector<Datum> group_keys(columns.begin() + num_aggregates, columns.end());
+  ARROW_ASSIGN_OR_RAISE(auto combined,
+                        compute::internal::GroupBy(arguments, group_keys,
+                                                   combine_aggregates,
+                                                   /*use_threads=*/false, &exec_context));
+  return Table::Make(output_schema, combined.array_as<StructArray>()->fields());
+}
+
 }  // namespace
 
 ScannerBuilder::ScannerBuilder(std::shared_ptr<Dataset> dataset)
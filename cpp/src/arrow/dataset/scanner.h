@@ -294,6 +294,20 @@ class ARROW_DS_EXPORT Scanner {
   /// This method will push down the predicate and compute the result based on fragment
   /// metadata if possible.
   virtual Result<int64_t> CountRows();
+  /// \brief Compute grouped aggregates of the rows matching the filter.
+  ///
+  /// The aggregates and output layout are those of an "aggregate" ExecNode: one column
+  /// per aggregate followed by one column per key. Only "hash_count", "hash_min" and
+  /// "hash_max" (skipping nulls) are supported, and at least one key is required.
+  ///
+  /// When keys are partition fields, this method will compute the aggregates from
+  /// fragment metadata and partition expressions where possible (e.g. Parquet row group
+  /// statistics of row groups entirely satisfying the filter), only scanning the
+  /// remaining rows.
+  ///
+  /// The base implementation returns NotImplemented.
+  virtual Result<std::shared_ptr<Table>> AggregateByPartition(
+      compute::AggregateNodeOptions options);
   /// \brief Convert the Scanner to a RecordBatchReader so it can be
   /// easily used with APIs that expect a reader.
   Result<std::shared_ptr<RecordBatchReader>> ToRecordBatchReader();
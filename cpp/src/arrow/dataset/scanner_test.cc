@@ -496,6 +496,124 @@ TEST_P(TestScanner, CountRowsWithMetadata) {
                                   scanner->CountRows());
 }
 
+FragmentStatistics::ColumnStatistics MakeColumnStatistics(int64_t null_count,
+                                                          std::shared_ptr<Scalar> min,
+                                                          std::shared_ptr<Scalar> max) {
+  FragmentStatistics::ColumnStatistics column_statistics;
+  column_statistics.null_count = null_count;
+  column_statistics.min = std::move(min);
+  column_statistics.max = std::move(max);
+  return column_statistics;
+}
+
+// A partitioned fragment which can only be summarized by its statistics
+class StatisticsOnlyFragment : public InMemoryFragment {
+ public:
+  StatisticsOnlyFragment(int64_t num_rows,
+                         FragmentStatistics::ColumnStatistics column_statistics,
+                         compute::Expression partition_expression)
+      : InMemoryFragment(RecordBatchVector{}, std::move(partition_expression)),
+        num_rows_(num_rows),
+        column_statistics_(std::move(column_statistics)) {}
+
+  Future<FragmentStatistics> GetStatistics(
+      compute::Expression predicate, const std::vector<FieldRef>& columns,
+      const std::shared_ptr<ScanOptions>& options) override {
+    ARROW_ASSIGN_OR_RAISE(
+        predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+    if (predicate != literal(true)) {
+      return InMemoryFragment::GetStatistics(std::move(predicate), columns, options);
+    }
+    FragmentStatistics statistics;
+    statistics.num_rows = num_rows_;
+    statistics.columns.resize(columns.size(), column_statistics_);
+    return Future<FragmentStatistics>::MakeFinished(std::move(statistics));
+  }
+  Result<ScanTaskIterator> Scan(std::shared_ptr<ScanOptions>) override {
+    return Status::Invalid("Don't scan me!");
+  }
+  Result<RecordBatchGenerator> ScanBatchesAsync(
+      const std::shared_ptr<ScanOptions>&) override {
+    return Status::Invalid("Don't scan me!");
+  }
+
+ private:
+  int64_t num_rows_;
+  FragmentStatistics::ColumnStatistics column_statistics_;
+};
+
+TEST_P(TestScanner, AggregateByPartition) {
+  SetSchema({field("i32", int32()), field("part", utf8())});
+  auto physical_schema = schema({field("i32", int32())});
+  auto batch = RecordBatchFromJSON(physical_schema, R"([{"i32": 1}, {"i32": null},
+                                                       {"i32": 7}])");
+  auto partition = [](std::string value) {
+    return equal(field_ref("part"), literal(std::move(value)));
+  };
+
+  FragmentVector fragments{
+      std::make_shared<StatisticsOnlyFragment>(
+          10, MakeColumnStatistics(2, MakeScalar(-3), MakeScalar(9)),
+          partition("a")),
+      std::make_shared<ScanOnlyFragment>(RecordBatchVector{batch}, partition("a")),
+      std::make_shared<ScanOnlyFragment>(RecordBatchVector{batch}, partition("b")),
+      std::make_shared<StatisticsOnlyFragment>(
+          4, MakeColumnStatistics(4, nullptr, nullptr), partition("c")),
+  };
+  auto scanner = MakeScanner(std::make_shared<FragmentDataset>(schema_, fragments));
+  compute::AggregateNodeOptions options{
+      /*aggregates=*/{{"hash_count", nullptr},
+                      {"hash_min", nullptr},
+                      {"hash_max", nullptr}},
+      /*targets=*/{"i32", "i32", "i32"},
+      /*names=*/{"count(i32)", "min(i32)", "max(i32)"},
+      /*keys=*/{"part"}};
+
+  if (!GetParam().use_async) {
+    ASSERT_RAISES(NotImplemented, scanner->AggregateByPartition(options));
+    return;
+  }
+
+  auto output_schema = schema({field("count(i32)", int64()), field("min(i32)", int32()),
+                               field("max(i32)", int32()), field("part", utf8())});
+  auto sort_by_part = [](const std::shared_ptr<Table>& table) {
+    compute::SortOptions sort_options({compute::SortKey("part")});
+    EXPECT_OK_AND_ASSIGN(auto indices, compute::SortIndices(table, sort_options));
+    EXPECT_OK_AND_ASSIGN(auto sorted, compute::Take(table, indices));
+    return sorted.table();
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto actual, scanner->AggregateByPartition(options));
+  AssertTablesEqual(*TableFromJSON(output_schema, {R"([
+                      [10, -3,   9,    "a"],
+                      [2,  1,    7,    "b"],
+                      [0,  null, null, "c"]
+                    ])"}),
+                    *sort_by_part(actual), /*same_chunk_layout=*/false);
+
+  // Partition filters are resolved from metadata
+  ASSERT_OK_AND_ASSIGN(options_->filter,
+                       not_equal(field_ref("part"), literal("b")).Bind(*schema_));
+  ASSERT_OK_AND_ASSIGN(actual, scanner->AggregateByPartition(options));
+  AssertTablesEqual(*TableFromJSON(output_schema, {R"([
+                      [10, -3,   9,    "a"],
+                      [0,  null, null, "c"]
+                    ])"}),
+                    *sort_by_part(actual), /*same_chunk_layout=*/false);
+
+  // Other filters fall back to scanning
+  ASSERT_OK_AND_ASSIGN(options_->filter,
+                       greater(field_ref("i32"), literal(0)).Bind(*schema_));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("Don't scan me!"),
+                                  scanner->AggregateByPartition(options));
+
+  ASSERT_RAISES(NotImplemented,
+                scanner->AggregateByPartition(compute::AggregateNodeOptions{
+                    {{"hash_sum", nullptr}}, {"i32"}, {"sum(i32)"}, {"part"}}));
+  ASSERT_RAISES(Invalid, scanner->AggregateByPartition(compute::AggregateNodeOptions{
+                             {{"hash_count", nullptr}}, {"i32"}, {"count(i32)"}}));
+}
+
 TEST_P(TestScanner, ToRecordBatchReader) {
   SetSchema({field("i32", int32()), field("f64", float64())});
   auto batch = ConstantArrayGenerator::Zeroes(GetParam().items_per_batch, schema_);
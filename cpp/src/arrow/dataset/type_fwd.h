@@ -64,6 +64,8 @@ class IpcFileWriter;
 class IpcFileWriteOptions;
 class IpcFragmentScanOptions;
 
+class OrcFileFormat;
+
 class ParquetFileFormat;
 class ParquetFileFragment;
 class ParquetFragmentScanOptions;
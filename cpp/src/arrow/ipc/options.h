@@ -24,6 +24,7 @@
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -66,10 +67,33 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// May only be UNCOMPRESSED, LZ4_FRAME and ZSTD.
   std::shared_ptr<util::Codec> codec;
 
+  /// \brief Minimum space savings required for a body buffer to be compressed
+  ///
+  /// Space savings is calculated as (1.0 - compressed_size / uncompressed_size).
+  /// For example, if min_space_savings = 0.1, a 100-byte body buffer is written
+  /// uncompressed if its compressed size exceeds 90 bytes.  This allows
+  /// incompressible columns (e.g. random or already encoded data) to skip
+  /// decompression on the read path.
+  ///
+  /// If unset, all body buffers are compressed.  This option is ignored if
+  /// no codec is set.  Values outside of the range [0, 1] are handled as errors.
+  util::optional<double> min_space_savings;
+
   /// \brief Use global CPU thread pool to parallelize any computational tasks
   /// like compression
   bool use_threads = true;
 
+  /// \brief Overlap the writing of a message with the preparation of the next one
+  ///
+  /// If true, RecordBatchWriter returns as soon as a message is serialized
+  /// (and compressed), and the message is written to the output on the IO
+  /// thread pool while the caller prepares the next record batch.  At most one
+  /// message is being written at a time; write errors are reported by the next
+  /// call to the writer.
+  ///
+  /// The output must not be accessed by the caller before the writer is closed.
+  bool pipeline_writes = false;
+
   /// \brief Whether to emit dictionary deltas
   ///
   /// If false, a changed dictionary for a given field will emit a full
@@ -18,6 +18,7 @@
 #include "benchmark/benchmark.h"
 
 #include <cstdint>
+#include <limits>
 #include <sstream>
 #include <string>
 
@@ -28,6 +29,8 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/optional.h"
 
 namespace arrow {
 
@@ -49,6 +52,31 @@ std::shared_ptr<RecordBatch> MakeRecordBatch(int64_t total_size, int64_t num_fie
   return RecordBatch::Make(schema, length, arrays);
 }
 
+// Same as MakeRecordBatch, but every other column is incompressible
+std::shared_ptr<RecordBatch> MakeMixedRecordBatch(int64_t total_size,
+                                                  int64_t num_fields) {
+  int64_t length = total_size / num_fields / sizeof(int64_t);
+  random::RandomArrayGenerator rand(0x4f32a908);
+  auto type = arrow::int64();
+
+  ArrayVector arrays;
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int64_t i = 0; i < num_fields; ++i) {
+    std::stringstream ss;
+    ss << "f" << i;
+    fields.push_back(field(ss.str(), type));
+    if (i % 2 == 0) {
+      arrays.push_back(rand.Int64(length, 0, 100, 0.1));
+    } else {
+      arrays.push_back(rand.Int64(length, std::numeric_limits<int64_t>::min(),
+                                  std::numeric_limits<int64_t>::max(), 0));
+    }
+  }
+
+  auto schema = std::make_shared<Schema>(fields);
+  return RecordBatch::Make(schema, length, arrays);
+}
+
 static void WriteRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
   // 1MB
   constexpr int64_t kTotalSize = 1 << 20;
@@ -67,6 +95,32 @@ static void WriteRecordBatch(benchmark::State& state) {  // NOLINT non-const ref
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+static void WriteCompressedFile(benchmark::State& state,  // NOLINT non-const reference
+                                bool pipeline_writes,
+                                util::optional<double> min_space_savings) {
+  // 16 batches of 1MB, to a temporary file so that writing has a cost
+  constexpr int64_t kBatchSize = 1 << 20;
+  constexpr int64_t kBatches = 16;
+  auto options = ipc::IpcWriteOptions::Defaults();
+  ASSIGN_OR_ABORT(options.codec,
+                  arrow::util::Codec::Create(arrow::Compression::type::ZSTD));
+  options.pipeline_writes = pipeline_writes;
+  options.min_space_savings = min_space_savings;
+
+  auto record_batch = MakeMixedRecordBatch(kBatchSize, state.range(0));
+
+  for (auto _ : state) {
+    ASSIGN_OR_ABORT(auto sink, io::FileOutputStream::Open("/tmp/benchmark.arrow"));
+    auto writer = *ipc::MakeFileWriter(sink, record_batch->schema(), options);
+    for (int i = 0; i < kBatches; i++) {
+      ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+    }
+    ABORT_NOT_OK(writer->Close());
+    ABORT_NOT_OK(sink->Close());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kBatchSize * kBatches);
+}
+
 static void ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
   // 1MB
   constexpr int64_t kTotalSize = 1 << 20;
@@ -177,6 +231,30 @@ static void DecodeStream(benchmark::State& state) {  // NOLINT non-const referen
     ABORT_NOT_OK(stream.Close());                                                 \
   }
 
+#define GENERATE_MIXED_COMPRESSED_DATA_IN_MEMORY(MIN_SPACE_SAVINGS)               \
+  constexpr int64_t kBatchSize = 1 << 20; /* 1 MB */                              \
+  constexpr int64_t kBatches = 16;                                                \
+  auto options = ipc::IpcWriteOptions::Defaults();                                \
+  ASSIGN_OR_ABORT(options.codec,                                                  \
+                  arrow::util::Codec::Create(arrow::Compression::type::ZSTD));    \
+  options.min_space_savings = MIN_SPACE_SAVINGS;                                  \
+  std::shared_ptr<ResizableBuffer> buffer = *AllocateResizableBuffer(1024);       \
+  {                                                                               \
+    auto record_batch = MakeMixedRecordBatch(kBatchSize, state.range(0));         \
+    io::BufferOutputStream stream(buffer);                                        \
+    auto writer = *ipc::MakeFileWriter(&stream, record_batch->schema(), options); \
+    for (int i = 0; i < kBatches; i++) {                                          \
+      ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));                      \
+    }                                                                             \
+    ABORT_NOT_OK(writer->Close());                                                \
+    ABORT_NOT_OK(stream.Close());                                                 \
+  }
+
+#define GENERATE_MIXED_COMPRESSED_DATA_IN_MEMORY_ALWAYS() \
+  GENERATE_MIXED_COMPRESSED_DATA_IN_MEMORY(util::nullopt)
+#define GENERATE_MIXED_COMPRESSED_DATA_IN_MEMORY_MIN_SAVINGS() \
+  GENERATE_MIXED_COMPRESSED_DATA_IN_MEMORY(0.1)
+
 #define GENERATE_DATA_IN_MEMORY()                                                 \
   constexpr int64_t kBatchSize = 1 << 20; /* 1 MB */                              \
   constexpr int64_t kBatches = 1;                                                 \
@@ -253,8 +331,25 @@ READ_BENCHMARK(ReadTempFile, GENERATE_DATA_TEMP_FILE, READ_DATA_TEMP_FILE);
 READ_BENCHMARK(ReadMmapFile, GENERATE_DATA_TEMP_FILE, READ_DATA_MMAP_FILE);
 READ_BENCHMARK(ReadCompressedFile, GENERATE_COMPRESSED_DATA_IN_MEMORY,
                READ_DATA_IN_MEMORY);
+READ_BENCHMARK(ReadMixedCompressedFile, GENERATE_MIXED_COMPRESSED_DATA_IN_MEMORY_ALWAYS,
+               READ_DATA_IN_MEMORY);
+READ_BENCHMARK(ReadMixedCompressedFileMinSavings,
+               GENERATE_MIXED_COMPRESSED_DATA_IN_MEMORY_MIN_SAVINGS, READ_DATA_IN_MEMORY);
 
 BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK_CAPTURE(WriteCompressedFile, Serial, /*pipeline_writes=*/false, util::nullopt)
+    ->RangeMultiplier(4)
+    ->Range(1, 1 << 13)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(WriteCompressedFile, Pipelined, /*pipeline_writes=*/true, util::nullopt)
+    ->RangeMultiplier(4)
+    ->Range(1, 1 << 13)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(WriteCompressedFile, PipelinedMinSavings, /*pipeline_writes=*/true,
+                  util::optional<double>(0.1))
+    ->RangeMultiplier(4)
+    ->Range(1, 1 << 13)
+    ->UseRealTime();
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(DecodeStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
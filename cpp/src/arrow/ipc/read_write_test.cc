@@ -655,6 +655,45 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
   }
 }
 
+TEST_F(TestWriteRecordBatch, WriteWithCompressionAndMinSavings) {
+  random::RandomArrayGenerator rg(/*seed=*/0);
+
+  // A highly compressible column and an incompressible one
+  int64_t length = 1000;
+  auto schema = ::arrow::schema({field("f0", int64()), field("f1", int64())});
+  ASSERT_OK_AND_ASSIGN(auto zeros, MakeArrayFromScalar(Int64Scalar(0), length));
+  auto random = rg.Int64(length, std::numeric_limits<int64_t>::min(),
+                         std::numeric_limits<int64_t>::max(), /*null_probability=*/0);
+  auto batch = RecordBatch::Make(schema, length, {zeros, random});
+
+  std::vector<Compression::type> codecs = {Compression::LZ4_FRAME, Compression::ZSTD};
+  for (auto codec : codecs) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+    ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+    ASSERT_OK_AND_ASSIGN(auto always_compressed,
+                         SerializeRecordBatch(*batch, write_options));
+
+    for (double min_space_savings : {0.0, 0.5, 1.0}) {
+      ARROW_SCOPED_TRACE("min_space_savings = ", min_space_savings);
+      write_options.min_space_savings = min_space_savings;
+      CheckRoundtrip(*batch, write_options);
+    }
+
+    // Nothing can be compressed with 100% savings, so all buffers are stored raw
+    ASSERT_OK_AND_ASSIGN(auto never_compressed,
+                         SerializeRecordBatch(*batch, write_options));
+    ASSERT_GT(never_compressed->size(), always_compressed->size());
+
+    for (double min_space_savings : {-0.1, 1.1}) {
+      write_options.min_space_savings = min_space_savings;
+      ASSERT_RAISES(Invalid, SerializeRecordBatch(*batch, write_options));
+    }
+  }
+}
+
 TEST_F(TestWriteRecordBatch, SliceTruncatesBinaryOffsets) {
   // ARROW-6046
   std::shared_ptr<Array> array;
@@ -1401,6 +1440,11 @@ TEST_P(TestFileFormat, RoundTrip) {
   options.write_legacy_ipc_format = true;
   TestRoundTrip(*GetParam(), options);
   TestZeroLengthRoundTrip(*GetParam(), options);
+
+  options = IpcWriteOptions::Defaults();
+  options.pipeline_writes = true;
+  TestRoundTrip(*GetParam(), options);
+  TestZeroLengthRoundTrip(*GetParam(), options);
 }
 
 TEST_P(TestFileFormatGenerator, RoundTrip) {
@@ -1572,6 +1616,11 @@ TEST_P(TestStreamFormat, RoundTrip) {
   options.write_legacy_ipc_format = true;
   TestRoundTrip(*GetParam(), options);
   TestZeroLengthRoundTrip(*GetParam(), options);
+
+  options = IpcWriteOptions::Defaults();
+  options.pipeline_writes = true;
+  TestRoundTrip(*GetParam(), options);
+  TestZeroLengthRoundTrip(*GetParam(), options);
 }
 
 TEST_P(TestStreamDecoderData, RoundTrip) {
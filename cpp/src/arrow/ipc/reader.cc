@@ -140,12 +140,16 @@ struct IpcReadContext {
 /// batch is "consumed" (through nested data reconstruction, for example)
 class ArrayLoader {
  public:
+  // If body_range is given, buffers are read from that region of the file
+  // rather than from a file containing only the message body.
   explicit ArrayLoader(const flatbuf::RecordBatch* metadata,
                        MetadataVersion metadata_version, const IpcReadOptions& options,
-                       io::RandomAccessFile* file)
+                       io::RandomAccessFile* file,
+                       const io::ReadRange* body_range = NULLPTR)
       : metadata_(metadata),
         metadata_version_(metadata_version),
         file_(file),
+        body_range_(body_range),
         max_recursion_depth_(options.max_recursion_depth) {}
 
   Status ReadBuffer(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
@@ -163,6 +167,13 @@ class ArrayLoader {
       return Status::Invalid("Buffer ", buffer_index_,
                              " did not start on 8-byte aligned offset: ", offset);
     }
+    if (body_range_ != NULLPTR) {
+      if (offset + length > body_range_->length) {
+        return Status::Invalid("Buffer ", buffer_index_,
+                               " extends past the end of the message body");
+      }
+      offset += body_range_->offset;
+    }
     return file_->ReadAt(offset, length).Value(out);
   }
 
@@ -387,6 +398,7 @@ class ArrayLoader {
   const flatbuf::RecordBatch* metadata_;
   const MetadataVersion metadata_version_;
   io::RandomAccessFile* file_;
+  const io::ReadRange* body_range_;
   int max_recursion_depth_;
   int buffer_index_ = 0;
   int field_index_ = 0;
@@ -412,6 +424,10 @@ Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>&
   const uint8_t* data = buf->data();
   int64_t compressed_size = buf->size() - sizeof(int64_t);
   int64_t uncompressed_size = BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
+  if (uncompressed_size == -1) {
+    // The writer chose to leave this buffer uncompressed
+    return SliceBuffer(buf, sizeof(int64_t), compressed_size);
+  }
 
   ARROW_ASSIGN_OR_RAISE(auto uncompressed,
                         AllocateBuffer(uncompressed_size, options.memory_pool));
@@ -468,8 +484,9 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>* inclusion_mask, const IpcReadContext& context,
-    io::RandomAccessFile* file) {
-  ArrayLoader loader(metadata, context.metadata_version, context.options, file);
+    io::RandomAccessFile* file, const io::ReadRange* body_range = NULLPTR) {
+  ArrayLoader loader(metadata, context.metadata_version, context.options, file,
+                     body_range);
 
   ArrayDataVector columns(schema->num_fields());
   ArrayDataVector filtered_columns;
@@ -528,11 +545,13 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatch(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, const IpcReadContext& context,
-    io::RandomAccessFile* file) {
+    io::RandomAccessFile* file, const io::ReadRange* body_range = NULLPTR) {
   if (inclusion_mask.size() > 0) {
-    return LoadRecordBatchSubset(metadata, schema, &inclusion_mask, context, file);
+    return LoadRecordBatchSubset(metadata, schema, &inclusion_mask, context, file,
+                                 body_range);
   } else {
-    return LoadRecordBatchSubset(metadata, schema, /*param_name=*/nullptr, context, file);
+    return LoadRecordBatchSubset(metadata, schema, /*param_name=*/nullptr, context, file,
+                                 body_range);
   }
 }
 
@@ -611,7 +630,7 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
 Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
     const Buffer& metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, IpcReadContext& context,
-    io::RandomAccessFile* file) {
+    io::RandomAccessFile* file, const io::ReadRange* body_range = NULLPTR) {
   const flatbuf::Message* message = nullptr;
   RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
   auto batch = message->header_as_RecordBatch();
@@ -630,7 +649,7 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
   }
   context.compression = compression;
   context.metadata_version = internal::GetMetadataVersion(message->version());
-  return LoadRecordBatch(batch, schema, inclusion_mask, context, file);
+  return LoadRecordBatch(batch, schema, inclusion_mask, context, file, body_range);
 }
 
 // If we are selecting only certain fields, populate an inclusion mask for fast lookups.
@@ -983,6 +1002,45 @@ static Result<std::unique_ptr<Message>> ReadMessageFromBlock(const FileBlock& bl
   return std::move(message);
 }
 
+// Read the metadata of the message in a file block, leaving its body in the file
+static Result<std::unique_ptr<Message>> ReadMessageMetadataFromBlock(
+    const FileBlock& block, io::RandomAccessFile* file) {
+  if (!BitUtil::IsMultipleOf8(block.offset) ||
+      !BitUtil::IsMultipleOf8(block.metadata_length) ||
+      !BitUtil::IsMultipleOf8(block.body_length)) {
+    return Status::Invalid("Unaligned block in IPC file");
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto metadata, file->ReadAt(block.offset, block.metadata_length));
+  if (metadata->size() < block.metadata_length) {
+    return Status::Invalid("Expected to read ", block.metadata_length,
+                           " metadata bytes but got ", metadata->size());
+  }
+
+  // Skip the continuation token, if any, and the flatbuffer length
+  int64_t prefix_length = sizeof(int32_t);
+  if (metadata->size() < prefix_length) {
+    return Status::Invalid("Message metadata too short in IPC file");
+  }
+  int32_t flatbuffer_length =
+      BitUtil::FromLittleEndian(util::SafeLoadAs<int32_t>(metadata->data()));
+  if (flatbuffer_length == internal::kIpcContinuationToken) {
+    prefix_length += sizeof(int32_t);
+    if (metadata->size() < prefix_length) {
+      return Status::Invalid("Message metadata too short in IPC file");
+    }
+    flatbuffer_length = BitUtil::FromLittleEndian(
+        util::SafeLoadAs<int32_t>(metadata->data() + sizeof(int32_t)));
+  }
+  if (flatbuffer_length < 0 || prefix_length + flatbuffer_length > metadata->size()) {
+    return Status::Invalid("Invalid message metadata length in IPC file: ",
+                           flatbuffer_length);
+  }
+
+  return Message::Open(SliceBuffer(metadata, prefix_length, flatbuffer_length),
+                       /*body=*/nullptr);
+}
+
 static Future<std::shared_ptr<Message>> ReadMessageFromBlockAsync(
     const FileBlock& block, io::RandomAccessFile* file, const io::IOContext& io_context) {
   if (!BitUtil::IsMultipleOf8(block.offset) ||
@@ -1070,14 +1128,29 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       read_dictionaries_ = true;
     }
 
-    ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(GetRecordBatchBlock(i)));
-
-    CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+    const FileBlock block = GetRecordBatchBlock(i);
     IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
-    ARROW_ASSIGN_OR_RAISE(auto batch, ReadRecordBatchInternal(
-                                          *message->metadata(), schema_,
-                                          field_inclusion_mask_, context, reader.get()));
+    std::shared_ptr<RecordBatch> batch;
+    if (file_->supports_zero_copy() && !field_inclusion_mask_.empty()) {
+      // Read the included buffers straight from the file: zero-copy reads of
+      // the whole body would page in (e.g. madvise()) the excluded fields too.
+      ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageMetadataFromBlock(block));
+      CHECK_MESSAGE_TYPE(MessageType::RECORD_BATCH, message->type());
+      const io::ReadRange body_range{block.offset + block.metadata_length,
+                                     message->body_length()};
+      ARROW_ASSIGN_OR_RAISE(
+          batch, ReadRecordBatchInternal(*message->metadata(), schema_,
+                                         field_inclusion_mask_, context, file_,
+                                         &body_range));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(block));
+
+      CHECK_HAS_BODY(*message);
+      ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+      ARROW_ASSIGN_OR_RAISE(batch, ReadRecordBatchInternal(*message->metadata(), schema_,
+                                                           field_inclusion_mask_,
+                                                           context, reader.get()));
+    }
     ++stats_.num_record_batches;
     return batch;
   }
@@ -1199,6 +1272,13 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return std::move(message);
   }
 
+  Result<std::unique_ptr<Message>> ReadMessageMetadataFromBlock(const FileBlock& block) {
+    ARROW_ASSIGN_OR_RAISE(auto message,
+                          arrow::ipc::ReadMessageMetadataFromBlock(block, file_));
+    ++stats_.num_messages;
+    return std::move(message);
+  }
+
   Status ReadDictionaries() {
     // Read all the dictionaries
     IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
@@ -50,10 +50,12 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/endian.h"
+#include "arrow/util/future.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -185,14 +187,31 @@ class RecordBatchSerializer {
                         std::shared_ptr<Buffer>* out) {
     // Convert buffer to uncompressed-length-prefixed compressed buffer
     int64_t maximum_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
-    ARROW_ASSIGN_OR_RAISE(auto result, AllocateBuffer(maximum_length + sizeof(int64_t)));
+    // Leave room for storing the buffer uncompressed, see below
+    ARROW_ASSIGN_OR_RAISE(
+        auto result,
+        AllocateBuffer(std::max(maximum_length, buffer.size()) + sizeof(int64_t)));
 
     int64_t actual_length;
     ARROW_ASSIGN_OR_RAISE(actual_length,
                           codec->Compress(buffer.size(), buffer.data(), maximum_length,
                                           result->mutable_data() + sizeof(int64_t)));
-    *reinterpret_cast<int64_t*>(result->mutable_data()) =
-        BitUtil::ToLittleEndian(buffer.size());
+    int64_t prefix = buffer.size();
+
+    if (options_.min_space_savings.has_value()) {
+      const double space_savings =
+          1.0 - static_cast<double>(actual_length) / static_cast<double>(buffer.size());
+      if (space_savings < *options_.min_space_savings) {
+        // Not worth compressing: a length prefix of -1 tells the reader that
+        // the buffer data follows uncompressed
+        std::memcpy(result->mutable_data() + sizeof(int64_t), buffer.data(),
+                    static_cast<size_t>(buffer.size()));
+        actual_length = buffer.size();
+        prefix = -1;
+      }
+    }
+
+    *reinterpret_cast<int64_t*>(result->mutable_data()) = BitUtil::ToLittleEndian(prefix);
     *out = SliceBuffer(std::move(result), /*offset=*/0, actual_length + sizeof(int64_t));
     return Status::OK();
   }
@@ -200,6 +219,13 @@ class RecordBatchSerializer {
   Status CompressBodyBuffers() {
     RETURN_NOT_OK(
         internal::CheckCompressionSupported(options_.codec->compression_type()));
+    if (options_.min_space_savings.has_value()) {
+      const double min_space_savings = *options_.min_space_savings;
+      if (!(min_space_savings >= 0 && min_space_savings <= 1)) {
+        return Status::Invalid("min_space_savings must be in the range [0, 1], got ",
+                               min_space_savings);
+      }
+    }
 
     auto CompressOne = [&](size_t i) {
       if (out_->body_buffers[i]->size() > 0) {
@@ -986,6 +1012,13 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     shared_schema_ = schema;
   }
 
+  ~IpcFormatWriter() override {
+    // The payload writer must outlive any in-flight write
+    if (pending_write_.is_valid()) {
+      pending_write_.Wait();
+    }
+  }
+
   Status WriteRecordBatch(const RecordBatch& batch) override {
     if (!batch.schema()->Equals(schema_, false /* check_metadata */)) {
       return Status::Invalid("Tried to write record batch with different schema");
@@ -1014,6 +1047,7 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
   Status Close() override {
     RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(FinishPendingWrite());
     return payload_writer_->Close();
   }
 
@@ -1106,11 +1140,33 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   }
 
   Status WritePayload(const IpcPayload& payload) {
-    RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+    // Messages must be written in order, one at a time
+    RETURN_NOT_OK(FinishPendingWrite());
+    if (options_.pipeline_writes) {
+      // Write in the background while the caller prepares the next message.
+      // The payload owns its buffers, so they outlive the write.
+      IpcPayloadWriter* payload_writer = payload_writer_.get();
+      ARROW_ASSIGN_OR_RAISE(pending_write_,
+                            io::default_io_context().executor()->Submit(
+                                [payload_writer, payload]() -> Status {
+                                  return payload_writer->WritePayload(payload);
+                                }));
+    } else {
+      RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+    }
     ++stats_.num_messages;
     return Status::OK();
   }
 
+  Status FinishPendingWrite() {
+    if (!pending_write_.is_valid()) {
+      return Status::OK();
+    }
+    auto pending_write = std::move(pending_write_);
+    pending_write_ = Future<>();
+    return pending_write.status();
+  }
+
   std::unique_ptr<IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
   const Schema& schema_;
@@ -1127,6 +1183,8 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   bool started_ = false;
   IpcWriteOptions options_;
   WriteStats stats_;
+  // The message being written in the background, if options_.pipeline_writes
+  Future<> pending_write_;
 };
 
 class StreamBookKeeper {
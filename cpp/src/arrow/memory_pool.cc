@@ -19,11 +19,15 @@
 
 #include <algorithm>  // IWYU pragma: keep
 #include <atomic>
+#include <cerrno>
 #include <cstdlib>   // IWYU pragma: keep
 #include <cstring>   // IWYU pragma: keep
 #include <iostream>  // IWYU pragma: keep
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
 
 #if defined(sun) || defined(__sun)
 #include <stdlib.h>
@@ -44,6 +48,12 @@
 #include <malloc.h>
 #endif
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
 #define JEMALLOC_MANGLE
@@ -674,6 +684,581 @@ int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// ChildMemoryPool implementation
+
+class ChildMemoryPool::ChildMemoryPoolImpl {
+ public:
+  ChildMemoryPoolImpl(MemoryPool* parent, std::string name, int64_t limit)
+      : parent_(parent), name_(std::move(name)), limit_(limit) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(Reserve(size));
+    Status st = parent_->Allocate(size, out);
+    if (!st.ok()) {
+      Release(size);
+      return st;
+    }
+    num_allocations_.fetch_add(1, std::memory_order_relaxed);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int64_t diff = new_size - old_size;
+    if (diff > 0) {
+      RETURN_NOT_OK(Reserve(diff));
+    }
+    Status st = parent_->Reallocate(old_size, new_size, ptr);
+    if (!st.ok()) {
+      if (diff > 0) Release(diff);
+      return st;
+    }
+    if (diff < 0) Release(-diff);
+    num_allocations_.fetch_add(1, std::memory_order_relaxed);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    parent_->Free(buffer, size);
+    Release(size);
+  }
+
+  int64_t bytes_allocated() const { return bytes_allocated_.load(); }
+
+  int64_t max_memory() const { return max_memory_.load(); }
+
+  int64_t num_allocations() const { return num_allocations_.load(); }
+
+  MemoryPool* parent() const { return parent_; }
+
+  const std::string& name() const { return name_; }
+
+  int64_t limit() const { return limit_; }
+
+ private:
+  Status Reserve(int64_t size) {
+    int64_t allocated;
+    if (limit_ < 0) {
+      allocated = bytes_allocated_.fetch_add(size) + size;
+    } else {
+      // Only commit the reservation if it fits, so that concurrent allocations
+      // can't fail because of a transient overshoot
+      allocated = bytes_allocated_.load();
+      do {
+        if (allocated + size > limit_) {
+          return Status::OutOfMemory("ChildMemoryPool '", name_, "': allocation of ",
+                                     size, " bytes would exceed the limit of ", limit_,
+                                     " bytes (", allocated, " bytes allocated)");
+        }
+      } while (!bytes_allocated_.compare_exchange_weak(allocated, allocated + size));
+      allocated += size;
+    }
+    // Same caveat as MemoryPoolStats: this is best-effort under concurrency
+    if (allocated > max_memory_.load(std::memory_order_relaxed)) {
+      max_memory_.store(allocated, std::memory_order_relaxed);
+    }
+    return Status::OK();
+  }
+
+  void Release(int64_t size) { bytes_allocated_.fetch_sub(size); }
+
+  MemoryPool* parent_;
+  const std::string name_;
+  const int64_t limit_;
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> max_memory_{0};
+  std::atomic<int64_t> num_allocations_{0};
+};
+
+ChildMemoryPool::ChildMemoryPool(MemoryPool* parent, std::string name, int64_t limit)
+    : impl_(new ChildMemoryPoolImpl(parent, std::move(name), limit)) {}
+
+ChildMemoryPool::~ChildMemoryPool() {}
+
+Status ChildMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ChildMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ChildMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+void ChildMemoryPool::ReleaseUnused() { impl_->parent()->ReleaseUnused(); }
+
+int64_t ChildMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ChildMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string ChildMemoryPool::backend_name() const {
+  return impl_->parent()->backend_name();
+}
+
+MemoryPool* ChildMemoryPool::parent() const { return impl_->parent(); }
+
+const std::string& ChildMemoryPool::name() const { return impl_->name(); }
+
+int64_t ChildMemoryPool::limit() const { return impl_->limit(); }
+
+int64_t ChildMemoryPool::num_allocations() const { return impl_->num_allocations(); }
+
+///////////////////////////////////////////////////////////////////////
+// RecyclingMemoryPool implementation
+
+namespace {
+
+// Size classes are powers of two from kAlignment (so that recycled buffers stay
+// aligned) up to kAlignment << (kMaxSizeClasses - 1)
+constexpr int kMaxSizeClasses = 20;
+// Bound on the memory held by each thread for a given size class
+constexpr int64_t kMaxCachedBytesPerSizeClass = 1 << 20;
+constexpr int64_t kMaxCachedBuffersPerSizeClass = 256;
+
+int SizeClassOf(int64_t size) {
+  return BitUtil::Log2(static_cast<uint64_t>(std::max<int64_t>(size, kAlignment))) -
+         BitUtil::Log2(kAlignment);
+}
+
+int64_t SizeClassBytes(int size_class) {
+  return static_cast<int64_t>(kAlignment) << size_class;
+}
+
+class RecyclingThreadCache;
+
+// State shared between a RecyclingMemoryPool and the thread caches referring to it,
+// so that the thread caches can detect that the pool was destroyed.
+struct RecyclingPoolState {
+  RecyclingPoolState(MemoryPool* parent, int num_size_classes)
+      : parent(parent), num_size_classes(num_size_classes) {}
+
+  MemoryPool* const parent;
+  const int num_size_classes;
+
+  std::mutex mutex;
+  std::atomic<bool> alive{true};
+  std::unordered_set<RecyclingThreadCache*> caches;
+};
+
+class RecyclingThreadCache {
+ public:
+  explicit RecyclingThreadCache(std::shared_ptr<RecyclingPoolState> state)
+      : state_(std::move(state)), free_lists_(state_->num_size_classes) {}
+
+  const std::shared_ptr<RecyclingPoolState>& state() const { return state_; }
+
+  uint8_t* Pop(int size_class) {
+    auto& free_list = free_lists_[size_class];
+    if (free_list.empty()) return NULLPTR;
+    uint8_t* buffer = free_list.back();
+    free_list.pop_back();
+    return buffer;
+  }
+
+  bool Push(uint8_t* buffer, int size_class) {
+    auto& free_list = free_lists_[size_class];
+    const auto max_buffers =
+        std::min(kMaxCachedBuffersPerSizeClass,
+                 std::max<int64_t>(1, kMaxCachedBytesPerSizeClass /
+                                          SizeClassBytes(size_class)));
+    if (static_cast<int64_t>(free_list.size()) >= max_buffers) return false;
+    free_list.push_back(buffer);
+    return true;
+  }
+
+  // Return all cached buffers to the parent pool
+  void Drain() {
+    for (int size_class = 0; size_class < state_->num_size_classes; ++size_class) {
+      for (uint8_t* buffer : free_lists_[size_class]) {
+        state_->parent->Free(buffer, SizeClassBytes(size_class));
+      }
+      free_lists_[size_class].clear();
+    }
+  }
+
+ private:
+  std::shared_ptr<RecyclingPoolState> state_;
+  std::vector<std::vector<uint8_t*>> free_lists_;
+};
+
+// The caches of all RecyclingMemoryPools used by a thread
+class RecyclingThreadCaches {
+ public:
+  ~RecyclingThreadCaches() {
+    for (const auto& cache : caches_) {
+      Unregister(cache.get());
+    }
+  }
+
+  RecyclingThreadCache* Get(const std::shared_ptr<RecyclingPoolState>& state) {
+    if (last_ != NULLPTR && last_->state() == state) return last_;
+
+    last_ = NULLPTR;
+    for (auto it = caches_.begin(); it != caches_.end();) {
+      if ((*it)->state() == state) {
+        last_ = it->get();
+        return last_;
+      }
+      if (IsDead(it->get())) {
+        it = caches_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    std::unique_ptr<RecyclingThreadCache> cache(new RecyclingThreadCache(state));
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->caches.insert(cache.get());
+    }
+    caches_.push_back(std::move(cache));
+    last_ = caches_.back().get();
+    return last_;
+  }
+
+  void Unregister(RecyclingThreadCache* cache) {
+    const auto& state = cache->state();
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->alive.load()) {
+      cache->Drain();
+      state->caches.erase(cache);
+    }
+  }
+
+ private:
+  // Whether the pool of the cache was destroyed and drained the cache
+  static bool IsDead(RecyclingThreadCache* cache) {
+    const auto& state = cache->state();
+    if (state->alive.load()) return false;
+    // The destroying thread may still be draining the cache under the mutex
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return true;
+  }
+
+  std::vector<std::unique_ptr<RecyclingThreadCache>> caches_;
+  RecyclingThreadCache* last_ = NULLPTR;
+};
+
+thread_local RecyclingThreadCaches recycling_thread_caches;
+
+}  // namespace
+
+constexpr int64_t RecyclingMemoryPool::kDefaultMaxCachedSize;
+
+class RecyclingMemoryPool::RecyclingMemoryPoolImpl {
+ public:
+  RecyclingMemoryPoolImpl(MemoryPool* parent, int64_t max_cached_size)
+      : max_cached_size_(std::max<int64_t>(
+            kAlignment,
+            std::min(max_cached_size, SizeClassBytes(kMaxSizeClasses - 1)))),
+        state_(std::make_shared<RecyclingPoolState>(
+            parent, SizeClassOf(max_cached_size_) + 1)) {}
+
+  ~RecyclingMemoryPoolImpl() {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->alive.store(false);
+    // The pool must not be in use anymore, so this doesn't race with the
+    // threads owning the caches
+    for (auto cache : state_->caches) {
+      cache->Drain();
+    }
+    state_->caches.clear();
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size > 0 && size <= max_cached_size_) {
+      const int size_class = SizeClassOf(size);
+      uint8_t* buffer = recycling_thread_caches.Get(state_)->Pop(size_class);
+      if (buffer == NULLPTR) {
+        RETURN_NOT_OK(parent()->Allocate(SizeClassBytes(size_class), &buffer));
+      }
+      *out = buffer;
+    } else {
+      RETURN_NOT_OK(parent()->Allocate(size, out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const bool old_cached = old_size > 0 && old_size <= max_cached_size_;
+    const bool new_cached = new_size > 0 && new_size <= max_cached_size_;
+    if (!old_cached && !new_cached) {
+      RETURN_NOT_OK(parent()->Reallocate(old_size, new_size, ptr));
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    if (old_cached && new_cached && SizeClassOf(old_size) == SizeClassOf(new_size)) {
+      // The buffer is large enough already
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* new_buffer;
+    RETURN_NOT_OK(Allocate(new_size, &new_buffer));
+    std::memcpy(new_buffer, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = new_buffer;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (size > 0 && size <= max_cached_size_) {
+      const int size_class = SizeClassOf(size);
+      if (!recycling_thread_caches.Get(state_)->Push(buffer, size_class)) {
+        parent()->Free(buffer, SizeClassBytes(size_class));
+      }
+    } else {
+      parent()->Free(buffer, size);
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  void ReleaseUnused() {
+    recycling_thread_caches.Get(state_)->Drain();
+    parent()->ReleaseUnused();
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  MemoryPool* parent() const { return state_->parent; }
+
+ private:
+  const int64_t max_cached_size_;
+  std::shared_ptr<RecyclingPoolState> state_;
+  internal::MemoryPoolStats stats_;
+};
+
+RecyclingMemoryPool::RecyclingMemoryPool(MemoryPool* parent, int64_t max_cached_size)
+    : impl_(new RecyclingMemoryPoolImpl(parent, max_cached_size)) {}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {}
+
+Status RecyclingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+void RecyclingMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+int64_t RecyclingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string RecyclingMemoryPool::backend_name() const {
+  return impl_->parent()->backend_name();
+}
+
+///////////////////////////////////////////////////////////////////////
+// HugePageMemoryPool implementation
+
+namespace {
+
+constexpr int64_t kHugePageSize = 2 * 1024 * 1024;
+
+#ifdef __linux__
+
+// Prefer the NUMA node of the calling thread for the given range (best effort).
+// This uses the raw system calls to avoid depending on libnuma.
+void BindToLocalNumaNode(void* addr, int64_t length) {
+#if defined(SYS_getcpu) && defined(SYS_mbind)
+  // MPOL_PREFERRED in <linux/mempolicy.h>
+  constexpr int kMpolPreferred = 1;
+  constexpr unsigned int kMaxNumaNodes = 1024;
+  constexpr int kBitsPerWord = 8 * sizeof(unsigned long);  // NOLINT runtime/int
+
+  unsigned int cpu, node;
+  if (syscall(SYS_getcpu, &cpu, &node, NULLPTR) != 0 || node >= kMaxNumaNodes) {
+    return;
+  }
+  unsigned long nodemask[kMaxNumaNodes / kBitsPerWord] = {};  // NOLINT runtime/int
+  nodemask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+  syscall(SYS_mbind, addr, static_cast<unsigned long>(length),  // NOLINT runtime/int
+          kMpolPreferred, nodemask, kMaxNumaNodes + 1, 0);
+#endif
+}
+
+#endif  // __linux__
+
+}  // namespace
+
+class HugePageMemoryPool::HugePageMemoryPoolImpl {
+ public:
+  HugePageMemoryPoolImpl(MemoryPool* parent, HugePageMemoryPoolOptions options)
+      : parent_(parent), options_(options) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (IsMapped(size)) {
+      RETURN_NOT_OK(Map(size, out));
+    } else {
+      RETURN_NOT_OK(parent_->Allocate(size, out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const bool old_mapped = IsMapped(old_size);
+    const bool new_mapped = IsMapped(new_size);
+    if (!old_mapped && !new_mapped) {
+      RETURN_NOT_OK(parent_->Reallocate(old_size, new_size, ptr));
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    if (old_mapped && new_mapped && MappedSize(old_size) == MappedSize(new_size)) {
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* new_buffer;
+    RETURN_NOT_OK(Allocate(new_size, &new_buffer));
+    std::memcpy(new_buffer, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = new_buffer;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (IsMapped(size)) {
+      Unmap(buffer, size);
+    } else {
+      parent_->Free(buffer, size);
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_mapped() const { return bytes_mapped_.load(); }
+
+  MemoryPool* parent() const { return parent_; }
+
+ private:
+  bool IsMapped(int64_t size) const {
+#ifdef __linux__
+    return size > 0 && size >= options_.min_mapped_size;
+#else
+    return false;
+#endif
+  }
+
+  static int64_t MappedSize(int64_t size) {
+    return BitUtil::RoundUp(size, kHugePageSize);
+  }
+
+#ifdef __linux__
+  Status Map(int64_t size, uint8_t** out) {
+    const int64_t length = MappedSize(size);
+    void* addr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (options_.explicit_huge_pages) {
+      // Huge page mappings are naturally aligned
+      addr = mmap(NULLPTR, static_cast<size_t>(length), PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+    if (addr == MAP_FAILED) {
+      // Over-allocate to align the mapping on a huge page boundary, which is
+      // required for the kernel to back it with transparent huge pages
+      const int64_t padded_length = length + kHugePageSize;
+      auto padded = static_cast<uint8_t*>(mmap(NULLPTR,
+                                               static_cast<size_t>(padded_length),
+                                               PROT_READ | PROT_WRITE,
+                                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+      if (padded == MAP_FAILED) {
+        return Status::OutOfMemory("mmap of ", length, " bytes failed: ",
+                                   std::strerror(errno));
+      }
+      auto aligned = reinterpret_cast<uint8_t*>(
+          BitUtil::RoundUp(reinterpret_cast<int64_t>(padded), kHugePageSize));
+      const int64_t head = aligned - padded;
+      if (head > 0) {
+        munmap(padded, static_cast<size_t>(head));
+      }
+      const int64_t tail = padded_length - head - length;
+      if (tail > 0) {
+        munmap(aligned + length, static_cast<size_t>(tail));
+      }
+      addr = aligned;
+#ifdef MADV_HUGEPAGE
+      if (options_.transparent_huge_pages) {
+        madvise(addr, static_cast<size_t>(length), MADV_HUGEPAGE);
+      }
+#endif
+    }
+    if (options_.bind_to_local_numa_node) {
+      // Before the pages are first touched, so that they are faulted in on that node
+      BindToLocalNumaNode(addr, length);
+    }
+    bytes_mapped_.fetch_add(length);
+    *out = static_cast<uint8_t*>(addr);
+    return Status::OK();
+  }
+
+  void Unmap(uint8_t* buffer, int64_t size) {
+    const int64_t length = MappedSize(size);
+    if (munmap(buffer, static_cast<size_t>(length)) != 0) {
+      ARROW_LOG(WARNING) << "munmap failed: " << std::strerror(errno);
+    }
+    bytes_mapped_.fetch_sub(length);
+  }
+#else
+  Status Map(int64_t size, uint8_t** out) {
+    return Status::NotImplemented("HugePageMemoryPool: mapping memory");
+  }
+
+  void Unmap(uint8_t* buffer, int64_t size) {}
+#endif
+
+  MemoryPool* parent_;
+  const HugePageMemoryPoolOptions options_;
+  std::atomic<int64_t> bytes_mapped_{0};
+  internal::MemoryPoolStats stats_;
+};
+
+HugePageMemoryPool::HugePageMemoryPool(MemoryPool* parent,
+                                       HugePageMemoryPoolOptions options)
+    : impl_(new HugePageMemoryPoolImpl(parent, options)) {}
+
+HugePageMemoryPool::~HugePageMemoryPool() {}
+
+Status HugePageMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status HugePageMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void HugePageMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+void HugePageMemoryPool::ReleaseUnused() { impl_->parent()->ReleaseUnused(); }
+
+int64_t HugePageMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t HugePageMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string HugePageMemoryPool::backend_name() const {
+  return impl_->parent()->backend_name();
+}
+
+int64_t HugePageMemoryPool::bytes_mapped() const { return impl_->bytes_mapped(); }
+
 std::vector<std::string> SupportedMemoryBackendNames() {
   std::vector<std::string> supported;
   for (const auto backend : SupportedBackends()) {
@@ -156,6 +156,170 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A memory pool accounting allocations of a single component.
+///
+/// Allocation is delegated to a parent pool.  The parent may itself be a
+/// ChildMemoryPool, so that pools form a hierarchy (for example process, query,
+/// operator) where each level tracks the memory held by its subtree.
+///
+/// If a limit is set, allocations which would bring bytes_allocated() above it
+/// fail with OutOfMemory.  An allocation must fit within the limits of all the
+/// ancestor pools as well.
+class ARROW_EXPORT ChildMemoryPool : public MemoryPool {
+ public:
+  /// \brief Create a child of the given pool
+  ///
+  /// \param[in] parent the pool allocations are delegated to; must outlive
+  ///   this pool and all the buffers allocated from it
+  /// \param[in] name a name for display and error messages
+  /// \param[in] limit the maximum number of bytes allocated at any time,
+  ///   or -1 for no limit
+  explicit ChildMemoryPool(MemoryPool* parent, std::string name = "",
+                           int64_t limit = -1);
+  ~ChildMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  void ReleaseUnused() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The pool allocations are delegated to
+  MemoryPool* parent() const;
+
+  const std::string& name() const;
+
+  /// The maximum number of bytes allocated at any time, or -1 for no limit
+  int64_t limit() const;
+
+  /// The number of allocations (including reallocations) made through this pool
+  int64_t num_allocations() const;
+
+ private:
+  class ChildMemoryPoolImpl;
+  std::unique_ptr<ChildMemoryPoolImpl> impl_;
+};
+
+/// \brief A memory pool recycling freed small buffers.
+///
+/// Allocations of up to max_cached_size bytes are rounded up to a power-of-two
+/// size class (of at least 64 bytes).  When such a buffer is freed, it is kept in
+/// a free list local to the freeing thread and handed out again by the next
+/// allocation of the same size class on that thread, instead of going through
+/// the parent pool.  This pays off for workloads that repeatedly allocate and
+/// free similarly-sized temporary buffers, such as kernel outputs over small
+/// batches.
+///
+/// The number of buffers cached per thread and size class is bounded.  Cached
+/// buffers are returned to the parent when the thread exits, when
+/// ReleaseUnused() is called from that thread, and when this pool is destroyed.
+/// bytes_allocated() does not include cached buffers, but the parent's does.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultMaxCachedSize = 256 * 1024;
+
+  /// \brief Create a recycling pool
+  ///
+  /// \param[in] parent the pool allocations are delegated to; must outlive
+  ///   this pool and all the buffers allocated from it
+  /// \param[in] max_cached_size the largest allocation size to recycle
+  explicit RecyclingMemoryPool(MemoryPool* parent,
+                               int64_t max_cached_size = kDefaultMaxCachedSize);
+  ~RecyclingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// Return the buffers cached by the calling thread to the parent pool,
+  /// then release unused memory in the parent pool.
+  void ReleaseUnused() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  class RecyclingMemoryPoolImpl;
+  std::unique_ptr<RecyclingMemoryPoolImpl> impl_;
+};
+
+/// \brief Options for HugePageMemoryPool
+struct ARROW_EXPORT HugePageMemoryPoolOptions {
+  /// \brief Allocations of at least this many bytes are mapped directly
+  ///
+  /// Smaller allocations are delegated to the parent pool.  Mapped allocations
+  /// are rounded up to a multiple of the huge page size (2MB).
+  int64_t min_mapped_size = 2 * 1024 * 1024;
+
+  /// \brief Ask for transparent huge pages (madvise(MADV_HUGEPAGE))
+  bool transparent_huge_pages = true;
+
+  /// \brief First try to map explicit huge pages (MAP_HUGETLB)
+  ///
+  /// This requires huge pages to be reserved by the system administrator.
+  /// If none are available, regular pages are mapped instead.
+  bool explicit_huge_pages = false;
+
+  /// \brief Prefer placing mapped allocations on the NUMA node of the allocating
+  /// thread
+  bool bind_to_local_numa_node = false;
+
+  static HugePageMemoryPoolOptions Defaults() { return HugePageMemoryPoolOptions(); }
+};
+
+/// \brief A memory pool backing large allocations with huge pages.
+///
+/// Large hash tables and sort buffers accessed randomly incur many TLB misses
+/// when backed by regular 4KB pages.  This pool maps large allocations directly,
+/// aligned on 2MB boundaries so that they can be backed by huge pages, and can
+/// place them on the NUMA node of the allocating thread.
+///
+/// Huge pages and NUMA placement are only supported on Linux; on other platforms
+/// all allocations are delegated to the parent pool.
+class ARROW_EXPORT HugePageMemoryPool : public MemoryPool {
+ public:
+  /// \brief Create a huge page pool
+  ///
+  /// \param[in] parent the pool small allocations are delegated to; must outlive
+  ///   this pool and all the buffers allocated from it
+  /// \param[in] options the pool options
+  explicit HugePageMemoryPool(
+      MemoryPool* parent,
+      HugePageMemoryPoolOptions options = HugePageMemoryPoolOptions::Defaults());
+  ~HugePageMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  void ReleaseUnused() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes currently allocated by mapping memory directly
+  int64_t bytes_mapped() const;
+
+ private:
+  class HugePageMemoryPoolImpl;
+  std::unique_ptr<HugePageMemoryPoolImpl> impl_;
+};
+
 /// \brief Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
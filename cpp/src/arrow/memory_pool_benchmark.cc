@@ -47,6 +47,23 @@ struct Mimalloc {
 };
 #endif
 
+// Two levels of accounting (e.g. query and operator) over the system allocator
+struct ChildSystemAlloc {
+  static Result<MemoryPool*> GetAllocator() {
+    static ChildMemoryPool query(system_memory_pool(), "query",
+                                 /*limit=*/int64_t(1) << 40);
+    static ChildMemoryPool op(&query, "operator");
+    return &op;
+  }
+};
+
+struct RecyclingSystemAlloc {
+  static Result<MemoryPool*> GetAllocator() {
+    static RecyclingMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+};
+
 static void TouchCacheLines(uint8_t* data, int64_t nbytes) {
   uint8_t total = 0;
   while (nbytes > 0) {
@@ -116,6 +133,12 @@ BENCHMARK(TouchArea) BENCHMARK_ALLOCATE_ARGS;
 BENCHMARK_ALLOCATE(AllocateDeallocate, SystemAlloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, SystemAlloc);
 
+BENCHMARK_ALLOCATE(AllocateDeallocate, ChildSystemAlloc);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, ChildSystemAlloc);
+
+BENCHMARK_ALLOCATE(AllocateDeallocate, RecyclingSystemAlloc);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, RecyclingSystemAlloc);
+
 #ifdef ARROW_JEMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Jemalloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, Jemalloc);
@@ -16,7 +16,12 @@
 // under the License.
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -162,6 +167,244 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(ChildMemoryPool, Accounting) {
+  auto pool = MemoryPool::CreateDefault();
+
+  ChildMemoryPool query(pool.get(), "query");
+  ChildMemoryPool scan(&query, "scan");
+  ChildMemoryPool decode(&scan, "decode");
+  ASSERT_EQ(&scan, decode.parent());
+  ASSERT_EQ("decode", decode.name());
+  ASSERT_EQ(-1, decode.limit());
+  ASSERT_EQ(pool->backend_name(), decode.backend_name());
+
+  uint8_t* data;
+  ASSERT_OK(scan.Allocate(100, &data));
+  uint8_t* data2;
+  ASSERT_OK(decode.Allocate(300, &data2));
+
+  ASSERT_EQ(300, decode.bytes_allocated());
+  ASSERT_EQ(400, scan.bytes_allocated());
+  ASSERT_EQ(400, query.bytes_allocated());
+  ASSERT_EQ(400, pool->bytes_allocated());
+
+  ASSERT_OK(decode.Reallocate(300, 200, &data2));
+  ASSERT_EQ(200, decode.bytes_allocated());
+  ASSERT_EQ(300, scan.bytes_allocated());
+  ASSERT_EQ(2, decode.num_allocations());
+
+  scan.Free(data, 100);
+  decode.Free(data2, 200);
+
+  ASSERT_EQ(0, decode.bytes_allocated());
+  ASSERT_EQ(0, query.bytes_allocated());
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_EQ(300, decode.max_memory());
+  ASSERT_EQ(400, query.max_memory());
+}
+
+TEST(ChildMemoryPool, Limit) {
+  auto pool = MemoryPool::CreateDefault();
+
+  ChildMemoryPool query(pool.get(), "query", /*limit=*/1000);
+  ChildMemoryPool op(&query, "op", /*limit=*/600);
+  ChildMemoryPool other(&query, "other");
+
+  uint8_t* data;
+  ASSERT_OK(op.Allocate(500, &data));
+  uint8_t* data2;
+  // Exceeds the limit of `op`
+  ASSERT_RAISES(OutOfMemory, op.Allocate(200, &data2));
+  ASSERT_RAISES(OutOfMemory, op.Reallocate(500, 700, &data));
+  ASSERT_EQ(500, op.bytes_allocated());
+
+  // Exceeds the limit of the parent
+  ASSERT_RAISES(OutOfMemory, other.Allocate(600, &data2));
+  ASSERT_EQ(0, other.bytes_allocated());
+  ASSERT_EQ(500, query.bytes_allocated());
+  ASSERT_OK(other.Allocate(500, &data2));
+  ASSERT_EQ(1000, query.bytes_allocated());
+
+  // Shrinking is always allowed and frees quota for siblings
+  ASSERT_OK(op.Reallocate(500, 100, &data));
+  ASSERT_OK(other.Reallocate(500, 900, &data2));
+
+  op.Free(data, 100);
+  other.Free(data2, 900);
+  ASSERT_EQ(0, query.bytes_allocated());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, Recycling) {
+  auto pool = MemoryPool::CreateDefault();
+  {
+    RecyclingMemoryPool rp(pool.get());
+
+    uint8_t* data;
+    ASSERT_OK(rp.Allocate(100, &data));
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+    ASSERT_EQ(100, rp.bytes_allocated());
+    // Rounded up to the size class
+    ASSERT_EQ(128, pool->bytes_allocated());
+    rp.Free(data, 100);
+    ASSERT_EQ(0, rp.bytes_allocated());
+    ASSERT_EQ(128, pool->bytes_allocated());
+
+    // Same size class: the buffer is reused
+    uint8_t* data2;
+    ASSERT_OK(rp.Allocate(120, &data2));
+    ASSERT_EQ(data, data2);
+    ASSERT_EQ(128, pool->bytes_allocated());
+
+    // Growing within the size class is free
+    ASSERT_OK(rp.Reallocate(120, 128, &data2));
+    ASSERT_EQ(data, data2);
+    std::memset(data2, 42, 128);
+    // Growing to another size class copies
+    ASSERT_OK(rp.Reallocate(128, 1000, &data2));
+    ASSERT_NE(data, data2);
+    ASSERT_EQ(42, data2[127]);
+    ASSERT_EQ(1000, rp.bytes_allocated());
+    ASSERT_EQ(128 + 1024, pool->bytes_allocated());
+
+    // Large allocations are not recycled
+    uint8_t* large;
+    const int64_t large_size = RecyclingMemoryPool::kDefaultMaxCachedSize + 1;
+    ASSERT_OK(rp.Allocate(large_size, &large));
+    rp.Free(large, large_size);
+    ASSERT_EQ(128 + 1024, pool->bytes_allocated());
+
+    rp.Free(data2, 1000);
+    ASSERT_EQ(0, rp.bytes_allocated());
+    ASSERT_EQ(1000 + large_size, rp.max_memory());
+
+    rp.ReleaseUnused();
+    ASSERT_EQ(0, pool->bytes_allocated());
+  }
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, CachedBuffersReturned) {
+  auto pool = MemoryPool::CreateDefault();
+  {
+    RecyclingMemoryPool rp(pool.get());
+
+    // Buffers cached by a thread are returned when it exits
+    std::thread thread([&] {
+      uint8_t* data;
+      ASSERT_OK(rp.Allocate(4096, &data));
+      rp.Free(data, 4096);
+      ASSERT_EQ(4096, pool->bytes_allocated());
+    });
+    thread.join();
+    ASSERT_EQ(0, pool->bytes_allocated());
+
+    uint8_t* data;
+    ASSERT_OK(rp.Allocate(64, &data));
+    rp.Free(data, 64);
+    ASSERT_EQ(64, pool->bytes_allocated());
+  }
+  // ... and when the pool is destroyed
+  ASSERT_EQ(0, pool->bytes_allocated());
+
+  // A new pool doesn't see the buffers of a destroyed one
+  RecyclingMemoryPool rp(pool.get());
+  uint8_t* data;
+  ASSERT_OK(rp.Allocate(64, &data));
+  ASSERT_EQ(64, pool->bytes_allocated());
+  rp.Free(data, 64);
+}
+
+TEST(RecyclingMemoryPool, DestroyedWhileOtherPoolsInUse) {
+  auto pool = MemoryPool::CreateDefault();
+  {
+    RecyclingMemoryPool first(pool.get());
+    RecyclingMemoryPool second(pool.get());
+    for (int i = 0; i < 100; ++i) {
+      std::unique_ptr<RecyclingMemoryPool> rp(new RecyclingMemoryPool(pool.get()));
+      std::atomic<bool> cached{false}, done{false};
+      std::thread thread([&] {
+        std::vector<uint8_t*> buffers(64);
+        for (auto& buffer : buffers) {
+          ASSERT_OK(rp->Allocate(64, &buffer));
+        }
+        for (auto buffer : buffers) {
+          rp->Free(buffer, 64);
+        }
+        cached.store(true);
+        // Alternating between pools makes the thread look up its caches, and
+        // discard the one of the destroyed pool, while it is being drained
+        while (!done.load()) {
+          for (auto other : {&first, &second}) {
+            uint8_t* data;
+            ASSERT_OK(other->Allocate(64, &data));
+            other->Free(data, 64);
+          }
+        }
+      });
+      while (!cached.load()) {
+        std::this_thread::yield();
+      }
+      rp.reset();
+      done.store(true);
+      thread.join();
+    }
+  }
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(HugePageMemoryPool, Allocate) {
+  auto pool = MemoryPool::CreateDefault();
+  auto options = HugePageMemoryPoolOptions::Defaults();
+  options.bind_to_local_numa_node = true;
+  HugePageMemoryPool hp(pool.get(), options);
+
+  // Small allocations are delegated
+  uint8_t* small;
+  ASSERT_OK(hp.Allocate(1000, &small));
+  ASSERT_EQ(1000, pool->bytes_allocated());
+
+  const int64_t large_size = 3 * 1024 * 1024;
+  uint8_t* large;
+  ASSERT_OK(hp.Allocate(large_size, &large));
+  ASSERT_EQ(1000 + large_size, hp.bytes_allocated());
+  std::memset(large, 42, large_size);
+#ifdef __linux__
+  ASSERT_EQ(1000, pool->bytes_allocated());
+  ASSERT_EQ(4 * 1024 * 1024, hp.bytes_mapped());
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(large) % (2 * 1024 * 1024));
+#endif
+
+  // Growing a small allocation into a large one and back
+  std::memset(small, 7, 1000);
+  ASSERT_OK(hp.Reallocate(1000, large_size, &small));
+  ASSERT_EQ(7, small[999]);
+  ASSERT_OK(hp.Reallocate(large_size, 500, &small));
+  ASSERT_EQ(7, small[499]);
+  ASSERT_OK(hp.Reallocate(large_size, 5 * 1024 * 1024, &large));
+  ASSERT_EQ(42, large[large_size - 1]);
+
+  hp.Free(small, 500);
+  hp.Free(large, 5 * 1024 * 1024);
+  ASSERT_EQ(0, hp.bytes_allocated());
+  ASSERT_EQ(0, hp.bytes_mapped());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(HugePageMemoryPool, ExplicitHugePages) {
+  auto pool = MemoryPool::CreateDefault();
+  auto options = HugePageMemoryPoolOptions::Defaults();
+  // Falls back to regular pages if no huge pages are reserved
+  options.explicit_huge_pages = true;
+  HugePageMemoryPool hp(pool.get(), options);
+
+  uint8_t* data;
+  ASSERT_OK(hp.Allocate(2 * 1024 * 1024, &data));
+  std::memset(data, 1, 2 * 1024 * 1024);
+  hp.Free(data, 2 * 1024 * 1024);
+  ASSERT_EQ(0, hp.bytes_allocated());
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
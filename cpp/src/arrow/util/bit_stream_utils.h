@@ -25,6 +25,7 @@
 #include <cstdint>
 
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bpacking.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -148,6 +149,10 @@ class BitReader {
   template <typename T>
   int GetBatch(int num_bits, T* v, int batch_size);
 
+  /// Copy the next 'num_values' values of bit width 1 to 'bitmap', starting at bit
+  /// 'bitmap_offset'. Return the number of values actually copied.
+  int GetBitmap(int num_values, uint8_t* bitmap, int64_t bitmap_offset);
+
   /// Reads a 'num_bytes'-sized value from the buffer and stores it in 'v'. T
   /// needs to be a little-endian native type and big enough to store
   /// 'num_bytes'. The value is assumed to be byte-aligned so the stream will
@@ -394,6 +399,32 @@ inline int BitReader::GetBatch(int num_bits, T* v, int batch_size) {
   return batch_size;
 }
 
+inline int BitReader::GetBitmap(int num_values, uint8_t* bitmap,
+                                int64_t bitmap_offset) {
+  DCHECK(buffer_ != NULL);
+
+  const int64_t bit_position = static_cast<int64_t>(byte_offset_) * 8 + bit_offset_;
+  const int64_t remaining_bits = static_cast<int64_t>(max_bytes_) * 8 - bit_position;
+  if (remaining_bits < num_values) {
+    num_values = static_cast<int>(remaining_bits);
+  }
+  arrow::internal::CopyBitmap(buffer_, bit_position, num_values, bitmap, bitmap_offset);
+
+  const int64_t end_position = bit_position + num_values;
+  byte_offset_ = static_cast<int>(end_position / 8);
+  bit_offset_ = static_cast<int>(end_position % 8);
+
+  // Reset buffered_values_
+  int bytes_remaining = max_bytes_ - byte_offset_;
+  if (ARROW_PREDICT_TRUE(bytes_remaining >= 8)) {
+    memcpy(&buffered_values_, buffer_ + byte_offset_, 8);
+  } else {
+    memcpy(&buffered_values_, buffer_ + byte_offset_, bytes_remaining);
+  }
+  buffered_values_ = arrow::BitUtil::FromLittleEndian(buffered_values_);
+  return num_values;
+}
+
 template <typename T>
 inline bool BitReader::GetAligned(int num_bytes, T* v) {
   if (ARROW_PREDICT_FALSE(num_bytes > static_cast<int>(sizeof(T)))) {
@@ -42,6 +42,7 @@
 #include "arrow/util/endian.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 
 #define XXH_INLINE_ALL
@@ -250,6 +251,11 @@ class HashTable {
     return Status::OK();
   }
 
+  // Prefetch the first slot probed by a lookup of `h`
+  void Prefetch(hash_t h) const {
+    ARROW_PREFETCH(entries_ + (FixHash(h) & capacity_mask_));
+  }
+
   uint64_t size() const { return size_; }
 
   // Visit all non-empty entries in the table
@@ -363,6 +369,248 @@ class HashTable {
   TypedBufferBuilder<Entry> entries_builder_;
 };
 
+// ----------------------------------------------------------------------
+// A group-probed open-addressing insert-only hash table (no deletes)
+//
+// Slots are organized in groups of kGroupSize.  Alongside the entries, each
+// slot has a one-byte tag which is either kEmptyTag or the low 7 bits of the
+// entry's hash value, so that a whole group can be searched for candidate
+// entries with a couple of SIMD instructions before any entry is touched
+// (this is the "Swiss table" layout).  Since fewer entries are compared, the
+// table can be kept fuller than HashTable, which reduces its memory footprint.
+//
+// SwissHashTable has the same interface as HashTable and can be used as the
+// HashTableTemplateType of the memo tables below.
+
+template <typename Payload>
+class SwissHashTable {
+ public:
+  static constexpr hash_t kSentinel = 0ULL;
+  static constexpr uint64_t kGroupSize = 16;
+
+  struct Entry {
+    hash_t h;
+    Payload payload;
+
+    // An entry is valid if the hash is different from the sentinel value
+    operator bool() const { return h != kSentinel; }
+  };
+
+  SwissHashTable(MemoryPool* pool, uint64_t capacity)
+      : entries_builder_(pool), tags_builder_(pool) {
+    DCHECK_NE(pool, nullptr);
+    // Minimum of 32 elements
+    capacity = std::max<uint64_t>(capacity, 32UL);
+    capacity_ = BitUtil::NextPower2(capacity);
+    size_ = 0;
+
+    DCHECK_OK(UpsizeBuffers(capacity_));
+  }
+
+  // Lookup probing one group of slots at a time
+  // cmp_func should have signature bool(const Payload*).
+  // Return a (Entry*, found) pair.
+  template <typename CmpFunc>
+  std::pair<Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) {
+    auto p = Lookup<DoCompare, CmpFunc>(h, entries_, tags_, capacity_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  template <typename CmpFunc>
+  std::pair<const Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) const {
+    auto p = Lookup<DoCompare, CmpFunc>(h, entries_, tags_, capacity_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  Status Insert(Entry* entry, hash_t h, const Payload& payload) {
+    // Ensure entry is empty before inserting
+    assert(!*entry);
+    h = FixHash(h);
+    tags_[entry - entries_] = HashTag(h);
+    entry->h = h;
+    entry->payload = payload;
+    ++size_;
+
+    if (ARROW_PREDICT_FALSE(NeedUpsizing())) {
+      return Upsize(capacity_ * 2);
+    }
+    return Status::OK();
+  }
+
+  // Prefetch the tags of the first group probed by a lookup of `h`
+  void Prefetch(hash_t h) const {
+    ARROW_PREFETCH(tags_ + FirstGroup(FixHash(h), capacity_) * kGroupSize);
+  }
+
+  uint64_t size() const { return size_; }
+
+  // Visit all non-empty entries in the table
+  // The visit_func should have signature void(const Entry*)
+  template <typename VisitFunc>
+  void VisitEntries(VisitFunc&& visit_func) const {
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (tags_[i] != kEmptyTag) {
+        visit_func(&entries_[i]);
+      }
+    }
+  }
+
+ protected:
+  static constexpr uint8_t kEmptyTag = 0x80;
+  static constexpr int kTagBits = 7;
+
+  // NoCompare is for when the value is known not to exist in the table
+  enum CompareKind { DoCompare, NoCompare };
+
+  // The workhorse lookup function
+  template <CompareKind CKind, typename CmpFunc>
+  std::pair<uint64_t, bool> Lookup(hash_t h, const Entry* entries, const uint8_t* tags,
+                                   uint64_t capacity, CmpFunc&& cmp_func) const {
+    h = FixHash(h);
+    const uint8_t tag = HashTag(h);
+    const uint64_t group_mask = capacity / kGroupSize - 1;
+    uint64_t group = FirstGroup(h, capacity);
+    uint64_t stride = 0;
+
+    while (true) {
+      const uint64_t offset = group * kGroupSize;
+      if (CKind == DoCompare) {
+        uint32_t matches = MatchTag(tags + offset, tag);
+        while (matches != 0) {
+          const uint64_t index = offset + BitUtil::CountTrailingZeros(matches);
+          const Entry* entry = &entries[index];
+          if (entry->h == h && cmp_func(&entry->payload)) {
+            // Found
+            return {index, true};
+          }
+          matches &= matches - 1;
+        }
+      }
+      const uint32_t empty = MatchEmpty(tags + offset);
+      if (empty != 0) {
+        // Since there are no deletes, the value would be in this group or an
+        // earlier one; return the first empty slot for insertion
+        return {offset + BitUtil::CountTrailingZeros(empty), false};
+      }
+      // Triangular probing visits all groups since their number is a power of two
+      group = (group + ++stride) & group_mask;
+    }
+  }
+
+  // Return a bitmask of the slots in the group whose tag equals `tag`.
+  // The portable version may return false positives, which are weeded out
+  // by the full hash comparison.
+  static uint32_t MatchTag(const uint8_t* group, uint8_t tag) {
+#if defined(ARROW_HAVE_SSE4_2)
+    const __m128i tags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(tags, _mm_set1_epi8(static_cast<char>(tag)))));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < 2; ++i) {
+      const uint64_t x = LoadTags(group + 8 * i) ^ (kLsbs * tag);
+      // Set the high bit of each zero byte
+      mask |= CompactHighBits((x - kLsbs) & ~x & kMsbs) << (8 * i);
+    }
+    return mask;
+#endif
+  }
+
+  // Return a bitmask of the empty slots in the group
+  static uint32_t MatchEmpty(const uint8_t* group) {
+#if defined(ARROW_HAVE_SSE4_2)
+    // Only the empty tag has its high bit set
+    const __m128i tags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<uint32_t>(_mm_movemask_epi8(tags));
+#else
+    return CompactHighBits(LoadTags(group) & kMsbs) |
+           (CompactHighBits(LoadTags(group + 8) & kMsbs) << 8);
+#endif
+  }
+
+#if !defined(ARROW_HAVE_SSE4_2)
+  static constexpr uint64_t kLsbs = 0x0101010101010101ULL;
+  static constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+
+  static uint64_t LoadTags(const uint8_t* p) {
+    return BitUtil::FromLittleEndian(util::SafeLoadAs<uint64_t>(p));
+  }
+
+  // Gather the high bit of each of the 8 bytes into the low 8 bits
+  static uint32_t CompactHighBits(uint64_t x) {
+    return static_cast<uint32_t>(((x >> 7) * 0x0102040810204080ULL) >> 56);
+  }
+#endif
+
+  static uint8_t HashTag(hash_t h) {
+    return static_cast<uint8_t>(h & ((1U << kTagBits) - 1));
+  }
+
+  static uint64_t FirstGroup(hash_t h, uint64_t capacity) {
+    // The tag bits are not reused for the group index
+    return (h >> kTagBits) & (capacity / kGroupSize - 1);
+  }
+
+  bool NeedUpsizing() const {
+    // Keep the load factor <= 7/8
+    return size_ * 8 >= capacity_ * 7;
+  }
+
+  Status UpsizeBuffers(uint64_t capacity) {
+    RETURN_NOT_OK(entries_builder_.Resize(capacity));
+    entries_ = entries_builder_.mutable_data();
+    memset(static_cast<void*>(entries_), 0, capacity * sizeof(Entry));
+    RETURN_NOT_OK(tags_builder_.Resize(capacity));
+    tags_ = tags_builder_.mutable_data();
+    memset(tags_, kEmptyTag, capacity);
+
+    return Status::OK();
+  }
+
+  Status Upsize(uint64_t new_capacity) {
+    assert(new_capacity > capacity_);
+    assert((new_capacity & (new_capacity - 1)) == 0);  // it's a power of two
+
+    // Stash old entries and seal builders, effectively resetting the Buffers
+    const Entry* old_entries = entries_;
+    const uint8_t* old_tags = tags_;
+    ARROW_ASSIGN_OR_RAISE(auto previous_entries,
+                          entries_builder_.FinishWithLength(capacity_));
+    ARROW_ASSIGN_OR_RAISE(auto previous_tags, tags_builder_.FinishWithLength(capacity_));
+    // Allocate new buffers
+    RETURN_NOT_OK(UpsizeBuffers(new_capacity));
+
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (old_tags[i] != kEmptyTag) {
+        const auto& entry = old_entries[i];
+        // Dummy compare function will not be called
+        auto p = Lookup<NoCompare>(entry.h, entries_, tags_, new_capacity,
+                                   [](const Payload*) { return false; });
+        assert(!p.second);
+        entries_[p.first] = entry;
+        tags_[p.first] = old_tags[i];
+      }
+    }
+    capacity_ = new_capacity;
+
+    return Status::OK();
+  }
+
+  hash_t FixHash(hash_t h) const { return (h == kSentinel) ? 42U : h; }
+
+  // The number of slots available in the hash table array.
+  uint64_t capacity_;
+  // The number of used slots in the hash table array.
+  uint64_t size_;
+
+  Entry* entries_;
+  uint8_t* tags_;
+  TypedBufferBuilder<Entry> entries_builder_;
+  TypedBufferBuilder<uint8_t> tags_builder_;
+};
+
 // XXX typedef memo_index_t int32_t ?
 
 constexpr int32_t kKeyNotFound = -1;
@@ -405,22 +653,8 @@ class ScalarMemoTable : public MemoTable {
   template <typename Func1, typename Func2>
   Status GetOrInsert(const Scalar& value, Func1&& on_found, Func2&& on_not_found,
                      int32_t* out_memo_index) {
-    auto cmp_func = [value](const Payload* payload) -> bool {
-      return ScalarHelper<Scalar, 0>::CompareScalars(value, payload->value);
-    };
-    hash_t h = ComputeHash(value);
-    auto p = hash_table_.Lookup(h, cmp_func);
-    int32_t memo_index;
-    if (p.second) {
-      memo_index = p.first->payload.memo_index;
-      on_found(memo_index);
-    } else {
-      memo_index = size();
-      RETURN_NOT_OK(hash_table_.Insert(p.first, h, {value, memo_index}));
-      on_not_found(memo_index);
-    }
-    *out_memo_index = memo_index;
-    return Status::OK();
+    return GetOrInsertHashed(value, ComputeHash(value), std::forward<Func1>(on_found),
+                             std::forward<Func2>(on_not_found), out_memo_index);
   }
 
   Status GetOrInsert(const Scalar& value, int32_t* out_memo_index) {
@@ -428,6 +662,34 @@ class ScalarMemoTable : public MemoTable {
         value, [](int32_t i) {}, [](int32_t i) {}, out_memo_index);
   }
 
+  // Same as GetOrInsert, for `length` contiguous values at once.
+  // Hashes are computed a block at a time and the hash table slots are
+  // prefetched before probing, which hides memory latency on large tables.
+  template <typename Func1, typename Func2>
+  Status GetOrInsertBatch(const Scalar* values, int64_t length, Func1&& on_found,
+                          Func2&& on_not_found, int32_t* out_memo_indices) {
+    constexpr int64_t kBlockSize = 64;
+    hash_t hashes[kBlockSize];
+    for (int64_t offset = 0; offset < length; offset += kBlockSize) {
+      const int64_t block_length = std::min(kBlockSize, length - offset);
+      for (int64_t i = 0; i < block_length; ++i) {
+        hashes[i] = ComputeHash(values[offset + i]);
+        hash_table_.Prefetch(hashes[i]);
+      }
+      for (int64_t i = 0; i < block_length; ++i) {
+        RETURN_NOT_OK(GetOrInsertHashed(values[offset + i], hashes[i], on_found,
+                                        on_not_found, &out_memo_indices[offset + i]));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status GetOrInsertBatch(const Scalar* values, int64_t length,
+                          int32_t* out_memo_indices) {
+    return GetOrInsertBatch(
+        values, length, [](int32_t i) {}, [](int32_t i) {}, out_memo_indices);
+  }
+
   int32_t GetNull() const { return null_index_; }
 
   template <typename Func1, typename Func2>
@@ -485,6 +747,26 @@ class ScalarMemoTable : public MemoTable {
   hash_t ComputeHash(const Scalar& value) const {
     return ScalarHelper<Scalar, 0>::ComputeHash(value);
   }
+
+  template <typename Func1, typename Func2>
+  Status GetOrInsertHashed(const Scalar& value, hash_t h, Func1&& on_found,
+                           Func2&& on_not_found, int32_t* out_memo_index) {
+    auto cmp_func = [value](const Payload* payload) -> bool {
+      return ScalarHelper<Scalar, 0>::CompareScalars(value, payload->value);
+    };
+    auto p = hash_table_.Lookup(h, cmp_func);
+    int32_t memo_index;
+    if (p.second) {
+      memo_index = p.first->payload.memo_index;
+      on_found(memo_index);
+    } else {
+      memo_index = size();
+      RETURN_NOT_OK(hash_table_.Insert(p.first, h, {value, memo_index}));
+      on_not_found(memo_index);
+    }
+    *out_memo_index = memo_index;
+    return Status::OK();
+  }
 };
 
 // ----------------------------------------------------------------------
@@ -596,7 +878,8 @@ class SmallScalarMemoTable : public MemoTable {
 // ----------------------------------------------------------------------
 // A memoization table for variable-sized binary data.
 
-template <typename BinaryBuilderT>
+template <typename BinaryBuilderT,
+          template <class> class HashTableTemplateType = HashTable>
 class BinaryMemoTable : public MemoTable {
  public:
   using builder_offset_type = typename BinaryBuilderT::offset_type;
@@ -808,8 +1091,8 @@ class BinaryMemoTable : public MemoTable {
     int32_t memo_index;
   };
 
-  using HashTableType = HashTable<Payload>;
-  using HashTableEntry = typename HashTable<Payload>::Entry;
+  using HashTableType = HashTableTemplateType<Payload>;
+  using HashTableEntry = typename HashTableType::Entry;
   HashTableType hash_table_;
   BinaryBuilderT binary_builder_;
 
@@ -24,6 +24,7 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/hashing.h"
 
@@ -111,6 +112,86 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+template <class Integer>
+static std::vector<Integer> MakeIntegers(int32_t n_values, int64_t cardinality) {
+  std::vector<Integer> values(n_values);
+
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> draws_dist(0, cardinality - 1);
+  // Spread the draws over the whole value range
+  std::generate(values.begin(), values.end(), [&]() {
+    return static_cast<Integer>(draws_dist(gen) * 6364136223846793005ULL);
+  });
+  return values;
+}
+
+// Memoize 1M int64 values with state.range(0) distinct values
+template <template <class> class HashTableTemplateType>
+static void MemoTableInt64(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(1 << 20, state.range(0));
+
+  while (state.KeepRunning()) {
+    ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool());
+    int32_t memo_index;
+    for (const int64_t v : values) {
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int64_t));
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableInt64Batch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(1 << 20, state.range(0));
+  std::vector<int32_t> memo_indices(values.size());
+
+  while (state.KeepRunning()) {
+    ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool());
+    ABORT_NOT_OK(table.GetOrInsertBatch(
+        values.data(), static_cast<int64_t>(values.size()), memo_indices.data()));
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int64_t));
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+// Memoize 1M small strings with state.range(0) distinct values
+template <template <class> class HashTableTemplateType>
+static void MemoTableSmallStrings(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<std::string> uniques =
+      MakeStrings(static_cast<int32_t>(state.range(0)), 2, 20);
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> draws_dist(0, uniques.size() - 1);
+  std::vector<util::string_view> values(1 << 20);
+  std::generate(values.begin(), values.end(),
+                [&]() { return util::string_view(uniques[draws_dist(gen)]); });
+  int64_t total_size = 0;
+  for (const auto& v : values) {
+    total_size += static_cast<int64_t>(v.size());
+  }
+
+  while (state.KeepRunning()) {
+    BinaryMemoTable<BinaryBuilder, HashTableTemplateType> table(default_memory_pool());
+    int32_t memo_index;
+    for (const auto& v : values) {
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetBytesProcessed(state.iterations() * total_size);
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void MemoTableArgs(benchmark::internal::Benchmark* bench) {
+  for (const int64_t cardinality : {100, 100000, 1 << 20}) {
+    bench->Arg(cardinality);
+  }
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -119,5 +200,12 @@ BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
 
+BENCHMARK_TEMPLATE(MemoTableInt64, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableInt64, SwissHashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableInt64Batch, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableInt64Batch, SwissHashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableSmallStrings, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableSmallStrings, SwissHashTable)->Apply(MemoTableArgs);
+
 }  // namespace internal
 }  // namespace arrow
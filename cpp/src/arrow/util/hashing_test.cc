@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <limits>
@@ -374,6 +375,80 @@ TEST(ScalarMemoTable, StressInt64) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+template <template <class> class HashTableTemplateType>
+void CheckScalarMemoTableBatch(int64_t n_values, int64_t cardinality) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> value_dist(-cardinality, cardinality);
+  std::vector<int64_t> values(n_values);
+  std::generate(values.begin(), values.end(), [&]() { return value_dist(gen); });
+
+  ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool(), 0);
+  std::unordered_map<int64_t, int32_t> map;
+  std::vector<int32_t> memo_indices(n_values);
+  int32_t n_found = 0, n_not_found = 0;
+  ASSERT_OK(table.GetOrInsertBatch(
+      values.data(), n_values, [&](int32_t) { ++n_found; },
+      [&](int32_t) { ++n_not_found; }, memo_indices.data()));
+
+  for (int64_t i = 0; i < n_values; ++i) {
+    int32_t expected;
+    auto it = map.find(values[i]);
+    if (it == map.end()) {
+      expected = static_cast<int32_t>(map.size());
+      map[values[i]] = expected;
+    } else {
+      expected = it->second;
+    }
+    ASSERT_EQ(memo_indices[i], expected);
+    ASSERT_EQ(table.Get(values[i]), expected);
+  }
+  ASSERT_EQ(table.size(), map.size());
+  ASSERT_EQ(n_not_found, table.size());
+  ASSERT_EQ(n_found + n_not_found, n_values);
+  ASSERT_EQ(table.Get(cardinality + 1), kKeyNotFound);
+
+  std::vector<int64_t> copied(table.size());
+  table.CopyValues(copied.data());
+  for (const auto& pair : map) {
+    ASSERT_EQ(copied[pair.second], pair.first);
+  }
+}
+
+TEST(ScalarMemoTable, GetOrInsertBatch) {
+#ifdef ARROW_VALGRIND
+  const int64_t n_values = 1000;
+#else
+  const int64_t n_values = 100000;
+#endif
+  for (int64_t cardinality : {10, 1000, 1000000}) {
+    ARROW_SCOPED_TRACE("cardinality = ", cardinality);
+    CheckScalarMemoTableBatch<HashTable>(n_values, cardinality);
+  }
+}
+
+TEST(ScalarMemoTable, SwissHashTable) {
+#ifdef ARROW_VALGRIND
+  const int64_t n_values = 1000;
+#else
+  const int64_t n_values = 100000;
+#endif
+  for (int64_t cardinality : {10, 1000, 1000000}) {
+    ARROW_SCOPED_TRACE("cardinality = ", cardinality);
+    CheckScalarMemoTableBatch<SwissHashTable>(n_values, cardinality);
+  }
+
+  // Null handling and special values are independent from the hash table
+  ScalarMemoTable<double, SwissHashTable> table(default_memory_pool(), 0);
+  const double nan_value = std::nan("");
+  AssertGetOrInsert(table, 1.5, 0);
+  AssertGetOrInsertNull(table, 1);
+  AssertGetOrInsert(table, nan_value, 2);
+  AssertGetOrInsert(table, -0.0, 3);
+  AssertGetOrInsert(table, nan_value, 2);
+  AssertGetNull(table, 1);
+  ASSERT_EQ(table.size(), 4);
+}
+
 TEST(BinaryMemoTable, Basics) {
   std::string A = "", B = "a", C = "foo", D = "bar", E, F;
   E += '\0';
@@ -478,6 +553,33 @@ TEST(BinaryMemoTable, Stress) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(BinaryMemoTable, SwissHashTable) {
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 200;
+#else
+  const int32_t n_values = 10000;
+#endif
+
+  const auto distinct = MakeDistinctStrings(n_values);
+  std::vector<std::string> values(distinct.begin(), distinct.end());
+
+  BinaryMemoTable<BinaryBuilder, SwissHashTable> table(default_memory_pool(), 0);
+  for (int32_t repeat = 0; repeat < 2; ++repeat) {
+    for (int32_t i = 0; i < n_values; ++i) {
+      AssertGetOrInsert(table, values[i], i);
+    }
+  }
+  AssertGetOrInsertNull(table, n_values);
+  ASSERT_EQ(table.size(), n_values + 1);
+
+  std::vector<std::string> actual;
+  table.VisitValues(0, [&](const util::string_view& v) {
+    actual.emplace_back(v.data(), v.length());
+  });
+  values.emplace_back("");
+  ASSERT_EQ(actual, values);
+}
+
 TEST(BinaryMemoTable, Empty) {
   BinaryMemoTable<BinaryBuilder> table(default_memory_pool());
   ASSERT_EQ(table.size(), 0);
@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/hyperloglog.h"
+
+#include <cmath>
+
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Serialized layout: format version, precision, then one byte per register
+constexpr uint8_t kSerializationVersion = 1;
+constexpr int64_t kSerializationHeaderSize = 2;
+
+double Alpha(int64_t num_registers) {
+  switch (num_registers) {
+    case 16:
+      return 0.673;
+    case 32:
+      return 0.697;
+    case 64:
+      return 0.709;
+    default:
+      return 0.7213 / (1.0 + 1.079 / static_cast<double>(num_registers));
+  }
+}
+
+}  // namespace
+
+constexpr uint32_t HyperLogLog::kMinPrecision;
+constexpr uint32_t HyperLogLog::kMaxPrecision;
+constexpr uint32_t HyperLogLog::kDefaultPrecision;
+
+HyperLogLog::HyperLogLog(uint32_t precision)
+    : precision_(precision), registers_(NumRegisters(precision), 0) {
+  DCHECK_OK(ValidatePrecision(precision));
+}
+
+Status HyperLogLog::ValidatePrecision(uint32_t precision) {
+  if (precision < kMinPrecision || precision > kMaxPrecision) {
+    return Status::Invalid("HyperLogLog precision must be between ", kMinPrecision,
+                           " and ", kMaxPrecision, ", got ", precision);
+  }
+  return Status::OK();
+}
+
+void HyperLogLog::Merge(uint8_t* registers, const uint8_t* other_registers,
+                        uint32_t precision) {
+  const int64_t num_registers = NumRegisters(precision);
+  for (int64_t i = 0; i < num_registers; ++i) {
+    registers[i] = std::max(registers[i], other_registers[i]);
+  }
+}
+
+int64_t HyperLogLog::Estimate(const uint8_t* registers, uint32_t precision) {
+  const int64_t num_registers = NumRegisters(precision);
+  const double m = static_cast<double>(num_registers);
+
+  double sum = 0;
+  int64_t num_zeros = 0;
+  for (int64_t i = 0; i < num_registers; ++i) {
+    sum += std::ldexp(1.0, -registers[i]);
+    num_zeros += registers[i] == 0;
+  }
+  double estimate = Alpha(num_registers) * m * m / sum;
+
+  // Small range correction: fall back to linear counting while some registers
+  // are still empty.  No large range correction is needed with 64-bit hashes.
+  if (estimate <= 2.5 * m && num_zeros > 0) {
+    estimate = m * std::log(m / static_cast<double>(num_zeros));
+  }
+  return static_cast<int64_t>(std::llround(estimate));
+}
+
+Status HyperLogLog::Merge(const HyperLogLog& other) {
+  if (precision_ != other.precision_) {
+    return Status::Invalid("Cannot merge HyperLogLog sketches of precision ", precision_,
+                           " and ", other.precision_);
+  }
+  Merge(registers_.data(), other.registers_.data(), precision_);
+  return Status::OK();
+}
+
+std::string HyperLogLog::Serialize() const {
+  std::string out;
+  out.reserve(kSerializationHeaderSize + registers_.size());
+  out.push_back(static_cast<char>(kSerializationVersion));
+  out.push_back(static_cast<char>(precision_));
+  out.append(reinterpret_cast<const char*>(registers_.data()), registers_.size());
+  return out;
+}
+
+Result<HyperLogLog> HyperLogLog::Deserialize(util::string_view serialized) {
+  if (static_cast<int64_t>(serialized.size()) < kSerializationHeaderSize) {
+    return Status::Invalid("Serialized HyperLogLog is truncated");
+  }
+  const auto version = static_cast<uint8_t>(serialized[0]);
+  if (version != kSerializationVersion) {
+    return Status::Invalid("Unsupported serialized HyperLogLog version ",
+                           static_cast<int>(version));
+  }
+  const auto precision = static_cast<uint32_t>(static_cast<uint8_t>(serialized[1]));
+  RETURN_NOT_OK(ValidatePrecision(precision));
+  if (static_cast<int64_t>(serialized.size()) !=
+      kSerializationHeaderSize + NumRegisters(precision)) {
+    return Status::Invalid("Serialized HyperLogLog of precision ", precision,
+                           " should have ", NumRegisters(precision),
+                           " registers, got ",
+                           static_cast<int64_t>(serialized.size()) -
+                               kSerializationHeaderSize);
+  }
+
+  HyperLogLog sketch(precision);
+  const auto max_rank = static_cast<uint8_t>(64 - precision + 1);
+  for (int64_t i = 0; i < NumRegisters(precision); ++i) {
+    const auto rank = static_cast<uint8_t>(serialized[kSerializationHeaderSize + i]);
+    if (rank > max_rank) {
+      return Status::Invalid("Invalid serialized HyperLogLog register value ",
+                             static_cast<int>(rank));
+    }
+    sketch.registers_[i] = rank;
+  }
+  return std::move(sketch);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// approximate distinct counting from arbitrary length dataset with O(1) space
+// based on 'HyperLogLog: the analysis of a near-optimal cardinality estimation
+// algorithm' from Flajolet, Fusy, Gandouet & Meunier
+// - http://algo.inria.fr/flajolet/Publications/FlFuGaMe07.pdf
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+// A HyperLogLog sketch with 2^precision one-byte registers, fed with 64-bit hashes.
+// The relative standard error of the estimate is about 1.04 / sqrt(2^precision).
+//
+// The static register-level functions allow callers to store many sketches
+// contiguously (e.g. one per group) without a HyperLogLog object each.
+class ARROW_EXPORT HyperLogLog {
+ public:
+  static constexpr uint32_t kMinPrecision = 4;
+  static constexpr uint32_t kMaxPrecision = 18;
+  static constexpr uint32_t kDefaultPrecision = 12;
+
+  explicit HyperLogLog(uint32_t precision = kDefaultPrecision);
+
+  static Status ValidatePrecision(uint32_t precision);
+
+  static int64_t NumRegisters(uint32_t precision) { return int64_t(1) << precision; }
+
+  // finalize an arbitrary hash so that all its bits are well mixed
+  // (the 64-bit finalizer from MurmurHash3)
+  static uint64_t MixHash(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+  // add a hashed value, the hash should be well mixed in all 64 bits (see MixHash)
+  // this function is intensively called and performance critical
+  static void Add(uint8_t* registers, uint32_t precision, uint64_t hash) {
+    const uint64_t index = hash >> (64 - precision);
+    // Shift in a guard bit so that the rank is at most 64 - precision + 1
+    const uint64_t rest = (hash << precision) | (uint64_t(1) << (precision - 1));
+    const uint8_t rank = static_cast<uint8_t>(BitUtil::CountLeadingZeros(rest) + 1);
+    registers[index] = std::max(registers[index], rank);
+  }
+
+  // merge the registers of another sketch with the same precision
+  static void Merge(uint8_t* registers, const uint8_t* other_registers,
+                    uint32_t precision);
+
+  // estimate the number of distinct hashes added
+  static int64_t Estimate(const uint8_t* registers, uint32_t precision);
+
+  void Add(uint64_t hash) { Add(registers_.data(), precision_, hash); }
+
+  Status Merge(const HyperLogLog& other);
+
+  int64_t Estimate() const { return Estimate(registers_.data(), precision_); }
+
+  // reset and re-use this sketch
+  void Reset() { std::fill(registers_.begin(), registers_.end(), 0); }
+
+  // serialize the sketch state, so it can be stored and merged elsewhere
+  std::string Serialize() const;
+
+  static Result<HyperLogLog> Deserialize(util::string_view serialized);
+
+  uint32_t precision() const { return precision_; }
+  const uint8_t* registers() const { return registers_.data(); }
+
+ private:
+  uint32_t precision_;
+  std::vector<uint8_t> registers_;
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/hyperloglog.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+void AddRange(HyperLogLog* sketch, uint64_t begin, uint64_t end) {
+  for (uint64_t i = begin; i < end; ++i) {
+    sketch->Add(HyperLogLog::MixHash(i));
+  }
+}
+
+void AssertEstimateNear(const HyperLogLog& sketch, int64_t expected) {
+  // Allow for 4 standard errors
+  const auto num_registers = HyperLogLog::NumRegisters(sketch.precision());
+  const double error = 4 * 1.04 / std::sqrt(static_cast<double>(num_registers));
+  ASSERT_NEAR(static_cast<double>(sketch.Estimate()), static_cast<double>(expected),
+              error * static_cast<double>(expected));
+}
+
+}  // namespace
+
+TEST(HyperLogLogTest, Empty) {
+  HyperLogLog sketch;
+  ASSERT_EQ(sketch.precision(), HyperLogLog::kDefaultPrecision);
+  ASSERT_EQ(sketch.Estimate(), 0);
+}
+
+TEST(HyperLogLogTest, FewValues) {
+  HyperLogLog sketch;
+  // duplicates don't change the estimate
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    AddRange(&sketch, 0, 10);
+    ASSERT_EQ(sketch.Estimate(), 10);
+  }
+  sketch.Reset();
+  ASSERT_EQ(sketch.Estimate(), 0);
+}
+
+TEST(HyperLogLogTest, ManyValues) {
+  for (uint32_t precision : {HyperLogLog::kMinPrecision, 10U, 14U}) {
+    ARROW_SCOPED_TRACE("precision = ", precision);
+    for (int64_t num_values : {1000, 100000}) {
+      ARROW_SCOPED_TRACE("num_values = ", num_values);
+      HyperLogLog sketch(precision);
+      AddRange(&sketch, 0, num_values);
+      AddRange(&sketch, 0, num_values / 2);
+      AssertEstimateNear(sketch, num_values);
+    }
+  }
+}
+
+TEST(HyperLogLogTest, Merge) {
+  HyperLogLog left, right, all;
+  AddRange(&left, 0, 60000);
+  AddRange(&right, 40000, 100000);
+  AddRange(&all, 0, 100000);
+
+  ASSERT_OK(left.Merge(right));
+  // merging is exactly equivalent to adding all values to one sketch
+  ASSERT_EQ(left.Serialize(), all.Serialize());
+  AssertEstimateNear(left, 100000);
+
+  HyperLogLog other_precision(10);
+  ASSERT_RAISES(Invalid, left.Merge(other_precision));
+}
+
+TEST(HyperLogLogTest, Serialize) {
+  HyperLogLog sketch(8);
+  AddRange(&sketch, 0, 5000);
+  std::string serialized = sketch.Serialize();
+  ASSERT_EQ(serialized.size(), 2 + 256);
+
+  ASSERT_OK_AND_ASSIGN(auto roundtripped, HyperLogLog::Deserialize(serialized));
+  ASSERT_EQ(roundtripped.precision(), 8);
+  ASSERT_EQ(roundtripped.Estimate(), sketch.Estimate());
+  ASSERT_EQ(roundtripped.Serialize(), serialized);
+
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(""));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(serialized.substr(0, 100)));
+  std::string bad_version = serialized;
+  bad_version[0] = 42;
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(bad_version));
+  std::string bad_register = serialized;
+  bad_register[10] = static_cast<char>(64);
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(bad_register));
+}
+
+TEST(HyperLogLogTest, ValidatePrecision) {
+  ASSERT_OK(HyperLogLog::ValidatePrecision(HyperLogLog::kMinPrecision));
+  ASSERT_OK(HyperLogLog::ValidatePrecision(HyperLogLog::kMaxPrecision));
+  ASSERT_RAISES(Invalid, HyperLogLog::ValidatePrecision(HyperLogLog::kMinPrecision - 1));
+  ASSERT_RAISES(Invalid, HyperLogLog::ValidatePrecision(HyperLogLog::kMaxPrecision + 1));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -46,6 +48,43 @@ Status ParallelFor(int num_tasks, FUNCTION&& func,
   return st;
 }
 
+// A variant of ParallelFor which the tasks of `executor` may call without risking a
+// deadlock: the calling thread runs tasks as well, and only waits for the tasks
+// which other threads have started.
+template <class FUNCTION>
+Status ParallelForWithCaller(int num_tasks, FUNCTION&& func,
+                             Executor* executor = internal::GetCpuThreadPool()) {
+  struct State {
+    explicit State(int num_tasks) : next_task(0), finished(num_tasks) {
+      for (auto& fut : finished) {
+        fut = Future<>::Make();
+      }
+    }
+
+    std::atomic<int> next_task;
+    std::vector<Future<>> finished;
+  };
+  auto state = std::make_shared<State>(num_tasks);
+  // `func` is only called for tasks which are claimed before the caller returns
+  auto run_tasks = [state, num_tasks, &func]() {
+    for (int i = state->next_task++; i < num_tasks; i = state->next_task++) {
+      state->finished[i].MarkFinished(func(i));
+    }
+  };
+
+  for (int i = 1; i < num_tasks; ++i) {
+    if (!executor->Spawn(run_tasks).ok()) {
+      break;
+    }
+  }
+  run_tasks();
+  auto st = Status::OK();
+  for (auto& fut : state->finished) {
+    st &= fut.status();
+  }
+  return st;
+}
+
 template <class FUNCTION, typename T,
           typename R = typename internal::call_traits::return_type<FUNCTION>::ValueType>
 Future<std::vector<R>> ParallelForAsync(
@@ -119,6 +119,15 @@ class RleDecoder {
   template <typename T>
   int GetBatch(T* values, int batch_size);
 
+  /// \brief Decode values of bit width 1 as the bits of a bitmap
+  ///
+  /// Bit-packed runs are copied as is and repeated runs are filled, without
+  /// expanding the values. Decoding stops at a repeated value other than 0 or 1.
+  /// Returns the number of values decoded and sets 'num_set' to how many of them
+  /// are 1.
+  int GetBitmap(int batch_size, uint8_t* bitmap, int64_t bitmap_offset,
+                int64_t* num_set);
+
   /// Like GetBatch but add spacing for null entries
   template <typename T>
   int GetBatchSpaced(int batch_size, int null_count, const uint8_t* valid_bits,
@@ -333,6 +342,48 @@ inline int RleDecoder::GetBatch(T* values, int batch_size) {
   return values_read;
 }
 
+inline int RleDecoder::GetBitmap(int batch_size, uint8_t* bitmap, int64_t bitmap_offset,
+                                 int64_t* num_set) {
+  DCHECK_EQ(bit_width_, 1);
+  int values_read = 0;
+  *num_set = 0;
+
+  while (values_read < batch_size) {
+    int remaining = batch_size - values_read;
+
+    if (repeat_count_ > 0) {  // Repeated value case.
+      if (ARROW_PREDICT_FALSE(current_value_ > 1)) {
+        return values_read;
+      }
+      int repeat_batch = std::min(remaining, repeat_count_);
+      BitUtil::SetBitsTo(bitmap, bitmap_offset + values_read, repeat_batch,
+                         current_value_ == 1);
+      if (current_value_ == 1) {
+        *num_set += repeat_batch;
+      }
+
+      repeat_count_ -= repeat_batch;
+      values_read += repeat_batch;
+    } else if (literal_count_ > 0) {
+      int literal_batch = std::min(remaining, literal_count_);
+      int actual_read =
+          bit_reader_.GetBitmap(literal_batch, bitmap, bitmap_offset + values_read);
+      *num_set += ::arrow::internal::CountSetBits(bitmap, bitmap_offset + values_read,
+                                                  actual_read);
+      if (actual_read != literal_batch) {
+        return values_read + actual_read;
+      }
+
+      literal_count_ -= literal_batch;
+      values_read += literal_batch;
+    } else {
+      if (!NextCounts<uint8_t>()) return values_read;
+    }
+  }
+
+  return values_read;
+}
+
 template <typename T, typename RunType, typename Converter>
 inline int RleDecoder::GetSpaced(Converter converter, int batch_size, int null_count,
                                  const uint8_t* valid_bits, int64_t valid_bits_offset,
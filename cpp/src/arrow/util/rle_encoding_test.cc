@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -30,6 +31,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/rle_encoding.h"
 
@@ -569,5 +571,50 @@ TEST(RleDecoder, GetBatchSpaced) {
   }
 }
 
+TEST(RleDecoder, GetBitmap) {
+  ::arrow::random::RandomArrayGenerator rand(/*seed=*/42);
+  for (const double true_probability : {0.0, 0.01, 0.5, 0.99, 1.0}) {
+    auto values = std::static_pointer_cast<BooleanArray>(
+        rand.Boolean(10000, true_probability, /*null_probability=*/0));
+    const int num_values = static_cast<int>(values->length());
+
+    const int buffer_size = RleEncoder::MaxBufferSize(/*bit_width=*/1, num_values);
+    std::vector<uint8_t> buffer(buffer_size);
+    RleEncoder encoder(buffer.data(), buffer_size, /*bit_width=*/1);
+    for (int i = 0; i < num_values; ++i) {
+      ASSERT_TRUE(encoder.Put(values->Value(i)));
+    }
+    const int encoded_size = encoder.Flush();
+
+    // Decode in batches which end within runs, at bitmap offsets which aren't
+    // multiples of 8
+    for (const int batch_size : {1, 7, 100, 1000}) {
+      RleDecoder decoder(buffer.data(), encoded_size, /*bit_width=*/1);
+      std::vector<uint8_t> bitmap(BitUtil::BytesForBits(num_values + 3));
+      int64_t total_set = 0;
+      int values_read = 0;
+      while (values_read < num_values) {
+        const int to_read = std::min(batch_size, num_values - values_read);
+        int64_t num_set = 0;
+        ASSERT_EQ(to_read,
+                  decoder.GetBitmap(to_read, bitmap.data(), values_read + 3, &num_set));
+        total_set += num_set;
+        values_read += to_read;
+      }
+
+      ASSERT_EQ(values->true_count(), total_set);
+      ASSERT_TRUE(::arrow::internal::BitmapEquals(
+          bitmap.data(), 3, values->values()->data(), values->offset(), num_values));
+    }
+  }
+
+  // A repeated value which doesn't fit in a bit
+  const uint8_t buffer[] = {/*indicator=*/8 << 1, /*value=*/2};
+  RleDecoder decoder(buffer, sizeof(buffer), /*bit_width=*/1);
+  uint8_t bitmap[1];
+  int64_t num_set = 0;
+  ASSERT_EQ(0, decoder.GetBitmap(8, bitmap, 0, &num_set));
+}
+
 }  // namespace util
 }  // namespace arrow
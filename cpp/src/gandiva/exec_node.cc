@@ -0,0 +1,632 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/exec_node.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+
+#include "gandiva/filter.h"
+#include "gandiva/projector.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::Datum;
+using arrow::internal::checked_cast;
+using arrow::compute::ExecBatch;
+using arrow::compute::ExecNode;
+using arrow::compute::ExecPlan;
+
+namespace {
+
+// compute functions whose Gandiva counterpart has the same semantics
+const std::unordered_map<std::string, std::string>& GandivaFunctionNames() {
+  static const std::unordered_map<std::string, std::string> names = {
+      {"add", "add"},
+      {"subtract", "subtract"},
+      {"multiply", "multiply"},
+      {"divide", "divide"},
+      {"equal", "equal"},
+      {"not_equal", "not_equal"},
+      {"less", "less_than"},
+      {"less_equal", "less_than_or_equal_to"},
+      {"greater", "greater_than"},
+      {"greater_equal", "greater_than_or_equal_to"},
+      {"invert", "not"},
+      {"is_null", "isnull"},
+      {"is_valid", "isnotnull"},
+  };
+  return names;
+}
+
+bool IsArithmetic(const std::string& function_name) {
+  return function_name == "add" || function_name == "subtract" ||
+         function_name == "multiply" || function_name == "divide";
+}
+
+// Casts which can't fail or lose precision, so that the compute cast's checks are moot
+bool IsLosslessCast(const arrow::DataType& from, const arrow::DataType& to) {
+  switch (to.id()) {
+    case arrow::Type::INT64:
+      return from.id() == arrow::Type::INT32;
+    case arrow::Type::DOUBLE:
+      return from.id() == arrow::Type::INT32 || from.id() == arrow::Type::FLOAT;
+    default:
+      return false;
+  }
+}
+
+Status MakeLiteralNode(const arrow::Scalar& scalar, NodePtr* node) {
+  if (!scalar.is_valid) {
+    *node = TreeExprBuilder::MakeNull(scalar.type);
+    return Status::OK();
+  }
+
+  switch (scalar.type->id()) {
+#define LITERAL_CASE(TYPE_CLASS, C_TYPE)                              \
+  case arrow::TYPE_CLASS##Type::type_id:                              \
+    *node = TreeExprBuilder::MakeLiteral(static_cast<C_TYPE>(         \
+        checked_cast<const arrow::TYPE_CLASS##Scalar&>(scalar).value)); \
+    return Status::OK();
+
+    LITERAL_CASE(Boolean, bool)
+    LITERAL_CASE(UInt8, uint8_t)
+    LITERAL_CASE(UInt16, uint16_t)
+    LITERAL_CASE(UInt32, uint32_t)
+    LITERAL_CASE(UInt64, uint64_t)
+    LITERAL_CASE(Int8, int8_t)
+    LITERAL_CASE(Int16, int16_t)
+    LITERAL_CASE(Int32, int32_t)
+    LITERAL_CASE(Int64, int64_t)
+    LITERAL_CASE(Float, float)
+    LITERAL_CASE(Double, double)
+
+#undef LITERAL_CASE
+
+    case arrow::Type::STRING:
+      *node = TreeExprBuilder::MakeStringLiteral(
+          checked_cast<const arrow::StringScalar&>(scalar).value->ToString());
+      return Status::OK();
+    case arrow::Type::BINARY:
+      *node = TreeExprBuilder::MakeBinaryLiteral(
+          checked_cast<const arrow::BinaryScalar&>(scalar).value->ToString());
+      return Status::OK();
+    default:
+      return Status::NotImplemented("Gandiva literal of type ", *scalar.type);
+  }
+}
+
+}  // namespace
+
+Status MakeGandivaNode(const arrow::compute::Expression& expr, const SchemaPtr& schema,
+                       NodePtr* node) {
+  if (!expr.IsBound()) {
+    return Status::Invalid("Cannot translate unbound expression ", expr.ToString());
+  }
+
+  if (auto literal = expr.literal()) {
+    if (!literal->is_scalar()) {
+      return Status::NotImplemented("Gandiva literal ", literal->ToString());
+    }
+    return MakeLiteralNode(*literal->scalar(), node);
+  }
+
+  if (auto parameter = expr.parameter()) {
+    if (parameter->index < 0 || parameter->index >= schema->num_fields()) {
+      return Status::Invalid("Field reference ", expr.ToString(), " is not in schema ",
+                             schema->ToString());
+    }
+    *node = TreeExprBuilder::MakeField(schema->field(parameter->index));
+    return Status::OK();
+  }
+
+  auto call = expr.call();
+  NodeVector arguments(call->arguments.size());
+  for (size_t i = 0; i < arguments.size(); ++i) {
+    ARROW_RETURN_NOT_OK(MakeGandivaNode(call->arguments[i], schema, &arguments[i]));
+  }
+
+  const auto& name = call->function_name;
+  const auto& type = expr.type();
+  if (name == "and_kleene") {
+    *node = TreeExprBuilder::MakeAnd(arguments);
+    return Status::OK();
+  }
+  if (name == "or_kleene") {
+    *node = TreeExprBuilder::MakeOr(arguments);
+    return Status::OK();
+  }
+  if (name == "if_else") {
+    // Gandiva takes the else branch for a null condition, where if_else emits null
+    auto condition_is_null =
+        TreeExprBuilder::MakeFunction("isnull", {arguments[0]}, arrow::boolean());
+    *node = TreeExprBuilder::MakeIf(
+        condition_is_null, TreeExprBuilder::MakeNull(type),
+        TreeExprBuilder::MakeIf(arguments[0], arguments[1], arguments[2], type), type);
+    return Status::OK();
+  }
+  if (name == "cast") {
+    const auto& from = *call->arguments[0].type();
+    if (!IsLosslessCast(from, *type)) {
+      return Status::NotImplemented("Gandiva cast from ", from, " to ", *type);
+    }
+    *node = TreeExprBuilder::MakeFunction(
+        type->id() == arrow::Type::INT64 ? "castBIGINT" : "castFLOAT8", arguments, type);
+    return Status::OK();
+  }
+
+  auto it = GandivaFunctionNames().find(name);
+  if (it == GandivaFunctionNames().end()) {
+    return Status::NotImplemented("Gandiva function for ", name);
+  }
+  if (IsArithmetic(name)) {
+    // Gandiva raises on floating point division by zero and scales decimals
+    // differently, so leave those to the compute kernels
+    const bool integer = arrow::is_integer(type->id());
+    if (!integer && (name == "divide" || !arrow::is_floating(type->id()))) {
+      return Status::NotImplemented("Gandiva ", name, " for ", *type);
+    }
+  }
+  if (name == "is_null" && call->options &&
+      checked_cast<const arrow::compute::NullOptions&>(*call->options).nan_is_null) {
+    return Status::NotImplemented("Gandiva is_null with nan_is_null");
+  }
+  *node = TreeExprBuilder::MakeFunction(it->second, arguments, type);
+  return Status::OK();
+}
+
+namespace {
+
+// Rename the fields of the input schema, since Gandiva resolves fields by name
+SchemaPtr MakeUniquelyNamedSchema(const arrow::Schema& schema) {
+  FieldVector fields(schema.num_fields());
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    fields[i] = schema.field(i)->WithName("f" + std::to_string(i));
+  }
+  return arrow::schema(std::move(fields));
+}
+
+// The input columns referenced by a set of compiled expressions, and the schema
+// they are compiled against
+class CompiledInput {
+ public:
+  CompiledInput() = default;
+
+  CompiledInput(const SchemaPtr& full_schema,
+                const std::vector<arrow::compute::Expression>& exprs) {
+    std::vector<bool> referenced(full_schema->num_fields(), false);
+    for (const auto& expr : exprs) {
+      for (int index : arrow::compute::FieldIndicesInExpression(expr)) {
+        referenced[index] = true;
+      }
+    }
+    FieldVector fields;
+    for (int i = 0; i < full_schema->num_fields(); ++i) {
+      if (!referenced[i]) continue;
+      columns_.push_back(i);
+      fields.push_back(full_schema->field(i));
+    }
+    schema_ = arrow::schema(std::move(fields));
+  }
+
+  const SchemaPtr& schema() const { return schema_; }
+
+  // Wrap the referenced columns of a batch into a record batch, broadcasting scalars.
+  // If the batch has a selection vector, the record batch holds the unselected rows.
+  Result<RecordBatchPtr> MakeRecordBatch(const ExecBatch& batch,
+                                         arrow::MemoryPool* pool) const {
+    int64_t num_rows = batch.length;
+    if (batch.selection_vector) {
+      for (const auto& value : batch.values) {
+        if (value.is_array()) {
+          num_rows = value.length();
+          break;
+        }
+      }
+    }
+
+    arrow::ArrayVector columns(columns_.size());
+    for (size_t i = 0; i < columns.size(); ++i) {
+      const Datum& value = batch.values[columns_[i]];
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(
+            columns[i], arrow::MakeArrayFromScalar(*value.scalar(), num_rows, pool));
+      } else {
+        columns[i] = value.make_array();
+      }
+    }
+    return arrow::RecordBatch::Make(schema_, num_rows, std::move(columns));
+  }
+
+ private:
+  std::vector<int> columns_;
+  SchemaPtr schema_;
+};
+
+// Wrap a compute selection vector for Gandiva. The indices are non-negative, so
+// their int32 buffer can be reinterpreted as uint32.
+Status MakeGandivaSelection(const arrow::compute::SelectionVector& selection,
+                            std::shared_ptr<SelectionVector>* out) {
+  const auto& data = *selection.data();
+  auto buffer = arrow::SliceBuffer(data.buffers[1], data.offset * sizeof(int32_t),
+                                   data.length * sizeof(int32_t));
+  return SelectionVector::MakeImmutableInt32(data.length, std::move(buffer), out);
+}
+
+// Boilerplate shared by the nodes below, which process each batch independently
+class GandivaNode : public ExecNode {
+ public:
+  GandivaNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+              std::shared_ptr<arrow::Schema> output_schema)
+      : ExecNode(plan, std::move(inputs), /*input_labels=*/{"target"},
+                 std::move(output_schema),
+                 /*num_outputs=*/1) {}
+
+  bool accepts_selection_vector() const override { return true; }
+
+  virtual Result<ExecBatch> Process(const ExecBatch& target) = 0;
+
+  void InputReceived(ExecNode* input, ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+
+    auto maybe_processed = Process(batch);
+    if (ErrorIfNotOk(maybe_processed.status())) return;
+
+    maybe_processed->guarantee = batch.guarantee;
+    EmitBatch(outputs_[0], maybe_processed.MoveValueUnsafe());
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, std::move(error));
+  }
+
+  void InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EmitFinished(outputs_[0], total_batches);
+  }
+
+  Status StartProducing() override { return Status::OK(); }
+
+  void PauseProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->PauseProducing(this);
+  }
+
+  void ResumeProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    inputs_[0]->ResumeProducing(this);
+  }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    StopProducing();
+  }
+
+  void StopProducing() override { inputs_[0]->StopProducing(this); }
+
+  arrow::Future<> finished() override { return inputs_[0]->finished(); }
+};
+
+class GandivaFilterNode : public GandivaNode {
+ public:
+  GandivaFilterNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                    arrow::compute::Expression filter, CompiledInput compiled_input,
+                    std::shared_ptr<Filter> compiled_filter)
+      : GandivaNode(plan, inputs, inputs[0]->output_schema()),
+        filter_(std::move(filter)),
+        compiled_input_(std::move(compiled_input)),
+        compiled_filter_(std::move(compiled_filter)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const arrow::compute::ExecNodeOptions& options) {
+    ARROW_RETURN_NOT_OK(
+        arrow::compute::ValidateExecNodeInputs(plan, inputs, 1, "GandivaFilterNode"));
+    const auto& filter_options =
+        checked_cast<const arrow::compute::FilterNodeOptions&>(options);
+    const auto& input_schema = inputs[0]->output_schema();
+
+    auto filter = filter_options.filter_expression;
+    if (!filter.IsBound()) {
+      ARROW_ASSIGN_OR_RAISE(filter, filter.Bind(*input_schema));
+    }
+
+    // Compile the filter if possible, or leave it to the interpreting FilterNode
+    auto schema = MakeUniquelyNamedSchema(*input_schema);
+    CompiledInput compiled_input(schema, {filter});
+    std::shared_ptr<Filter> compiled_filter;
+    NodePtr node;
+    if (filter.type()->id() != arrow::Type::BOOL || !filter.call() ||
+        !MakeGandivaNode(filter, schema, &node).ok() ||
+        !Filter::Make(compiled_input.schema(), TreeExprBuilder::MakeCondition(node),
+                      &compiled_filter)
+             .ok()) {
+      return arrow::compute::MakeExecNode("filter", plan, std::move(inputs), options);
+    }
+
+    ExecNode* filter_node = plan->EmplaceNode<GandivaFilterNode>(
+        plan, std::move(inputs), std::move(filter), std::move(compiled_input),
+        std::move(compiled_filter));
+    if (!filter_options.coalesce_output) {
+      return filter_node;
+    }
+    return arrow::compute::MakeExecNode("coalesce", plan, {filter_node},
+                                        arrow::compute::CoalesceNodeOptions{});
+  }
+
+  const char* kind_name() const override { return "GandivaFilterNode"; }
+
+  Result<ExecBatch> Process(const ExecBatch& target) override {
+    auto ctx = plan()->exec_context();
+    ARROW_ASSIGN_OR_RAISE(
+        auto simplified_filter,
+        arrow::compute::SimplifyWithGuarantee(filter_, target.guarantee));
+    if (auto literal = simplified_filter.literal()) {
+      const auto& mask_scalar = literal->scalar_as<arrow::BooleanScalar>();
+      if (mask_scalar.is_valid && mask_scalar.value) {
+        return target;
+      }
+      return target.Slice(0, 0);
+    }
+
+    if (target.selection_vector) {
+      // The compiled filter can't narrow an existing selection, so interpret it
+      ARROW_ASSIGN_OR_RAISE(
+          Datum mask,
+          arrow::compute::ExecuteScalarExpression(simplified_filter, target, ctx));
+      if (mask.is_scalar()) {
+        const auto& mask_scalar = mask.scalar_as<arrow::BooleanScalar>();
+        if (mask_scalar.is_valid && mask_scalar.value) {
+          return target;
+        }
+        return target.Slice(0, 0);
+      }
+      ExecBatch out = target;
+      ARROW_ASSIGN_OR_RAISE(out.selection_vector,
+                            target.selection_vector->Filter(
+                                arrow::BooleanArray(mask.array()), ctx->memory_pool()));
+      out.length = out.selection_vector->length();
+      return out;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto batch,
+                          compiled_input_.MakeRecordBatch(target, ctx->memory_pool()));
+    std::shared_ptr<SelectionVector> selected;
+    ARROW_RETURN_NOT_OK(
+        SelectionVector::MakeInt32(target.length, ctx->memory_pool(), &selected));
+    ARROW_RETURN_NOT_OK(compiled_filter_->Evaluate(*batch, selected));
+
+    if (selected->GetNumSlots() == target.length) {
+      return target;
+    }
+    if (selected->GetNumSlots() == 0) {
+      return target.Slice(0, 0);
+    }
+
+    // The selected indices are below target.length, so they fit in int32. Outputs
+    // which don't accept a selection vector get a materialized batch from EmitBatch().
+    auto indices = selected->ToArray()->data()->Copy();
+    indices->type = arrow::int32();
+    ExecBatch out = target;
+    out.selection_vector =
+        std::make_shared<arrow::compute::SelectionVector>(std::move(indices));
+    out.length = out.selection_vector->length();
+    return out;
+  }
+
+ protected:
+  std::string ToStringExtra() const override { return "filter=" + filter_.ToString(); }
+
+ private:
+  arrow::compute::Expression filter_;
+  CompiledInput compiled_input_;
+  std::shared_ptr<Filter> compiled_filter_;
+};
+
+class GandivaProjectNode : public GandivaNode {
+ public:
+  struct Compiled {
+    // The indices of the compiled expressions among the projected ones
+    std::vector<int> indices;
+    CompiledInput input;
+    // Projectors for batches without and with a selection vector
+    std::shared_ptr<Projector> projector, selection_projector;
+  };
+
+  GandivaProjectNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                     std::shared_ptr<arrow::Schema> output_schema,
+                     std::vector<arrow::compute::Expression> exprs, Compiled compiled)
+      : GandivaNode(plan, std::move(inputs), std::move(output_schema)),
+        exprs_(std::move(exprs)),
+        compiled_(std::move(compiled)),
+        is_compiled_(exprs_.size(), false) {
+    for (int i : compiled_.indices) {
+      is_compiled_[i] = true;
+    }
+  }
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const arrow::compute::ExecNodeOptions& options) {
+    ARROW_RETURN_NOT_OK(
+        arrow::compute::ValidateExecNodeInputs(plan, inputs, 1, "GandivaProjectNode"));
+    const auto& project_options =
+        checked_cast<const arrow::compute::ProjectNodeOptions&>(options);
+    const auto& input_schema = inputs[0]->output_schema();
+    auto exprs = project_options.expressions;
+    auto names = project_options.names;
+
+    if (names.size() == 0) {
+      names.resize(exprs.size());
+      for (size_t i = 0; i < exprs.size(); ++i) {
+        names[i] = exprs[i].ToString();
+      }
+    }
+
+    FieldVector fields(exprs.size());
+    for (size_t i = 0; i < exprs.size(); ++i) {
+      if (!exprs[i].IsBound()) {
+        ARROW_ASSIGN_OR_RAISE(exprs[i], exprs[i].Bind(*input_schema));
+      }
+      fields[i] = arrow::field(std::move(names[i]), exprs[i].type());
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto compiled, Compile(*input_schema, exprs));
+    if (compiled.indices.empty()) {
+      // Nothing to compile, leave everything to the interpreting ProjectNode
+      return arrow::compute::MakeExecNode("project", plan, std::move(inputs), options);
+    }
+
+    return plan->EmplaceNode<GandivaProjectNode>(
+        plan, std::move(inputs), arrow::schema(std::move(fields)), std::move(exprs),
+        std::move(compiled));
+  }
+
+  const char* kind_name() const override { return "GandivaProjectNode"; }
+
+  Result<ExecBatch> Process(const ExecBatch& target) override {
+    auto ctx = plan()->exec_context();
+    std::vector<Datum> values(exprs_.size());
+
+    ARROW_ASSIGN_OR_RAISE(auto batch,
+                          compiled_.input.MakeRecordBatch(target, ctx->memory_pool()));
+    std::vector<ArrayPtr> compiled_values;
+    if (target.selection_vector) {
+      // The compiled kernels gather the selected rows as they evaluate them
+      std::shared_ptr<SelectionVector> selection;
+      ARROW_RETURN_NOT_OK(MakeGandivaSelection(*target.selection_vector, &selection));
+      ARROW_RETURN_NOT_OK(compiled_.selection_projector->Evaluate(
+          *batch, selection.get(), ctx->memory_pool(), &compiled_values));
+    } else {
+      ARROW_RETURN_NOT_OK(
+          compiled_.projector->Evaluate(*batch, ctx->memory_pool(), &compiled_values));
+    }
+    for (size_t i = 0; i < compiled_values.size(); ++i) {
+      values[compiled_.indices[i]] = std::move(compiled_values[i]);
+    }
+
+    for (size_t i = 0; i < exprs_.size(); ++i) {
+      if (is_compiled_[i]) continue;
+      ARROW_ASSIGN_OR_RAISE(
+          auto simplified_expr,
+          arrow::compute::SimplifyWithGuarantee(exprs_[i], target.guarantee));
+      ARROW_ASSIGN_OR_RAISE(values[i], arrow::compute::ExecuteScalarExpression(
+                                           simplified_expr, target, ctx));
+    }
+    return ExecBatch{std::move(values), target.length};
+  }
+
+ protected:
+  std::string ToStringExtra() const override {
+    std::stringstream ss;
+    ss << "projection=[";
+    for (size_t i = 0; i < exprs_.size(); i++) {
+      if (i > 0) ss << ", ";
+      auto repr = exprs_[i].ToString();
+      if (repr != output_schema_->field(static_cast<int>(i))->name()) {
+        ss << '"' << output_schema_->field(static_cast<int>(i))->name() << "\": ";
+      }
+      ss << repr;
+      if (is_compiled_[i]) ss << " (compiled)";
+    }
+    ss << ']';
+    return ss.str();
+  }
+
+ private:
+  static Status MakeProjectors(const SchemaPtr& schema, const ExpressionVector& exprs,
+                               Compiled* compiled) {
+    auto configuration = ConfigurationBuilder::DefaultConfiguration();
+    ARROW_RETURN_NOT_OK(Projector::Make(schema, exprs, SelectionVector::MODE_NONE,
+                                        configuration, &compiled->projector));
+    return Projector::Make(schema, exprs, SelectionVector::MODE_UINT32, configuration,
+                           &compiled->selection_projector);
+  }
+
+  static Result<Compiled> Compile(const arrow::Schema& input_schema,
+                                  const std::vector<arrow::compute::Expression>& exprs) {
+    auto schema = MakeUniquelyNamedSchema(input_schema);
+
+    // Field references and literals are cheaper to interpret, since that doesn't copy
+    Compiled compiled;
+    ExpressionVector gandiva_exprs;
+    std::vector<arrow::compute::Expression> compiled_exprs;
+    for (size_t i = 0; i < exprs.size(); ++i) {
+      NodePtr node;
+      if (!exprs[i].call() || !MakeGandivaNode(exprs[i], schema, &node).ok()) continue;
+      compiled.indices.push_back(static_cast<int>(i));
+      compiled_exprs.push_back(exprs[i]);
+      gandiva_exprs.push_back(TreeExprBuilder::MakeExpression(
+          node, arrow::field("out" + std::to_string(i), exprs[i].type())));
+    }
+    if (compiled.indices.empty()) return compiled;
+
+    compiled.input = CompiledInput(schema, compiled_exprs);
+    if (MakeProjectors(compiled.input.schema(), gandiva_exprs, &compiled).ok()) {
+      return compiled;
+    }
+
+    // Some translated expression has no Gandiva kernel for its argument types.
+    // Find out which by compiling them one by one, then compile the rest together.
+    Compiled supported;
+    ExpressionVector supported_gandiva_exprs;
+    std::vector<arrow::compute::Expression> supported_exprs;
+    for (size_t i = 0; i < compiled.indices.size(); ++i) {
+      CompiledInput input(schema, {compiled_exprs[i]});
+      std::shared_ptr<Projector> projector;
+      if (!Projector::Make(input.schema(), {gandiva_exprs[i]}, &projector).ok()) continue;
+      supported.indices.push_back(compiled.indices[i]);
+      supported_gandiva_exprs.push_back(gandiva_exprs[i]);
+      supported_exprs.push_back(compiled_exprs[i]);
+    }
+    if (supported.indices.empty()) return supported;
+
+    supported.input = CompiledInput(schema, supported_exprs);
+    ARROW_RETURN_NOT_OK(
+        MakeProjectors(supported.input.schema(), supported_gandiva_exprs, &supported));
+    return supported;
+  }
+
+  std::vector<arrow::compute::Expression> exprs_;
+  Compiled compiled_;
+  std::vector<bool> is_compiled_;
+};
+
+}  // namespace
+
+Status RegisterExecNodes(arrow::compute::ExecFactoryRegistry* registry) {
+  ARROW_RETURN_NOT_OK(registry->AddFactory("gandiva_filter", GandivaFilterNode::Make));
+  return registry->AddFactory("gandiva_project", GandivaProjectNode::Make);
+}
+
+}  // namespace gandiva
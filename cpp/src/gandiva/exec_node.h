@@ -0,0 +1,50 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/expression.h"
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/gandiva_aliases.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Translate a bound compute expression into an equivalent Gandiva tree.
+///
+/// Field references resolve to the fields of 'schema', which must have the fields of
+/// the schema the expression was bound to. Returns NotImplemented if the expression
+/// uses a function, option or literal for which Gandiva lacks an implementation with
+/// the same semantics.
+GANDIVA_EXPORT
+Status MakeGandivaNode(const arrow::compute::Expression& expr, const SchemaPtr& schema,
+                       NodePtr* node);
+
+/// \brief Register the "gandiva_filter" and "gandiva_project" ExecNode factories.
+///
+/// They take FilterNodeOptions and ProjectNodeOptions and behave like "filter" and
+/// "project", except that expressions which MakeGandivaNode() can translate are
+/// compiled into fused kernels, which evaluate them without materializing the
+/// intermediate results. Other expressions are executed with ExecuteScalarExpression().
+GANDIVA_EXPORT
+Status RegisterExecNodes(arrow::compute::ExecFactoryRegistry* registry =
+                             arrow::compute::default_exec_factory_registry());
+
+}  // namespace gandiva
@@ -0,0 +1,200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "gandiva/exec_node.h"
+#include "gandiva/node.h"
+
+namespace gandiva {
+
+namespace cp = arrow::compute;
+
+using arrow::int32;
+using arrow::utf8;
+using cp::call;
+using cp::field_ref;
+using cp::literal;
+using testing::HasSubstr;
+using testing::StartsWith;
+
+class TestExecNode : public ::testing::Test {
+ public:
+  void SetUp() {
+    static Status registered = RegisterExecNodes();
+    ASSERT_OK(registered);
+
+    input_.schema = arrow::schema({arrow::field("a", int32()), arrow::field("b", int32()),
+                                   arrow::field("s", utf8())});
+    input_.batches = {cp::ExecBatchFromJSON({int32(), int32(), utf8()}, R"([
+                        [1, 10, "alfa"],
+                        [2, null, "beta"],
+                        [3, 30, null]
+                      ])"),
+                      cp::ExecBatchFromJSON({int32(), int32(), utf8()}, R"([
+                        [4, 40, "gama"],
+                        [null, 50, "delta"]
+                      ])")};
+  }
+
+ protected:
+  // Run source -> nodes -> sink serially and collect the output. The description of
+  // the last of the nodes is returned in 'node_description'.
+  Result<std::shared_ptr<arrow::Table>> Run(std::vector<cp::Declaration> nodes,
+                                            std::string* node_description = NULLPTR) {
+    ARROW_ASSIGN_OR_RAISE(auto plan, cp::ExecPlan::Make());
+    arrow::AsyncGenerator<arrow::util::optional<cp::ExecBatch>> sink_gen;
+
+    std::vector<cp::Declaration> decls = {
+        {"source",
+         cp::SourceNodeOptions{input_.schema,
+                               input_.gen(/*parallel=*/false, /*slow=*/false)}}};
+    decls.insert(decls.end(), nodes.begin(), nodes.end());
+    decls.push_back({"sink", cp::SinkNodeOptions{&sink_gen}});
+    ARROW_ASSIGN_OR_RAISE(
+        auto sink, cp::Declaration::Sequence(std::move(decls)).AddToPlan(plan.get()));
+
+    const auto& node = *sink->inputs()[0];
+    if (node_description) *node_description = node.ToString();
+    auto collected = cp::StartAndCollect(plan.get(), sink_gen);
+    ARROW_ASSIGN_OR_RAISE(auto batches, collected.result());
+
+    arrow::RecordBatchVector record_batches;
+    for (const auto& batch : batches) {
+      ARROW_ASSIGN_OR_RAISE(auto record_batch,
+                            batch.ToRecordBatch(node.output_schema()));
+      record_batches.push_back(std::move(record_batch));
+    }
+    return arrow::Table::FromRecordBatches(node.output_schema(), record_batches);
+  }
+
+  // Check that the Gandiva nodes produce the same output as the interpreting ones
+  void AssertSameAsInterpreted(std::vector<cp::Declaration> nodes,
+                               std::vector<cp::Declaration> gandiva_nodes) {
+    ASSERT_OK_AND_ASSIGN(auto expected, Run(std::move(nodes)));
+    ASSERT_OK_AND_ASSIGN(auto actual, Run(std::move(gandiva_nodes)));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+
+  cp::BatchesWithSchema input_;
+};
+
+TEST_F(TestExecNode, MakeGandivaNode) {
+  auto Translate = [&](cp::Expression expr) -> Result<NodePtr> {
+    ARROW_ASSIGN_OR_RAISE(expr, expr.Bind(*input_.schema));
+    NodePtr node;
+    ARROW_RETURN_NOT_OK(MakeGandivaNode(expr, input_.schema, &node));
+    return node;
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto node,
+                       Translate(call("add", {field_ref("a"), field_ref("b")})));
+  ASSERT_THAT(node->ToString(), HasSubstr("add"));
+  ASSERT_OK_AND_ASSIGN(node, Translate(cp::and_(cp::greater(field_ref("a"), literal(1)),
+                                                cp::is_valid(field_ref("s")))));
+  ASSERT_THAT(node->ToString(), HasSubstr("greater_than"));
+  ASSERT_OK_AND_ASSIGN(node, Translate(call("add", {field_ref("a"), literal(1.5)})));
+  ASSERT_THAT(node->ToString(), HasSubstr("castFLOAT8"));
+
+  // No Gandiva counterpart
+  ASSERT_RAISES(NotImplemented, Translate(call("ascii_upper", {field_ref("s")})));
+  // Different semantics
+  ASSERT_RAISES(NotImplemented,
+                Translate(call("divide", {field_ref("a"), literal(2.0)})));
+  ASSERT_RAISES(NotImplemented,
+                Translate(call("cast", {field_ref("a")},
+                               cp::CastOptions::Safe(arrow::float32()))));
+
+  NodePtr unbound;
+  ASSERT_RAISES(Invalid, MakeGandivaNode(field_ref("a"), input_.schema, &unbound));
+}
+
+TEST_F(TestExecNode, Project) {
+  cp::ProjectNodeOptions options{
+      {call("add", {field_ref("a"), field_ref("b")}),
+       call("multiply", {call("subtract", {field_ref("a"), literal(1)}), field_ref("b")}),
+       cp::is_null(field_ref("s")), call("ascii_upper", {field_ref("s")}),
+       field_ref("a")},
+      {"sum", "product", "no_s", "upper", "a"}};
+  AssertSameAsInterpreted({{"project", options}}, {{"gandiva_project", options}});
+
+  std::string description;
+  ASSERT_OK(Run({{"gandiva_project", options}}, &description));
+  ASSERT_THAT(description, StartsWith("GandivaProjectNode{"));
+  ASSERT_THAT(description, HasSubstr("add(a, b) (compiled)"));
+  ASSERT_THAT(description, HasSubstr("\"upper\": ascii_upper(s), a]"));
+
+  // Nothing to compile
+  ASSERT_OK(Run({{"gandiva_project", cp::ProjectNodeOptions{{field_ref("s")}}}},
+                &description));
+  ASSERT_THAT(description, StartsWith("ProjectNode{"));
+}
+
+TEST_F(TestExecNode, Filter) {
+  auto filter =
+      cp::or_(cp::greater(field_ref("b"), literal(20)), cp::is_null(field_ref("s")));
+  AssertSameAsInterpreted({{"filter", cp::FilterNodeOptions{filter}}},
+                          {{"gandiva_filter", cp::FilterNodeOptions{filter}}});
+
+  std::string description;
+  ASSERT_OK(Run({{"gandiva_filter", cp::FilterNodeOptions{filter}}}, &description));
+  ASSERT_THAT(description, StartsWith("GandivaFilterNode{"));
+
+  // Not translatable
+  auto match = call("match_substring", {field_ref("s")},
+                    cp::MatchSubstringOptions("a"));
+  AssertSameAsInterpreted({{"filter", cp::FilterNodeOptions{match}}},
+                          {{"gandiva_filter", cp::FilterNodeOptions{match}}});
+  ASSERT_OK(Run({{"gandiva_filter", cp::FilterNodeOptions{match}}}, &description));
+  ASSERT_THAT(description, StartsWith("FilterNode{"));
+}
+
+TEST_F(TestExecNode, FilterThenProject) {
+  // The projection evaluates the selection vector emitted by the filter
+  auto filter = cp::greater(field_ref("a"), literal(1));
+  cp::ProjectNodeOptions project{{call("add", {field_ref("a"), field_ref("b")}),
+                                  call("ascii_upper", {field_ref("s")})}};
+  AssertSameAsInterpreted(
+      {{"filter", cp::FilterNodeOptions{filter}}, {"project", project}},
+      {{"gandiva_filter", cp::FilterNodeOptions{filter}}, {"gandiva_project", project}});
+
+  // A compiled filter after an interpreted one narrows the selection
+  auto match = call("match_substring", {field_ref("s")},
+                    cp::MatchSubstringOptions("a"));
+  AssertSameAsInterpreted(
+      {{"filter", cp::FilterNodeOptions{match}},
+       {"filter", cp::FilterNodeOptions{filter}},
+       {"project", project}},
+      {{"gandiva_filter", cp::FilterNodeOptions{match}},
+       {"gandiva_filter", cp::FilterNodeOptions{filter}},
+       {"gandiva_project", project}});
+}
+
+TEST_F(TestExecNode, Errors) {
+  cp::ProjectNodeOptions options{{call("divide", {field_ref("a"), literal(0)})}};
+  ASSERT_RAISES(ExecutionError, Run({{"gandiva_project", options}}));
+}
+
+}  // namespace gandiva
@@ -40,15 +40,18 @@
 #include "arrow/record_batch.h"
 #include "arrow/scalar.h"
 #include "arrow/table.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 
 #ifdef ARROW_CSV
 #include "arrow/csv/api.h"
@@ -2176,6 +2179,99 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, ReadSplitColumnChunks) {
+  const int64_t num_rows = 10000;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto table = Table::Make(
+      ::arrow::schema({::arrow::field("values", ::arrow::int64()),
+                       ::arrow::field("strings", ::arrow::utf8()),
+                       ::arrow::field("lists", ::arrow::list(::arrow::int32()))}),
+      {rag.Int64(num_rows, -100, 100, /*null_probability=*/0.1),
+       rag.String(num_rows, 0, 2, /*null_probability=*/0.1),
+       rag.List(*rag.Int32(num_rows, 0, 10, /*null_probability=*/0.1), num_rows + 1,
+                /*null_probability=*/0.1)});
+
+  // Small pages, and splitting as many column chunks into as many runs of pages as
+  // there are threads
+  auto writer_properties =
+      WriterProperties::Builder().data_pagesize(1024)->write_batch_size(100)->build();
+  ArrowReaderProperties reader_properties(/*use_threads=*/true);
+  reader_properties.set_column_chunk_split_size(1);
+
+  // Make sure there is more than one thread to split column chunks for
+  const int old_capacity = ::arrow::GetCpuThreadPoolCapacity();
+  ASSERT_OK(::arrow::SetCpuThreadPoolCapacity(4));
+  std::shared_ptr<Table> result;
+  DoRoundtrip(table, num_rows / 2, &result, writer_properties,
+              default_arrow_writer_properties(), reader_properties);
+  ASSERT_OK(::arrow::SetCpuThreadPoolCapacity(old_capacity));
+  ASSERT_FALSE(HasFatalFailure());
+
+  ASSERT_OK(result->ValidateFull());
+  ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+  ASSERT_GT(result->column(0)->num_chunks(), 2);
+  ASSERT_GT(result->column(1)->num_chunks(), 2);
+  // Repeated columns are decoded by a single thread
+  ASSERT_EQ(result->column(2)->num_chunks(), 1);
+}
+
+TEST(TestArrowReadWrite, ReadRowRanges) {
+  const int64_t num_rows = 10000;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto table = Table::Make(
+      ::arrow::schema({::arrow::field("values", ::arrow::int64()),
+                       ::arrow::field("strings", ::arrow::utf8()),
+                       ::arrow::field("lists", ::arrow::list(::arrow::int32()))}),
+      {rag.Int64(num_rows, -100, 100, /*null_probability=*/0.1),
+       rag.String(num_rows, 0, 2, /*null_probability=*/0.1),
+       rag.List(*rag.Int32(num_rows, 0, 10, /*null_probability=*/0.1), num_rows + 1,
+                /*null_probability=*/0.1)});
+
+  // Small pages, so that whole pages are skipped
+  auto writer_properties =
+      WriterProperties::Builder().data_pagesize(1024)->write_batch_size(100)->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                num_rows / 2, writer_properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+
+  const std::vector<RowRange> row_ranges = {{0, 1}, {7, 93}, {2000, 1500}, {4999, 1}};
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads = ", use_threads);
+    reader->set_use_threads(use_threads);
+    for (int row_group = 0; row_group < reader->num_row_groups(); ++row_group) {
+      const int64_t row_group_offset = row_group * (num_rows / 2);
+      ASSERT_FINISHES_OK_AND_ASSIGN(
+          auto result, reader->ReadRowRanges(row_group, {0, 1, 2}, row_ranges));
+      ASSERT_OK(result->ValidateFull());
+
+      std::vector<std::shared_ptr<Table>> slices;
+      for (const auto& range : row_ranges) {
+        slices.push_back(table->Slice(row_group_offset + range.offset, range.length));
+      }
+      ASSERT_OK_AND_ASSIGN(auto expected, ::arrow::ConcatenateTables(slices));
+      ::arrow::AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+    }
+  }
+
+  // Reading from a task of the executor which decodes the columns doesn't deadlock
+  ASSERT_OK_AND_ASSIGN(auto pool, ::arrow::internal::ThreadPool::Make(1));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto result, DeferNotOk(pool->Submit([&] {
+                                  return reader->ReadRowRanges(0, {0, 1, 2}, row_ranges,
+                                                               pool.get());
+                                })));
+  ASSERT_EQ(result->num_rows(), 1595);
+
+  // Overlapping and out of bounds ranges
+  ASSERT_FINISHES_AND_RAISES(Invalid,
+                             reader->ReadRowRanges(0, {0}, {{10, 5}, {12, 1}}));
+  ASSERT_FINISHES_AND_RAISES(Invalid, reader->ReadRowRanges(0, {0}, {{4990, 100}}));
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -2442,6 +2538,49 @@ TEST(TestArrowReadWrite, GetRecordBatchGenerator) {
   }
 }
 
+TEST(TestArrowReadWrite, GetRecordBatchGeneratorStreamsRowGroups) {
+  const int num_rows = 1000;
+  const int num_columns = 3;
+  const int64_t batch_size = 128;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, num_rows, default_arrow_writer_properties(), &buffer));
+
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads = ", use_threads);
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_batch_size(batch_size);
+    properties.set_use_threads(use_threads);
+    std::shared_ptr<FileReader> reader;
+    {
+      std::unique_ptr<FileReader> unique_reader;
+      FileReaderBuilder builder;
+      ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+      ASSERT_OK(builder.properties(properties)->Build(&unique_reader));
+      reader = std::move(unique_reader);
+    }
+    ASSERT_EQ(reader->num_row_groups(), 1);
+
+    // The row group comes out in batch_size batches rather than as a whole
+    ASSERT_OK_AND_ASSIGN(
+        auto batch_generator,
+        reader->GetRecordBatchGenerator(reader, {0}, {0, 1, 2},
+                                        ::arrow::internal::GetCpuThreadPool()));
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batches,
+                                  ::arrow::CollectAsyncGenerator(batch_generator));
+    ASSERT_EQ(batches.size(), 8U);
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_EQ(batches[i]->num_rows(), i + 1 < batches.size() ? batch_size : 104);
+    }
+    ASSERT_OK_AND_ASSIGN(auto actual, ::arrow::Table::FromRecordBatches(
+                                          batches[0]->schema(), batches));
+    AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -3997,6 +4136,104 @@ TEST_P(TestArrowReadDictionary, ReadWholeFileDict) {
   CheckReadWholeFile(*ex_table);
 }
 
+TEST_P(TestArrowReadDictionary, ReadWholeFileUnifiedDict) {
+  properties_.set_read_dictionary(0, true);
+  properties_.set_unify_dictionaries(true);
+
+  WriteSimple();
+
+  ASSERT_OK_AND_ASSIGN(auto reader, GetReader());
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  ASSERT_OK(actual->ValidateFull());
+
+  // One dictionary for all the row groups
+  const auto& column = actual->column(0);
+  ASSERT_GT(column->num_chunks(), 0);
+  auto dictionary = checked_cast<const ::arrow::DictionaryArray&>(*column->chunk(0))
+                        .dictionary()
+                        ->data();
+  for (const auto& chunk : column->chunks()) {
+    ASSERT_EQ(checked_cast<const ::arrow::DictionaryArray&>(*chunk).dictionary()->data(),
+              dictionary);
+  }
+  ASSERT_LE(dictionary->length, options.num_uniques);
+
+  ASSERT_OK_AND_ASSIGN(Datum dense, ::arrow::compute::Cast(column, ::arrow::utf8()));
+  ASSERT_TRUE(dense.chunked_array()->Equals(*expected_dense_->column(0)));
+}
+
+TEST_P(TestArrowReadDictionary, StreamReadUnifiedDict) {
+  properties_.set_read_dictionary(0, true);
+  properties_.set_unify_dictionaries(true);
+  properties_.set_batch_size(options.num_rows / options.num_row_groups / 3);
+
+  WriteSimple();
+
+  ASSERT_OK_AND_ASSIGN(auto reader, GetReader());
+  std::unique_ptr<::arrow::RecordBatchReader> rb;
+  ASSERT_OK(reader->GetRecordBatchReader(
+      ::arrow::internal::Iota(options.num_row_groups), &rb));
+
+  // The dictionary of each batch starts with the values of the previous one's
+  std::shared_ptr<Array> previous;
+  std::vector<std::shared_ptr<Array>> dense_chunks;
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(rb->ReadNext(&batch));
+    if (batch == nullptr) break;
+    const auto& dict_array =
+        checked_cast<const ::arrow::DictionaryArray&>(*batch->column(0));
+    auto dictionary = dict_array.dictionary();
+    if (previous) {
+      ASSERT_GE(dictionary->length(), previous->length());
+      ASSERT_TRUE(dictionary->Slice(0, previous->length())->Equals(*previous));
+    }
+    previous = dictionary;
+    ASSERT_OK_AND_ASSIGN(auto dense, ::arrow::compute::Cast(dict_array, ::arrow::utf8()));
+    dense_chunks.push_back(dense);
+  }
+  ASSERT_TRUE(ChunkedArray(dense_chunks).Equals(*expected_dense_->column(0)));
+}
+
+TEST_P(TestArrowReadDictionary, GeneratorReadUnifiedDict) {
+  properties_.set_read_dictionary(0, true);
+  properties_.set_unify_dictionaries(true);
+  properties_.set_batch_size(options.num_rows / options.num_row_groups / 3);
+
+  WriteSimple();
+
+  // Each row group is read by readers of its own
+  ASSERT_OK_AND_ASSIGN(auto unique_reader, GetReader());
+  std::shared_ptr<FileReader> reader(std::move(unique_reader));
+  ASSERT_OK_AND_ASSIGN(auto batch_generator,
+                       reader->GetRecordBatchGenerator(
+                           reader, ::arrow::internal::Iota(options.num_row_groups), {0},
+                           ::arrow::internal::GetCpuThreadPool()));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches,
+                                ::arrow::CollectAsyncGenerator(batch_generator));
+  ASSERT_GT(batches.size(), static_cast<size_t>(options.num_row_groups));
+
+  // The dictionary of each batch starts with the values of the previous one's, even
+  // if row groups grew the unified dictionary concurrently
+  std::shared_ptr<Array> previous;
+  std::vector<std::shared_ptr<Array>> dense_chunks;
+  for (const auto& batch : batches) {
+    const auto& dict_array =
+        checked_cast<const ::arrow::DictionaryArray&>(*batch->column(0));
+    auto dictionary = dict_array.dictionary();
+    if (previous) {
+      ASSERT_GE(dictionary->length(), previous->length());
+      ASSERT_TRUE(dictionary->Slice(0, previous->length())->Equals(*previous));
+    }
+    previous = dictionary;
+    ASSERT_OK_AND_ASSIGN(auto dense, ::arrow::compute::Cast(dict_array, ::arrow::utf8()));
+    dense_chunks.push_back(dense);
+  }
+  ASSERT_LE(previous->length(), options.num_uniques);
+  ASSERT_TRUE(ChunkedArray(dense_chunks).Equals(*expected_dense_->column(0)));
+}
+
 TEST_P(TestArrowReadDictionary, ZeroChunksListOfDictionary) {
   // ARROW-8799
   properties_.set_read_dictionary(0, true);
@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -118,6 +120,13 @@ class ColumnReaderImpl : public ColumnReader {
   virtual ::arrow::Status BuildArray(int64_t length_upper_bound,
                                      std::shared_ptr<::arrow::ChunkedArray>* out) = 0;
   virtual bool IsOrHasRepeatedChild() const = 0;
+
+  virtual bool CanSkipRecords() const { return false; }
+
+  // Skip the next num_records records, if CanSkipRecords()
+  virtual ::arrow::Status SkipRecords(int64_t num_records) {
+    return Status::NotImplemented("Skipping records of ", field()->ToString());
+  }
 };
 
 namespace {
@@ -142,7 +151,11 @@ class FileReaderImpl : public FileReader {
                  ArrowReaderProperties properties)
       : pool_(pool),
         reader_(std::move(reader)),
-        reader_properties_(std::move(properties)) {}
+        reader_properties_(std::move(properties)) {
+    if (reader_properties_.unify_dictionaries()) {
+      unified_dictionaries_ = std::make_shared<UnifiedDictionaries>(pool_);
+    }
+  }
 
   Status Init() {
     return SchemaManifest::Make(reader_->metadata()->schema(),
@@ -208,6 +221,10 @@ class FileReaderImpl : public FileReader {
     ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
+    ctx->column_chunk_split_size = reader_properties_.use_threads()
+                                        ? reader_properties_.column_chunk_split_size()
+                                        : 0;
+    ctx->unified_dictionaries = unified_dictionaries_;
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
@@ -293,6 +310,11 @@ class FileReaderImpl : public FileReader {
                        const std::vector<int>& indices,
                        std::shared_ptr<Table>* table) override;
 
+  Future<std::shared_ptr<Table>> ReadRowRanges(
+      int i, const std::vector<int>& column_indices,
+      const std::vector<RowRange>& row_ranges,
+      ::arrow::internal::Executor* cpu_executor) override;
+
   // Helper method used by ReadRowGroups - read the given row groups/columns, skipping
   // bounds checks and pre-buffering. Takes a shared_ptr to self to keep the reader
   // alive in async contexts.
@@ -361,6 +383,9 @@ class FileReaderImpl : public FileReader {
   ArrowReaderProperties reader_properties_;
 
   SchemaManifest manifest_;
+  // Kept across calls, so that the readers made for each row group (e.g. by
+  // GetRecordBatchGenerator) share the dictionary of each column
+  std::shared_ptr<UnifiedDictionaries> unified_dictionaries_;
 };
 
 class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
@@ -433,10 +458,13 @@ class LeafReader : public ColumnReaderImpl {
       : ctx_(std::move(ctx)),
         field_(std::move(field)),
         input_(std::move(input)),
-        descr_(input_->descr()) {
-    record_reader_ = RecordReader::Make(
-        descr_, leaf_info, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY);
-    NextRowGroup();
+        descr_(input_->descr()),
+        leaf_info_(leaf_info) {
+    // No parent reader needs the levels of top-level columns without repetition, so
+    // their records can be decoded by other record readers or skipped
+    flat_top_level_ = descr_->max_repetition_level() == 0 &&
+                      descr_->schema_node()->parent() == input_->schema()->group_node();
+    record_reader_ = MakeRecordReader();
   }
 
   Status GetDefLevels(const int16_t** data, int64_t* length) final {
@@ -457,20 +485,46 @@ class LeafReader : public ColumnReaderImpl {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     out_ = nullptr;
     record_reader_->Reset();
-    // Pre-allocation gives much better performance for flat columns
-    record_reader_->Reserve(records_to_read);
+    std::vector<std::shared_ptr<Array>> chunks;
+    int64_t pending_records = 0;
+    bool reserved = false;
     while (records_to_read > 0) {
       if (!record_reader_->HasMoreData()) {
-        break;
+        const int row_group = input_->next_row_group();
+        if (row_group < 0) {
+          break;
+        }
+        const int num_splits = NumSplits(row_group);
+        if (num_splits > 1 &&
+            records_to_read >= input_->metadata()->RowGroup(row_group)->num_rows()) {
+          // Decode the whole column chunk in parallel, after the records before it
+          RETURN_NOT_OK(TransferRecords(&pending_records, &chunks));
+          int64_t records_read = 0;
+          RETURN_NOT_OK(ReadSplitChunk(num_splits, &records_read, &chunks));
+          records_to_read -= records_read;
+          continue;
+        }
+        record_reader_->SetPageReader(input_->NextChunk());
+      }
+      if (!reserved) {
+        // Pre-allocation gives much better performance for flat columns
+        record_reader_->Reserve(records_to_read);
+        reserved = true;
       }
       int64_t records_read = record_reader_->ReadRecords(records_to_read);
       records_to_read -= records_read;
+      pending_records += records_read;
       if (records_read == 0) {
-        NextRowGroup();
+        // The row group is exhausted
+        record_reader_->SetPageReader(nullptr);
       }
     }
-    RETURN_NOT_OK(TransferColumnData(record_reader_.get(), field_->type(), descr_,
-                                     ctx_->pool, &out_));
+    if (chunks.empty()) {
+      return TransferColumnData(record_reader_.get(), field_->type(), descr_,
+                                ctx_->pool, &out_);
+    }
+    RETURN_NOT_OK(TransferRecords(&pending_records, &chunks));
+    out_ = std::make_shared<ChunkedArray>(std::move(chunks), field_->type());
     return Status::OK();
     END_PARQUET_CATCH_EXCEPTIONS
   }
@@ -481,20 +535,123 @@ class LeafReader : public ColumnReaderImpl {
     return Status::OK();
   }
 
+  bool CanSkipRecords() const final { return flat_top_level_; }
+
+  Status SkipRecords(int64_t num_records) final {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    while (num_records > 0) {
+      if (!record_reader_->HasMoreData()) {
+        if (input_->next_row_group() < 0) {
+          break;
+        }
+        record_reader_->SetPageReader(input_->NextChunk());
+      }
+      const int64_t records_skipped = record_reader_->SkipRecords(num_records);
+      num_records -= records_skipped;
+      if (records_skipped == 0) {
+        // The row group is exhausted
+        record_reader_->SetPageReader(nullptr);
+      }
+    }
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   const std::shared_ptr<Field> field() override { return field_; }
 
  private:
   std::shared_ptr<ChunkedArray> out_;
-  void NextRowGroup() {
-    std::unique_ptr<PageReader> page_reader = input_->NextChunk();
-    record_reader_->SetPageReader(std::move(page_reader));
+
+  bool read_dictionary() const {
+    return field_->type()->id() == ::arrow::Type::DICTIONARY;
+  }
+
+  std::shared_ptr<RecordReader> MakeRecordReader() const {
+    std::shared_ptr<::parquet::internal::UnifiedDictionary> unified_dictionary;
+    if (read_dictionary() && ctx_->unified_dictionaries) {
+      unified_dictionary = ctx_->unified_dictionaries->Get(input_->column_index());
+    }
+    auto reader = RecordReader::Make(descr_, leaf_info_, ctx_->pool, read_dictionary(),
+                                     std::move(unified_dictionary));
+    reader->set_read_levels(!flat_top_level_);
+    return reader;
+  }
+
+  // The number of runs of pages to decode the column chunk of the row group in
+  // parallel as, or 1 if it is not worth splitting
+  int NumSplits(int row_group) const {
+    if (!flat_top_level_ || ctx_->column_chunk_split_size <= 0) {
+      return 1;
+    }
+    if (read_dictionary() && ctx_->unified_dictionaries) {
+      // The record readers would snapshot the dictionary at different sizes
+      return 1;
+    }
+    const int64_t size = input_->metadata()
+                             ->RowGroup(row_group)
+                             ->ColumnChunk(input_->column_index())
+                             ->total_uncompressed_size();
+    return static_cast<int>(
+        std::min<int64_t>(size / ctx_->column_chunk_split_size,
+                          ::arrow::GetCpuThreadPoolCapacity()));
+  }
+
+  // Move the records read by record_reader_ into chunks
+  Status TransferRecords(int64_t* pending_records,
+                         std::vector<std::shared_ptr<Array>>* chunks) {
+    if (*pending_records == 0) {
+      return Status::OK();
+    }
+    std::shared_ptr<ChunkedArray> out;
+    RETURN_NOT_OK(TransferColumnData(record_reader_.get(), field_->type(), descr_,
+                                     ctx_->pool, &out));
+    chunks->insert(chunks->end(), out->chunks().begin(), out->chunks().end());
+    record_reader_->Reset();
+    *pending_records = 0;
+    return Status::OK();
+  }
+
+  // Decode the next column chunk as runs of pages in parallel, appending the
+  // values of each run to chunks
+  Status ReadSplitChunk(int num_splits, int64_t* records_read,
+                        std::vector<std::shared_ptr<Array>>* chunks) {
+    std::vector<int64_t> num_values;
+    auto page_readers = input_->NextChunkSplit(num_splits, &num_values);
+    std::vector<std::shared_ptr<ChunkedArray>> runs(page_readers.size());
+    RETURN_NOT_OK(::arrow::internal::ParallelForWithCaller(
+        static_cast<int>(page_readers.size()), [&](int i) -> Status {
+          BEGIN_PARQUET_CATCH_EXCEPTIONS
+          auto reader = MakeRecordReader();
+          reader->SetPageReader(std::move(page_readers[i]));
+          reader->Reserve(num_values[i]);
+          // Values and records match for columns without repetition
+          int64_t remaining = num_values[i];
+          while (remaining > 0) {
+            const int64_t read = reader->ReadRecords(remaining);
+            if (read == 0) {
+              break;
+            }
+            remaining -= read;
+          }
+          return TransferColumnData(reader.get(), field_->type(), descr_, ctx_->pool,
+                                    &runs[i]);
+          END_PARQUET_CATCH_EXCEPTIONS
+        }));
+    *records_read = 0;
+    for (const auto& run : runs) {
+      *records_read += run->length();
+      chunks->insert(chunks->end(), run->chunks().begin(), run->chunks().end());
+    }
+    return Status::OK();
   }
 
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
+  ::parquet::internal::LevelInfo leaf_info_;
   std::shared_ptr<RecordReader> record_reader_;
+  bool flat_top_level_;
 };
 
 // Column reader for extension arrays
@@ -516,6 +673,12 @@ class ExtensionReader : public ColumnReaderImpl {
     return storage_reader_->LoadBatch(number_of_records);
   }
 
+  bool CanSkipRecords() const final { return storage_reader_->CanSkipRecords(); }
+
+  Status SkipRecords(int64_t num_records) final {
+    return storage_reader_->SkipRecords(num_records);
+  }
+
   Status BuildArray(int64_t length_upper_bound,
                     std::shared_ptr<ChunkedArray>* out) override {
     std::shared_ptr<ChunkedArray> storage;
@@ -982,6 +1145,139 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
   return Status::OK();
 }
 
+/// Streams the batches of a single row group, decoding batch_size records of each
+/// column per call, so that only the pages spanned by the current batch are held in
+/// memory rather than the whole decoded row group.
+///
+/// This generator is not async-reentrant.
+class RowGroupBatchGenerator {
+ public:
+  RowGroupBatchGenerator(std::vector<std::shared_ptr<ColumnReaderImpl>> readers,
+                         std::shared_ptr<::arrow::Schema> schema, int64_t num_rows,
+                         int64_t batch_size, bool use_threads,
+                         ::arrow::internal::Executor* cpu_executor)
+      : state_(std::make_shared<State>()) {
+    state_->readers = std::move(readers);
+    state_->schema = std::move(schema);
+    state_->rows_remaining = num_rows;
+    state_->batch_size = batch_size;
+    state_->use_threads = use_threads;
+    state_->cpu_executor = cpu_executor;
+  }
+
+  Future<std::shared_ptr<::arrow::RecordBatch>> operator()() {
+    if (!state_->pending.empty()) {
+      auto batch = std::move(state_->pending.front());
+      state_->pending.pop_front();
+      return Future<std::shared_ptr<::arrow::RecordBatch>>::MakeFinished(
+          std::move(batch));
+    }
+    if (state_->rows_remaining == 0) {
+      return ::arrow::AsyncGeneratorEnd<std::shared_ptr<::arrow::RecordBatch>>();
+    }
+    const int64_t batch_size = std::min(state_->batch_size, state_->rows_remaining);
+    state_->rows_remaining -= batch_size;
+    auto state = state_;
+    if (!state->cpu_executor) {
+      return ReadNext(state, batch_size);
+    }
+    return ::arrow::DeferNotOk(
+        state->cpu_executor->Submit(ReadNext, std::move(state), batch_size));
+  }
+
+ private:
+  struct State {
+    std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+    std::shared_ptr<::arrow::Schema> schema;
+    int64_t rows_remaining;
+    int64_t batch_size;
+    bool use_threads;
+    ::arrow::internal::Executor* cpu_executor;
+    // Batches left over when a column came back in several chunks
+    std::deque<std::shared_ptr<::arrow::RecordBatch>> pending;
+  };
+
+  static Future<std::shared_ptr<::arrow::RecordBatch>> ReadNext(
+      const std::shared_ptr<State>& state, int64_t batch_size) {
+    auto read_column = [batch_size](size_t i, std::shared_ptr<ColumnReaderImpl> reader)
+        -> ::arrow::Result<std::shared_ptr<ChunkedArray>> {
+      std::shared_ptr<ChunkedArray> column;
+      RETURN_NOT_OK(reader->NextBatch(batch_size, &column));
+      return column;
+    };
+    auto make_batches = [state, batch_size](const ::arrow::ChunkedArrayVector& columns)
+        -> ::arrow::Result<std::shared_ptr<::arrow::RecordBatch>> {
+      for (const auto& column : columns) {
+        if (column == nullptr || column->length() != batch_size) {
+          return Status::IOError("Expected ", batch_size, " rows but the column had ",
+                                 column == nullptr ? 0 : column->length());
+        }
+      }
+      auto table = Table::Make(state->schema, columns, batch_size);
+      ::arrow::TableBatchReader table_reader(*table);
+      ::arrow::RecordBatchVector batches;
+      RETURN_NOT_OK(table_reader.ReadAll(&batches));
+      state->pending.insert(state->pending.end(), batches.begin() + 1, batches.end());
+      return batches.front();
+    };
+    auto cpu_executor = state->cpu_executor ? state->cpu_executor
+                                            : ::arrow::internal::GetCpuThreadPool();
+    return ::arrow::internal::OptionalParallelForAsync(state->use_threads, state->readers,
+                                                       read_column, cpu_executor)
+        .Then(std::move(make_batches));
+  }
+
+  std::shared_ptr<State> state_;
+};
+
+// Replaces the unified dictionaries of batches by the longest snapshot yielded so far,
+// so that the dictionary of each batch starts with the values of the previous one's
+// even if row groups are decoded concurrently and snapshot them out of order.
+class UnifiedDictionaryGrower {
+ public:
+  ::arrow::Result<std::shared_ptr<::arrow::RecordBatch>> operator()(
+      const std::shared_ptr<::arrow::RecordBatch>& batch) const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    size_t position = 0;
+    std::vector<std::shared_ptr<ArrayData>> columns;
+    for (const auto& column : batch->column_data()) {
+      columns.push_back(Grow(column, &position));
+    }
+    return ::arrow::RecordBatch::Make(batch->schema(), batch->num_rows(),
+                                      std::move(columns));
+  }
+
+ private:
+  std::shared_ptr<ArrayData> Grow(const std::shared_ptr<ArrayData>& data,
+                                  size_t* position) const {
+    auto out = std::make_shared<ArrayData>(*data);
+    if (out->type->id() == ::arrow::Type::DICTIONARY) {
+      // Snapshots of a unified dictionary are prefixes of each other
+      if (state_->dictionaries.size() <= *position) {
+        state_->dictionaries.resize(*position + 1);
+      }
+      auto& longest = state_->dictionaries[(*position)++];
+      if (longest && longest->length > out->dictionary->length) {
+        out->dictionary = longest;
+      } else {
+        longest = out->dictionary;
+      }
+    }
+    for (auto& child : out->child_data) {
+      child = Grow(child, position);
+    }
+    return out;
+  }
+
+  struct State {
+    std::mutex mutex;
+    // The longest dictionary yielded for each dictionary array of the batches, in
+    // depth-first order
+    std::vector<std::shared_ptr<ArrayData>> dictionaries;
+  };
+  std::shared_ptr<State> state_ = std::make_shared<State>();
+};
+
 /// Given a file reader and a list of row groups, this is a generator of record
 /// batch generators (where each sub-generator is the contents of a single row group).
 class RowGroupGenerator {
@@ -1036,14 +1332,26 @@ class RowGroupGenerator {
       ::arrow::internal::Executor* cpu_executor, std::shared_ptr<FileReaderImpl> self,
       const int row_group, const std::vector<int>& column_indices) {
     // Skips bound checks/pre-buffering, since we've done that already
-    return self->DecodeRowGroups(self, {row_group}, column_indices, cpu_executor)
-        .Then([](const std::shared_ptr<Table>& table)
-                  -> ::arrow::Result<RecordBatchGenerator> {
-          ::arrow::TableBatchReader table_reader(*table);
-          ::arrow::RecordBatchVector batches;
-          RETURN_NOT_OK(table_reader.ReadAll(&batches));
-          return ::arrow::MakeVectorGenerator(std::move(batches));
-        });
+    std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+    std::shared_ptr<::arrow::Schema> batch_schema;
+    RETURN_NOT_OK(
+        self->GetFieldReaders(column_indices, {row_group}, &readers, &batch_schema));
+    const int64_t num_rows =
+        self->parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    const int64_t batch_size = self->properties().batch_size();
+    if (readers.empty()) {
+      // There is nothing to decode, so slice the batches right away
+      auto max_sized_batch =
+          ::arrow::RecordBatch::Make(batch_schema, batch_size, ::arrow::ArrayVector{});
+      ::arrow::RecordBatchVector batches(num_rows / batch_size, max_sized_batch);
+      if (int64_t trailing_rows = num_rows % batch_size) {
+        batches.push_back(max_sized_batch->Slice(0, trailing_rows));
+      }
+      return ::arrow::MakeVectorGenerator(std::move(batches));
+    }
+    return RecordBatchGenerator(RowGroupBatchGenerator(
+        std::move(readers), std::move(batch_schema), num_rows, batch_size,
+        self->properties().use_threads(), cpu_executor));
   }
 
   std::shared_ptr<FileReaderImpl> arrow_reader_;
@@ -1068,7 +1376,13 @@ FileReaderImpl::GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
   ::arrow::AsyncGenerator<RowGroupGenerator::RecordBatchGenerator> row_group_generator =
       RowGroupGenerator(::arrow::internal::checked_pointer_cast<FileReaderImpl>(reader),
                         cpu_executor, row_group_indices, column_indices);
-  return ::arrow::MakeConcatenatedGenerator(std::move(row_group_generator));
+  ::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>> batch_generator =
+      ::arrow::MakeConcatenatedGenerator(std::move(row_group_generator));
+  if (unified_dictionaries_) {
+    return ::arrow::MakeMappedGenerator(std::move(batch_generator),
+                                        UnifiedDictionaryGrower());
+  }
+  return batch_generator;
 }
 
 Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_factory,
@@ -1079,6 +1393,10 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
   ctx->pool = pool_;
   ctx->iterator_factory = iterator_factory;
   ctx->filter_leaves = false;
+  ctx->column_chunk_split_size = reader_properties_.use_threads()
+                                      ? reader_properties_.column_chunk_split_size()
+                                      : 0;
+  ctx->unified_dictionaries = unified_dictionaries_;
   std::unique_ptr<ColumnReaderImpl> result;
   RETURN_NOT_OK(GetReader(manifest_.schema_fields[i], ctx, &result));
   out->reset(result.release());
@@ -1105,6 +1423,77 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   return Status::OK();
 }
 
+// Read the given ranges of rows of the row group, of num_rows rows, which the
+// column reader is positioned at the start of
+::arrow::Result<std::shared_ptr<ChunkedArray>> ReadColumnRanges(
+    ColumnReaderImpl* reader, int64_t num_rows, const std::vector<RowRange>& row_ranges) {
+  ::arrow::ArrayVector chunks;
+  if (!reader->CanSkipRecords()) {
+    std::shared_ptr<ChunkedArray> column;
+    RETURN_NOT_OK(reader->NextBatch(num_rows, &column));
+    for (const RowRange& range : row_ranges) {
+      auto slice = column->Slice(range.offset, range.length);
+      chunks.insert(chunks.end(), slice->chunks().begin(), slice->chunks().end());
+    }
+  } else {
+    int64_t position = 0;
+    for (const RowRange& range : row_ranges) {
+      if (range.length == 0) {
+        continue;
+      }
+      RETURN_NOT_OK(reader->SkipRecords(range.offset - position));
+      std::shared_ptr<ChunkedArray> column;
+      RETURN_NOT_OK(reader->NextBatch(range.length, &column));
+      chunks.insert(chunks.end(), column->chunks().begin(), column->chunks().end());
+      position = range.offset + range.length;
+    }
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks), reader->field()->type());
+}
+
+Future<std::shared_ptr<Table>> FileReaderImpl::ReadRowRanges(
+    int i, const std::vector<int>& column_indices,
+    const std::vector<RowRange>& row_ranges, ::arrow::internal::Executor* cpu_executor) {
+  RETURN_NOT_OK(BoundsCheck({i}, column_indices));
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  const int64_t row_group_rows = reader_->metadata()->RowGroup(i)->num_rows();
+  int64_t num_rows = 0;
+  int64_t end = 0;
+  for (const RowRange& range : row_ranges) {
+    if (range.offset < end || range.length < 0 ||
+        range.offset + range.length > row_group_rows) {
+      return Status::Invalid("Row ranges must be sorted, disjoint and within the ",
+                             row_group_rows, " rows of row group ", i);
+    }
+    end = range.offset + range.length;
+    num_rows += range.length;
+  }
+
+  std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+  std::shared_ptr<::arrow::Schema> result_schema;
+  RETURN_NOT_OK(GetFieldReaders(column_indices, {i}, &readers, &result_schema));
+  // OptionalParallelForAsync requires an executor
+  if (!cpu_executor) cpu_executor = ::arrow::internal::GetCpuThreadPool();
+
+  auto read_column = [row_group_rows, row_ranges](
+                         size_t, std::shared_ptr<ColumnReaderImpl> reader)
+      -> ::arrow::Result<std::shared_ptr<ChunkedArray>> {
+    return ReadColumnRanges(reader.get(), row_group_rows, row_ranges);
+  };
+  auto make_table = [result_schema, num_rows](const ::arrow::ChunkedArrayVector& columns)
+      -> ::arrow::Result<std::shared_ptr<Table>> {
+    auto table = Table::Make(result_schema, columns, num_rows);
+    RETURN_NOT_OK(table->Validate());
+    return table;
+  };
+  return ::arrow::internal::OptionalParallelForAsync(reader_properties_.use_threads(),
+                                                     std::move(readers), read_column,
+                                                     cpu_executor)
+      .Then(std::move(make_table));
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
 Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
     std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
     const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor) {
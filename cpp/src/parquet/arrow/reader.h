@@ -51,6 +51,14 @@ class ColumnReader;
 struct SchemaManifest;
 class RowGroupReader;
 
+/// \brief A range of consecutive rows of a row group
+struct RowRange {
+  /// The first row of the range, relative to the start of the row group
+  int64_t offset;
+  /// The number of rows in the range
+  int64_t length;
+};
+
 /// \brief Arrow read adapter class for deserializing Parquet files as Arrow row batches.
 ///
 /// This interfaces caters for different use cases and thus provides different
@@ -182,6 +190,11 @@ class PARQUET_EXPORT FileReader {
 
   /// \brief Return a generator of record batches.
   ///
+  /// Row groups are decoded incrementally: each batch holds up to batch_size rows
+  /// (see ArrowReaderProperties) and is yielded as soon as the pages it spans have
+  /// been decoded, so at most a few pages per column are held in memory at a time
+  /// rather than the whole decoded row group.
+  ///
   /// The FileReader must outlive the generator, so this requires that you pass in a
   /// shared_ptr.
   ///
@@ -219,6 +232,22 @@ class PARQUET_EXPORT FileReader {
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read the given ranges of rows of a row group into a Table
+  ///
+  /// The ranges must be sorted and disjoint. The values of top-level columns
+  /// without repetition are decoded range by range, and their data pages which hold
+  /// no row of the ranges are neither decompressed nor decoded. Other columns are
+  /// read whole and sliced. Unlike ReadRowGroup, this does not pre-buffer the row
+  /// group.
+  ///
+  /// If use_threads is set, columns are decoded by tasks of cpu_executor (the CPU
+  /// thread pool by default), so that this can be called from such a task without
+  /// blocking it. The FileReader must outlive the returned future.
+  virtual ::arrow::Future<std::shared_ptr<::arrow::Table>> ReadRowRanges(
+      int i, const std::vector<int>& column_indices,
+      const std::vector<RowRange>& row_ranges,
+      ::arrow::internal::Executor* cpu_executor = NULLPTR) = 0;
+
   /// \brief Scan file contents with one thread, return number of rows
   virtual ::arrow::Status ScanContents(std::vector<int> columns,
                                        const int32_t column_batch_size,
@@ -22,6 +22,8 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -80,6 +82,23 @@ class FileColumnIterator {
     return row_group_reader->GetColumnPageReader(column_index_);
   }
 
+  // Like NextChunk(), but split the column chunk into runs of pages which can be
+  // decoded concurrently, see RowGroupReader::GetColumnPageReaders()
+  std::vector<std::unique_ptr<::parquet::PageReader>> NextChunkSplit(
+      int max_readers, std::vector<int64_t>* num_values) {
+    if (row_groups_.empty()) {
+      return {};
+    }
+
+    auto row_group_reader = reader_->RowGroup(row_groups_.front());
+    row_groups_.pop_front();
+    return row_group_reader->GetColumnPageReaders(column_index_, max_readers,
+                                                  num_values);
+  }
+
+  // The row group which the next chunk belongs to, or -1 if there is none left
+  int next_row_group() const { return row_groups_.empty() ? -1 : row_groups_.front(); }
+
   const SchemaDescriptor* schema() const { return schema_; }
 
   const ColumnDescriptor* descr() const { return schema_->Column(column_index_); }
@@ -103,12 +122,39 @@ Status TransferColumnData(::parquet::internal::RecordReader* reader,
                           const ColumnDescriptor* descr, ::arrow::MemoryPool* pool,
                           std::shared_ptr<::arrow::ChunkedArray>* out);
 
+// The unified dictionaries of the leaf columns of a file, shared by the readers of
+// all of its row groups
+class UnifiedDictionaries {
+ public:
+  explicit UnifiedDictionaries(::arrow::MemoryPool* pool) : pool_(pool) {}
+
+  std::shared_ptr<::parquet::internal::UnifiedDictionary> Get(int column_index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& dictionary = dictionaries_[column_index];
+    if (!dictionary) {
+      dictionary = std::make_shared<::parquet::internal::UnifiedDictionary>(pool_);
+    }
+    return dictionary;
+  }
+
+ private:
+  ::arrow::MemoryPool* pool_;
+  std::mutex mutex_;
+  std::unordered_map<int, std::shared_ptr<::parquet::internal::UnifiedDictionary>>
+      dictionaries_;
+};
+
 struct ReaderContext {
   ParquetFileReader* reader;
   ::arrow::MemoryPool* pool;
   FileColumnIteratorFactory iterator_factory;
   bool filter_leaves;
   std::shared_ptr<std::unordered_set<int>> included_leaves;
+  // Uncompressed size of the column chunk share decoded by a thread, zero if
+  // column chunks are decoded by a single thread
+  int64_t column_chunk_split_size = 0;
+  // If set, dictionary-encoded columns index one dictionary across column chunks
+  std::shared_ptr<UnifiedDictionaries> unified_dictionaries;
 
   bool IncludesLeaf(int leaf_index) const {
     if (this->filter_leaves) {
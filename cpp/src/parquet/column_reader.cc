@@ -23,6 +23,7 @@
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -32,12 +33,16 @@
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_dict.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/dict_internal.h"
 #include "arrow/chunked_array.h"
+#include "arrow/io/memory.h"
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
@@ -175,6 +180,31 @@ int LevelDecoder::Decode(int batch_size, int16_t* levels) {
   return num_decoded;
 }
 
+int LevelDecoder::DecodeValidity(int batch_size, uint8_t* valid_bits,
+                                 int64_t valid_bits_offset, int64_t* null_count) {
+  DCHECK_EQ(max_level_, 1);
+  int num_decoded = 0;
+  int64_t num_set = 0;
+
+  int num_values = std::min(num_values_remaining_, batch_size);
+  if (encoding_ == Encoding::RLE) {
+    num_decoded =
+        rle_decoder_->GetBitmap(num_values, valid_bits, valid_bits_offset, &num_set);
+  } else {
+    num_decoded =
+        bit_packed_decoder_->GetBitmap(num_values, valid_bits, valid_bits_offset);
+    num_set =
+        ::arrow::internal::CountSetBits(valid_bits, valid_bits_offset, num_decoded);
+  }
+  // Bit-packed levels always fit, but a run of levels other than 0 or 1 stops decoding
+  if (ARROW_PREDICT_FALSE(num_decoded != num_values)) {
+    throw ParquetException("Malformed levels (corrupt data page?)");
+  }
+  *null_count = num_decoded - num_set;
+  num_values_remaining_ -= num_decoded;
+  return num_decoded;
+}
+
 ReaderProperties default_reader_properties() {
   static ReaderProperties default_reader_properties;
   return default_reader_properties;
@@ -236,7 +266,14 @@ class SerializedPageReader : public PageReader {
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  void set_data_page_filter(DataPageFilter data_page_filter) override {
+    data_page_filter_ = std::move(data_page_filter);
+  }
+
  private:
+  // Whether data_page_filter_ skips the current page, which is then accounted for
+  bool ShouldSkipPage(PageType::type page_type);
+
   void UpdateDecryption(const std::shared_ptr<Decryptor>& decryptor, int8_t module_type,
                         const std::string& page_aad);
 
@@ -270,6 +307,8 @@ class SerializedPageReader : public PageReader {
   // Maximum allowed page size
   uint32_t max_page_header_size_;
 
+  DataPageFilter data_page_filter_;
+
   // Number of rows read in data pages so far
   int64_t seen_num_rows_;
 
@@ -364,6 +403,13 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       throw ParquetException("Invalid page header");
     }
 
+    const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
+
+    if (data_page_filter_ && ShouldSkipPage(page_type)) {
+      PARQUET_THROW_NOT_OK(stream_->Advance(compressed_len));
+      continue;
+    }
+
     if (crypto_ctx_.data_decryptor != nullptr) {
       UpdateDecryption(crypto_ctx_.data_decryptor, encryption::kDictionaryPage,
                        data_page_aad_);
@@ -388,8 +434,6 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       page_buffer = decryption_buffer_;
     }
 
-    const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
-
     if (page_type == PageType::DICTIONARY_PAGE) {
       crypto_ctx_.start_decrypt_with_dictionary_page = false;
       const format::DictionaryPageHeader& dict_header =
@@ -468,6 +512,29 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
   return std::shared_ptr<Page>(nullptr);
 }
 
+bool SerializedPageReader::ShouldSkipPage(PageType::type page_type) {
+  int32_t num_values;
+  EncodedStatistics page_statistics;
+  if (page_type == PageType::DATA_PAGE) {
+    num_values = current_page_header_.data_page_header.num_values;
+    page_statistics = ExtractStatsFromHeader(current_page_header_.data_page_header);
+  } else if (page_type == PageType::DATA_PAGE_V2) {
+    num_values = current_page_header_.data_page_header_v2.num_values;
+    page_statistics = ExtractStatsFromHeader(current_page_header_.data_page_header_v2);
+  } else {
+    return false;
+  }
+  if (num_values < 0) {
+    throw ParquetException("Invalid page header (negative number of values)");
+  }
+  if (!data_page_filter_(DataPageStats(&page_statistics, num_values))) {
+    return false;
+  }
+  ++page_ordinal_;
+  seen_num_rows_ += num_values;
+  return true;
+}
+
 std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
     std::shared_ptr<Buffer> page_buffer, int compressed_len, int uncompressed_len,
     int levels_byte_len) {
@@ -498,6 +565,40 @@ std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
   return decompression_buffer_;
 }
 
+// Yields the pages of several page readers one after the other
+class ConcatenatedPageReader : public PageReader {
+ public:
+  explicit ConcatenatedPageReader(std::vector<std::unique_ptr<PageReader>> readers)
+      : readers_(std::move(readers)), current_(0) {}
+
+  std::shared_ptr<Page> NextPage() override {
+    while (current_ < readers_.size()) {
+      auto page = readers_[current_]->NextPage();
+      if (page != nullptr) {
+        return page;
+      }
+      ++current_;
+    }
+    return nullptr;
+  }
+
+  void set_max_page_header_size(uint32_t size) override {
+    for (const auto& reader : readers_) {
+      reader->set_max_page_header_size(size);
+    }
+  }
+
+  void set_data_page_filter(DataPageFilter data_page_filter) override {
+    for (const auto& reader : readers_) {
+      reader->set_data_page_filter(data_page_filter);
+    }
+  }
+
+ private:
+  std::vector<std::unique_ptr<PageReader>> readers_;
+  size_t current_;
+};
+
 }  // namespace
 
 std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> stream,
@@ -509,6 +610,101 @@ std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> s
       new SerializedPageReader(std::move(stream), total_num_rows, codec, pool, ctx));
 }
 
+std::vector<std::unique_ptr<PageReader>> PageReader::OpenSplit(
+    std::shared_ptr<Buffer> column_chunk, int64_t total_num_rows,
+    Compression::type codec, int max_readers, std::vector<int64_t>* num_values,
+    ::arrow::MemoryPool* pool) {
+  struct PageRange {
+    int64_t offset;
+    int64_t length;
+    int64_t num_values;
+  };
+
+  // Locate the pages from their headers
+  const uint8_t* data = column_chunk->data();
+  const int64_t size = column_chunk->size();
+  PageRange dictionary_page = {0, 0, 0};
+  std::vector<PageRange> data_pages;
+  int64_t offset = 0;
+  int64_t seen_num_rows = 0;
+  while (seen_num_rows < total_num_rows && offset < size) {
+    format::PageHeader header;
+    auto header_size = static_cast<uint32_t>(
+        std::min<int64_t>(size - offset, kDefaultMaxPageHeaderSize));
+    DeserializeThriftMsg(data + offset, &header_size, &header);
+    if (header.compressed_page_size < 0 || header.uncompressed_page_size < 0) {
+      throw ParquetException("Invalid page header");
+    }
+    const int64_t length = header_size + header.compressed_page_size;
+    if (offset + length > size) {
+      ParquetException::EofException("Column chunk was smaller than its pages");
+    }
+
+    int64_t page_num_values = 0;
+    switch (LoadEnumSafe(&header.type)) {
+      case PageType::DICTIONARY_PAGE:
+        dictionary_page = {offset, length, 0};
+        offset += length;
+        continue;
+      case PageType::DATA_PAGE:
+        page_num_values = header.data_page_header.num_values;
+        break;
+      case PageType::DATA_PAGE_V2:
+        page_num_values = header.data_page_header_v2.num_values;
+        break;
+      default:
+        // Skipped by SerializedPageReader, keep it with the preceding pages
+        break;
+    }
+    if (page_num_values < 0) {
+      throw ParquetException("Invalid page header (negative number of values)");
+    }
+    data_pages.push_back({offset, length, page_num_values});
+    seen_num_rows += page_num_values;
+    offset += length;
+  }
+
+  // Group the data pages into runs of similar numbers of values
+  std::vector<PageRange> runs;
+  const int64_t run_num_values =
+      std::max<int64_t>(1, (seen_num_rows + max_readers - 1) / std::max(max_readers, 1));
+  for (const PageRange& page : data_pages) {
+    if (runs.empty() || runs.back().num_values >= run_num_values) {
+      runs.push_back({page.offset, 0, 0});
+    }
+    runs.back().length = page.offset + page.length - runs.back().offset;
+    runs.back().num_values += page.num_values;
+  }
+
+  auto OpenRange = [&](const PageRange& range, int64_t range_num_rows) {
+    return PageReader::Open(std::make_shared<::arrow::io::BufferReader>(
+                                SliceBuffer(column_chunk, range.offset, range.length)),
+                            range_num_rows, codec, pool);
+  };
+
+  std::vector<std::unique_ptr<PageReader>> readers;
+  num_values->clear();
+  if (runs.empty()) {
+    readers.push_back(OpenRange({0, size, 0}, total_num_rows));
+    num_values->push_back(total_num_rows);
+    return readers;
+  }
+  for (const PageRange& run : runs) {
+    auto reader = OpenRange(run, run.num_values);
+    if (dictionary_page.length > 0) {
+      std::vector<std::unique_ptr<PageReader>> chained;
+      // The total number of rows only needs to be positive for the dictionary page
+      // to be read
+      chained.push_back(OpenRange(dictionary_page, /*range_num_rows=*/1));
+      chained.push_back(std::move(reader));
+      reader.reset(new ConcatenatedPageReader(std::move(chained)));
+    }
+    readers.push_back(std::move(reader));
+    num_values->push_back(run.num_values);
+  }
+  return readers;
+}
+
 namespace {
 
 // ----------------------------------------------------------------------
@@ -1231,6 +1427,17 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
         break;
       }
 
+      if (!read_levels_ && this->max_def_level_ == 1 && this->max_rep_level_ == 0) {
+        // Each level is a record, so the levels needn't be kept
+        const int64_t batch_size =
+            std::min(num_records - records_read, available_values_current_page());
+        if (batch_size == 0) {
+          break;
+        }
+        records_read += ReadValidityAndValues(batch_size);
+        continue;
+      }
+
       /// We perform multiple batch reads until we either exhaust the row group
       /// or observe the desired number of records
       int64_t batch_size = std::min(level_batch_size, available_values_current_page());
@@ -1448,6 +1655,66 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     at_record_start_ = true;
     this->pager_ = std::move(reader);
     ResetDecoders();
+    if (this->pager_ != nullptr && this->max_rep_level_ == 0) {
+      // Drop the pages of records being skipped before decompressing them
+      this->pager_->set_data_page_filter([this](const DataPageStats& page) {
+        if (page.num_values > records_to_skip_) {
+          return false;
+        }
+        records_to_skip_ -= page.num_values;
+        return true;
+      });
+    }
+  }
+
+  int64_t SkipRecords(int64_t num_records) override {
+    if (this->max_rep_level_ > 0) {
+      throw ParquetException("Cannot skip records of a column with repetition");
+    }
+    int64_t records_skipped = 0;
+
+    // Records whose levels were decoded ahead by ReadRecords
+    if (levels_position_ < levels_written_) {
+      const int64_t num_levels =
+          std::min(num_records, levels_written_ - levels_position_);
+      int16_t* def_levels = this->def_levels() + levels_position_;
+      SkipValues(std::count(def_levels, def_levels + num_levels, this->max_def_level_));
+      std::copy(def_levels + num_levels, this->def_levels() + levels_written_,
+                def_levels);
+      levels_written_ -= num_levels;
+      this->ConsumeBufferedValues(num_levels);
+      records_skipped += num_levels;
+    }
+
+    while (records_skipped < num_records) {
+      if (available_values_current_page() == 0) {
+        records_to_skip_ = num_records - records_skipped;
+        const bool has_next = this->HasNextInternal();
+        records_skipped = num_records - records_to_skip_;
+        records_to_skip_ = 0;
+        if (!has_next) {
+          break;
+        }
+        continue;
+      }
+      const int64_t batch_size = std::min(num_records - records_skipped,
+                                          available_values_current_page());
+      int64_t num_values = batch_size;
+      if (this->max_def_level_ > 0) {
+        // Decode the levels past the ones in use
+        ReserveLevels(batch_size);
+        int16_t* def_levels = this->def_levels() + levels_written_;
+        if (this->ReadDefinitionLevels(batch_size, def_levels) != batch_size) {
+          throw ParquetException("Page had fewer definition levels than values");
+        }
+        num_values =
+            std::count(def_levels, def_levels + batch_size, this->max_def_level_);
+      }
+      SkipValues(num_values);
+      this->ConsumeBufferedValues(batch_size);
+      records_skipped += batch_size;
+    }
+    return records_skipped;
   }
 
   bool HasMoreData() const override { return this->pager_ != nullptr; }
@@ -1471,6 +1738,21 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
+  // Decode the definition levels of a column without repetition and with a max
+  // definition level of 1 into the validity bitmap, then the values
+  int64_t ReadValidityAndValues(int64_t num_values) {
+    ReserveValues(num_values);
+    int64_t null_count = 0;
+    const int64_t values_read = this->definition_level_decoder_.DecodeValidity(
+        static_cast<int>(num_values), valid_bits_->mutable_data(), values_written_,
+        &null_count);
+    ReadValuesSpaced(values_read, null_count);
+    this->ConsumeBufferedValues(values_read);
+    values_written_ += values_read;
+    null_count_ += null_count;
+    return values_read;
+  }
+
   // Return number of logical records read
   int64_t ReadRecordData(int64_t num_records) {
     // Conservative upper bound
@@ -1571,7 +1853,27 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   T* ValuesHead() {
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
+
+  // Decode values of the current page into scratch space, as decoders cannot skip
+  void SkipValues(int64_t num_values) {
+    constexpr int64_t kSkipBatchSize = 1024;
+    if (skip_scratch_ == nullptr) {
+      skip_scratch_ = AllocateBuffer(this->pool_, kSkipBatchSize * sizeof(T));
+    }
+    T* scratch = reinterpret_cast<T*>(skip_scratch_->mutable_data());
+    while (num_values > 0) {
+      const int64_t batch_size = std::min(num_values, kSkipBatchSize);
+      if (this->ReadValues(batch_size, scratch) != batch_size) {
+        throw ParquetException("Page had fewer values than expected");
+      }
+      num_values -= batch_size;
+    }
+  }
+
   LevelInfo leaf_info_;
+  // The number of records the data page filter may still skip whole pages of
+  int64_t records_to_skip_ = 0;
+  std::shared_ptr<ResizableBuffer> skip_scratch_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1669,12 +1971,59 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
+}  // namespace
+
+struct UnifiedDictionary::Impl {
+  using MemoTable = ::arrow::internal::BinaryMemoTable<::arrow::BinaryBuilder>;
+
+  explicit Impl(::arrow::MemoryPool* pool) : pool(pool), memo_table(pool) {}
+
+  ::arrow::MemoryPool* pool;
+  std::mutex mutex;
+  MemoTable memo_table;
+  // The last snapshot of the memo table, if any
+  std::shared_ptr<::arrow::ArrayData> dictionary;
+};
+
+UnifiedDictionary::UnifiedDictionary(::arrow::MemoryPool* pool)
+    : impl_(new Impl(pool)) {}
+
+UnifiedDictionary::~UnifiedDictionary() = default;
+
+void UnifiedDictionary::Insert(const ::arrow::BinaryArray& values, int64_t start,
+                               std::vector<int32_t>* indices) {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  for (int64_t i = start; i < values.length(); ++i) {
+    const auto value = values.GetView(i);
+    int32_t index;
+    PARQUET_THROW_NOT_OK(impl_->memo_table.GetOrInsert(
+        value.data(), static_cast<int32_t>(value.size()), &index));
+    indices->push_back(index);
+  }
+}
+
+std::shared_ptr<::arrow::ArrayData> UnifiedDictionary::GetDictionary() {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  if (!impl_->dictionary || impl_->dictionary->length != impl_->memo_table.size()) {
+    using DictTraits = ::arrow::internal::DictionaryTraits<::arrow::BinaryType>;
+    PARQUET_THROW_NOT_OK(DictTraits::GetDictionaryArrayData(
+        impl_->pool, ::arrow::binary(), impl_->memo_table, /*start_offset=*/0,
+        &impl_->dictionary));
+  }
+  return impl_->dictionary;
+}
+
+namespace {
+
 class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
                                         virtual public DictionaryRecordReader {
  public:
   ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, leaf_info, pool), builder_(pool) {
+                                  ::arrow::MemoryPool* pool,
+                                  std::shared_ptr<UnifiedDictionary> unified_dictionary)
+      : TypedRecordReader<ByteArrayType>(descr, leaf_info, pool),
+        builder_(pool),
+        unified_dictionary_(std::move(unified_dictionary)) {
     this->read_dictionary_ = true;
   }
 
@@ -1682,6 +2031,15 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
     FlushBuilder();
     std::vector<std::shared_ptr<::arrow::Array>> result;
     std::swap(result, result_chunks_);
+    if (unified_dictionary_) {
+      // All the chunks share the current state of the unified dictionary
+      const auto dictionary = unified_dictionary_->GetDictionary();
+      for (auto& data : unified_chunks_) {
+        data->dictionary = dictionary;
+        result.push_back(::arrow::MakeArray(std::move(data)));
+      }
+      unified_chunks_.clear();
+    }
     return std::make_shared<::arrow::ChunkedArray>(std::move(result), builder_.type());
   }
 
@@ -1689,9 +2047,13 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
     if (builder_.length() > 0) {
       std::shared_ptr<::arrow::Array> chunk;
       PARQUET_THROW_NOT_OK(builder_.Finish(&chunk));
-      result_chunks_.emplace_back(std::move(chunk));
+      if (unified_dictionary_) {
+        unified_chunks_.push_back(TransposeToUnified(*chunk));
+      } else {
+        result_chunks_.emplace_back(std::move(chunk));
+      }
 
-      // Also clears the dictionary memo table
+      // Keeps the dictionary memo table
       builder_.Reset();
     }
   }
@@ -1702,6 +2064,7 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       /// insert the new dictionary values
       FlushBuilder();
       builder_.ResetFull();
+      transpose_map_.clear();
       auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
       decoder->InsertDictionary(&builder_);
       this->new_dictionary_ = false;
@@ -1746,8 +2109,44 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
  private:
   using BinaryDictDecoder = DictDecoder<ByteArrayType>;
 
+  // Rewrite the indices of a chunk built with the dictionary of the current
+  // column chunk as indices into the unified dictionary. The dictionary of the
+  // result is set by GetResult.
+  std::shared_ptr<::arrow::ArrayData> TransposeToUnified(const ::arrow::Array& chunk) {
+    const auto& dict_chunk = checked_cast<const ::arrow::DictionaryArray&>(chunk);
+    const auto& dictionary =
+        checked_cast<const ::arrow::BinaryArray&>(*dict_chunk.dictionary());
+    // The builder's dictionary only grows until the next dictionary page, so only
+    // the values added since the last flush need to be looked up
+    unified_dictionary_->Insert(dictionary, static_cast<int64_t>(transpose_map_.size()),
+                                &transpose_map_);
+
+    const int64_t length = chunk.length();
+    PARQUET_ASSIGN_OR_THROW(auto indices,
+                            ::arrow::AllocateBuffer(length * sizeof(int32_t), pool_));
+    const int32_t* in = chunk.data()->GetValues<int32_t>(1);
+    auto out = reinterpret_cast<int32_t*>(indices->mutable_data());
+    const auto num_entries = static_cast<uint32_t>(transpose_map_.size());
+    for (int64_t i = 0; i < length; ++i) {
+      // Null slots may hold any index
+      const auto index = static_cast<uint32_t>(in[i]);
+      out[i] = index < num_entries ? transpose_map_[index] : 0;
+    }
+    auto data = chunk.data()->Copy();
+    data->buffers[1] = std::move(indices);
+    data->offset = 0;
+    data->dictionary = nullptr;
+    return data;
+  }
+
   ::arrow::BinaryDictionary32Builder builder_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
+
+  // Only set when unifying the dictionaries of the column chunks read
+  std::shared_ptr<UnifiedDictionary> unified_dictionary_;
+  // The unified index of each entry of the builder's dictionary
+  std::vector<int32_t> transpose_map_;
+  std::vector<std::shared_ptr<::arrow::ArrayData>> unified_chunks_;
 };
 
 // TODO(wesm): Implement these to some satisfaction
@@ -1760,12 +2159,12 @@ void TypedRecordReader<ByteArrayType>::DebugPrintState() {}
 template <>
 void TypedRecordReader<FLBAType>::DebugPrintState() {}
 
-std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor* descr,
-                                                        LevelInfo leaf_info,
-                                                        ::arrow::MemoryPool* pool,
-                                                        bool read_dictionary) {
+std::shared_ptr<RecordReader> MakeByteArrayRecordReader(
+    const ColumnDescriptor* descr, LevelInfo leaf_info, ::arrow::MemoryPool* pool,
+    bool read_dictionary, std::shared_ptr<UnifiedDictionary> unified_dictionary) {
   if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, leaf_info, pool);
+    return std::make_shared<ByteArrayDictionaryRecordReader>(
+        descr, leaf_info, pool, std::move(unified_dictionary));
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(descr, leaf_info, pool);
   }
@@ -1773,9 +2172,9 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
 
 }  // namespace
 
-std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
-                                                 LevelInfo leaf_info, MemoryPool* pool,
-                                                 const bool read_dictionary) {
+std::shared_ptr<RecordReader> RecordReader::Make(
+    const ColumnDescriptor* descr, LevelInfo leaf_info, MemoryPool* pool,
+    const bool read_dictionary, std::shared_ptr<UnifiedDictionary> unified_dictionary) {
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, leaf_info, pool);
@@ -1790,7 +2189,8 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::DOUBLE:
       return std::make_shared<TypedRecordReader<DoubleType>>(descr, leaf_info, pool);
     case Type::BYTE_ARRAY:
-      return MakeByteArrayRecordReader(descr, leaf_info, pool, read_dictionary);
+      return MakeByteArrayRecordReader(descr, leaf_info, pool, read_dictionary,
+                                       std::move(unified_dictionary));
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<FLBARecordReader>(descr, leaf_info, pool);
     default: {
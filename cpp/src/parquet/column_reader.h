@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -31,6 +32,8 @@
 namespace arrow {
 
 class Array;
+struct ArrayData;
+class BinaryArray;
 class ChunkedArray;
 
 namespace BitUtil {
@@ -46,6 +49,7 @@ class RleDecoder;
 namespace parquet {
 
 class Decryptor;
+class EncodedStatistics;
 class Page;
 
 // 16 MB is the default maximum page header size
@@ -70,6 +74,12 @@ class PARQUET_EXPORT LevelDecoder {
   // Decodes a batch of levels into an array and returns the number of levels decoded
   int Decode(int batch_size, int16_t* levels);
 
+  // Decodes a batch of levels of max level 1 straight into a validity bitmap, with a
+  // set bit for each level of 1, and returns the number of levels decoded.
+  // null_count is set to the number of levels of 0.
+  int DecodeValidity(int batch_size, uint8_t* valid_bits, int64_t valid_bits_offset,
+                     int64_t* null_count);
+
  private:
   int bit_width_;
   int num_values_remaining_;
@@ -96,6 +106,20 @@ struct CryptoContext {
   std::shared_ptr<Decryptor> data_decryptor;
 };
 
+// What is known of a data page from its header, before it is decompressed
+struct DataPageStats {
+  DataPageStats(const EncodedStatistics* encoded_statistics, int32_t num_values)
+      : encoded_statistics(encoded_statistics), num_values(num_values) {}
+
+  // The statistics of the page, if it has any, or nullptr
+  const EncodedStatistics* encoded_statistics;
+  // The number of values in the page, including nulls
+  int32_t num_values;
+};
+
+// Returns true to skip the data page without decompressing it
+using DataPageFilter = std::function<bool(const DataPageStats&)>;
+
 // Abstract page iterator interface. This way, we can feed column pages to the
 // ColumnReader through whatever mechanism we choose
 class PARQUET_EXPORT PageReader {
@@ -107,11 +131,26 @@ class PARQUET_EXPORT PageReader {
       Compression::type codec, ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
       const CryptoContext* ctx = NULLPTR);
 
+  // Split an unencrypted column chunk, read whole into memory, into at most
+  // max_readers runs of consecutive data pages holding similar numbers of values.
+  // Each returned reader yields the dictionary page of the chunk, if any, followed
+  // by the data pages of its run, so that the runs can be decompressed and decoded
+  // concurrently by readers of their own. The number of values in each run is
+  // written to num_values.
+  static std::vector<std::unique_ptr<PageReader>> OpenSplit(
+      std::shared_ptr<Buffer> column_chunk, int64_t total_num_rows,
+      Compression::type codec, int max_readers, std::vector<int64_t>* num_values,
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool());
+
   // @returns: shared_ptr<Page>(nullptr) on EOS, std::shared_ptr<Page>
   // containing new Page otherwise
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  // Set a filter of the data pages to skip. Readers which cannot skip pages before
+  // decompressing them may ignore it.
+  virtual void set_data_page_filter(DataPageFilter data_page_filter) {}
 };
 
 class PARQUET_EXPORT ColumnReader {
@@ -248,6 +287,31 @@ class TypedColumnReader : public ColumnReader {
 
 namespace internal {
 
+/// \brief A dictionary accumulating the values of the column chunks of a BYTE_ARRAY
+/// column
+///
+/// It may be shared by several DictionaryRecordReaders, e.g. one per row group,
+/// including concurrently. Values are only ever appended, so each snapshot of the
+/// dictionary starts with the values of the previous ones.
+class PARQUET_EXPORT UnifiedDictionary {
+ public:
+  explicit UnifiedDictionary(::arrow::MemoryPool* pool = ::arrow::default_memory_pool());
+  ~UnifiedDictionary();
+
+  /// \brief Append the indices in the unified dictionary of values[start:] to
+  /// `indices`, inserting the values not seen yet
+  void Insert(const ::arrow::BinaryArray& values, int64_t start,
+              std::vector<int32_t>* indices);
+
+  /// \brief The values inserted so far. The same object is returned as long as no
+  /// value is inserted.
+  std::shared_ptr<::arrow::ArrayData> GetDictionary();
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// \brief Stateful column reader that delimits semantic records for both flat
 /// and nested columns
 ///
@@ -255,10 +319,13 @@ namespace internal {
 /// \since 1.3.0
 class RecordReader {
  public:
+  /// \param[in] unified_dictionary if read_dictionary, the dictionary which the
+  /// results index instead of the dictionary of each column chunk, if not null
   static std::shared_ptr<RecordReader> Make(
       const ColumnDescriptor* descr, LevelInfo leaf_info,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      const bool read_dictionary = false);
+      const bool read_dictionary = false,
+      std::shared_ptr<UnifiedDictionary> unified_dictionary = NULLPTR);
 
   virtual ~RecordReader() = default;
 
@@ -266,6 +333,14 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Skip the indicated number of records of a column without repetition.
+  ///
+  /// The data pages holding only skipped records are skipped before being
+  /// decompressed if the page reader supports it.
+  /// \return number of records skipped, which is smaller than requested at the
+  /// end of the column chunk
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
@@ -324,6 +399,13 @@ class RecordReader {
   /// \brief True if reading directly as Arrow dictionary-encoded
   bool read_dictionary() const { return read_dictionary_; }
 
+  /// \brief Set whether ReadRecords fills def_levels() and rep_levels()
+  ///
+  /// Disabling the levels lets columns without repetition and with a max
+  /// definition level of 1 decode their definition levels straight into the
+  /// validity bitmap. Must be called before reading records.
+  void set_read_levels(bool read_levels) { read_levels_ = read_levels; }
+
  protected:
   bool nullable_values_;
 
@@ -348,6 +430,7 @@ class RecordReader {
   std::shared_ptr<::arrow::ResizableBuffer> rep_levels_;
 
   bool read_dictionary_ = false;
+  bool read_levels_ = true;
 };
 
 class BinaryRecordReader : virtual public RecordReader {
@@ -357,6 +440,11 @@ class BinaryRecordReader : virtual public RecordReader {
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
 /// indices). Only valid for BYTE_ARRAY columns
+///
+/// Each column chunk has a dictionary of its own, unless the reader was made with a
+/// UnifiedDictionary. Then the results index a snapshot of it, which accumulates the
+/// values of all the column chunks read: each result's dictionary starts with the
+/// values of the previous result's, as a dictionary delta would.
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
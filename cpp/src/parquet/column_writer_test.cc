@@ -929,6 +929,47 @@ TEST(TestLevels, TestLevelsDecodeMultipleBitWidth) {
   }
 }
 
+TEST(TestLevels, TestLevelsDecodeValidity) {
+  std::vector<int16_t> input_levels;
+  GenerateLevels(/*min_repeat_factor=*/3, /*max_repeat_factor=*/7, /*max_level=*/1,
+                 input_levels);
+  for (int i = 0; i < 100; ++i) {
+    input_levels.push_back(static_cast<int16_t>(i % 3 == 0));
+  }
+  const int num_levels = static_cast<int>(input_levels.size());
+
+  for (const auto encoding : {Encoding::RLE, Encoding::BIT_PACKED}) {
+    std::vector<uint8_t> bytes;
+    ASSERT_NO_FATAL_FAILURE(
+        EncodeLevels(encoding, /*max_level=*/1, num_levels, input_levels.data(), bytes));
+
+    LevelDecoder decoder;
+    decoder.SetData(encoding, /*max_level=*/1, num_levels, bytes.data(),
+                    static_cast<int32_t>(bytes.size()));
+    // Decode at a bitmap offset which isn't a multiple of 8
+    std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(num_levels + 5));
+    int levels_read = 0;
+    int64_t total_null_count = 0;
+    while (levels_read < num_levels) {
+      int64_t null_count = 0;
+      const int batch_size = std::min(13, num_levels - levels_read);
+      ASSERT_EQ(batch_size, decoder.DecodeValidity(batch_size, valid_bits.data(),
+                                                   levels_read + 5, &null_count));
+      total_null_count += null_count;
+      levels_read += batch_size;
+    }
+    int64_t null_count = 0;
+    ASSERT_EQ(0, decoder.DecodeValidity(1, valid_bits.data(), 0, &null_count));
+
+    int64_t expected_null_count = 0;
+    for (int i = 0; i < num_levels; ++i) {
+      ASSERT_EQ(input_levels[i] == 1, BitUtil::GetBit(valid_bits.data(), i + 5)) << i;
+      expected_null_count += input_levels[i] == 0;
+    }
+    ASSERT_EQ(expected_null_count, total_null_count);
+  }
+}
+
 // Test multiple decoder SetData calls
 TEST(TestLevels, TestLevelsDecodeMultipleSetData) {
   int min_repeat_factor = 3;
@@ -26,7 +26,10 @@
 #include "arrow/type.h"
 #include "arrow/util/byte_stream_split.h"
 
+#include "parquet/column_reader.h"
+#include "parquet/column_writer.h"
 #include "parquet/encoding.h"
+#include "parquet/level_conversion.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
@@ -319,6 +322,73 @@ static void BM_PlainDecodingSpacedDouble(benchmark::State& state) {
 }
 BENCHMARK(BM_PlainDecodingSpacedDouble)->Apply(BM_PlainSpacedArgs);
 
+// RLE-encode random definition levels of an optional, non-nested column
+static std::vector<uint8_t> EncodeDefLevels(int num_levels, double null_percent) {
+  auto rand = ::arrow::random::RandomArrayGenerator(1923);
+  const auto array = std::static_pointer_cast<::arrow::BooleanArray>(
+      rand.Boolean(num_levels, /*true_probability=*/1.0 - null_percent,
+                   /*null_probability=*/0.0));
+  std::vector<int16_t> levels(num_levels);
+  for (int i = 0; i < num_levels; ++i) {
+    levels[i] = array->Value(i) ? 1 : 0;
+  }
+
+  std::vector<uint8_t> encoded(
+      LevelEncoder::MaxBufferSize(Encoding::RLE, /*max_level=*/1, num_levels));
+  LevelEncoder encoder;
+  encoder.Init(Encoding::RLE, /*max_level=*/1, num_levels, encoded.data(),
+               static_cast<int>(encoded.size()));
+  encoder.Encode(num_levels, levels.data());
+  encoded.resize(encoder.len());
+  return encoded;
+}
+
+static void BM_DefLevelsDecodeToBitmap(benchmark::State& state) {
+  const int num_levels = static_cast<int>(state.range(0));
+  const double null_percent = static_cast<double>(state.range(1)) / 10000.0;
+  const auto encoded = EncodeDefLevels(num_levels, null_percent);
+
+  LevelDecoder decoder;
+  std::vector<int16_t> levels(num_levels);
+  std::vector<uint8_t> valid_bits(::arrow::BitUtil::BytesForBits(num_levels));
+  for (auto _ : state) {
+    decoder.SetDataV2(static_cast<int32_t>(encoded.size()), /*max_level=*/1, num_levels,
+                      encoded.data());
+    decoder.Decode(num_levels, levels.data());
+    internal::ValidityBitmapInputOutput io;
+    io.values_read_upper_bound = num_levels;
+    io.valid_bits = valid_bits.data();
+    internal::DefLevelsToBitmap(levels.data(), num_levels,
+                                internal::LevelInfo(/*null_slots=*/1, /*def_level=*/1,
+                                                    /*rep_level=*/0,
+                                                    /*repeated_ancestor_def_level=*/0),
+                                &io);
+    benchmark::DoNotOptimize(io.null_count);
+  }
+  state.counters["null_percent"] = null_percent * 100;
+  state.SetItemsProcessed(state.iterations() * num_levels);
+}
+BENCHMARK(BM_DefLevelsDecodeToBitmap)->Apply(BM_PlainSpacedArgs);
+
+static void BM_DefLevelsDecodeValidity(benchmark::State& state) {
+  const int num_levels = static_cast<int>(state.range(0));
+  const double null_percent = static_cast<double>(state.range(1)) / 10000.0;
+  const auto encoded = EncodeDefLevels(num_levels, null_percent);
+
+  LevelDecoder decoder;
+  std::vector<uint8_t> valid_bits(::arrow::BitUtil::BytesForBits(num_levels));
+  for (auto _ : state) {
+    decoder.SetDataV2(static_cast<int32_t>(encoded.size()), /*max_level=*/1, num_levels,
+                      encoded.data());
+    int64_t null_count = 0;
+    decoder.DecodeValidity(num_levels, valid_bits.data(), 0, &null_count);
+    benchmark::DoNotOptimize(null_count);
+  }
+  state.counters["null_percent"] = null_percent * 100;
+  state.SetItemsProcessed(state.iterations() * num_levels);
+}
+BENCHMARK(BM_DefLevelsDecodeValidity)->Apply(BM_PlainSpacedArgs);
+
 template <typename T, typename DecodeFunc>
 static void BM_ByteStreamSplitDecode(benchmark::State& state, DecodeFunc&& decode_func) {
   std::vector<T> values(state.range(0), 64.0);
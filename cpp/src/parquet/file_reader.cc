@@ -126,6 +126,26 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::vector<std::unique_ptr<PageReader>>
+RowGroupReader::Contents::GetColumnPageReaders(int i, int max_readers,
+                                               std::vector<int64_t>* num_values) {
+  num_values->assign(1, metadata()->ColumnChunk(i)->num_values());
+  std::vector<std::unique_ptr<PageReader>> readers;
+  readers.push_back(GetColumnPageReader(i));
+  return readers;
+}
+
+std::vector<std::unique_ptr<PageReader>> RowGroupReader::GetColumnPageReaders(
+    int i, int max_readers, std::vector<int64_t>* num_values) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnPageReaders(i, max_readers, num_values);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -247,6 +267,28 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                             properties_.memory_pool(), &ctx);
   }
 
+  std::vector<std::unique_ptr<PageReader>> GetColumnPageReaders(
+      int i, int max_readers, std::vector<int64_t>* num_values) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (max_readers <= 1 || col->crypto_metadata()) {
+      // Page decryption depends on the ordinal of the page in the column chunk
+      return Contents::GetColumnPageReaders(i, max_readers, num_values);
+    }
+
+    // The pages are located by parsing their headers, so read the whole column chunk
+    ::arrow::io::ReadRange col_range =
+        ComputeColumnChunkRange(file_metadata_, source_size_, row_group_ordinal_, i);
+    std::shared_ptr<Buffer> buffer;
+    if (cached_source_) {
+      PARQUET_ASSIGN_OR_THROW(buffer, cached_source_->Read(col_range));
+    } else {
+      PARQUET_ASSIGN_OR_THROW(buffer,
+                              source_->ReadAt(col_range.offset, col_range.length));
+    }
+    return PageReader::OpenSplit(std::move(buffer), col->num_values(), col->compression(),
+                                 max_readers, num_values, properties_.memory_pool());
+  }
+
  private:
   std::shared_ptr<ArrowInputFile> source_;
   // Will be nullptr if PreBuffer() is not called.
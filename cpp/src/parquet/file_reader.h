@@ -43,6 +43,8 @@ class PARQUET_EXPORT RowGroupReader {
   struct Contents {
     virtual ~Contents() {}
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
+    virtual std::vector<std::unique_ptr<PageReader>> GetColumnPageReaders(
+        int i, int max_readers, std::vector<int64_t>* num_values);
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
   };
@@ -72,6 +74,15 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Construct page readers over at most max_readers runs of consecutive pages of
+  // the indicated column, which can be decoded concurrently and yield the values
+  // of the column chunk when concatenated in order. The number of values in each
+  // run is written to num_values. Encrypted column chunks are not split.
+  //
+  // \note API EXPERIMENTAL
+  std::vector<std::unique_ptr<PageReader>> GetColumnPageReaders(
+      int i, int max_readers, std::vector<int64_t>* num_values);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
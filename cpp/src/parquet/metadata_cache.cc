@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/metadata_cache.h"
+
+#include <utility>
+
+#include "arrow/util/hash_util.h"
+#include "parquet/metadata.h"
+
+namespace parquet {
+
+constexpr int64_t FileMetaDataCache::kDefaultCapacityBytes;
+
+std::size_t FileMetaDataCache::IdentityHash::operator()(const FileIdentity& file) const {
+  std::size_t h = std::hash<std::string>()(file.path);
+  ::arrow::internal::hash_combine(h, file.size);
+  ::arrow::internal::hash_combine(h, file.mtime_ns);
+  ::arrow::internal::hash_combine(h, file.etag);
+  return h;
+}
+
+FileMetaDataCache::FileMetaDataCache(int64_t capacity_bytes)
+    : capacity_bytes_(capacity_bytes) {}
+
+const std::shared_ptr<FileMetaDataCache>& FileMetaDataCache::Default() {
+  static std::shared_ptr<FileMetaDataCache> cache =
+      std::make_shared<FileMetaDataCache>();
+  return cache;
+}
+
+std::shared_ptr<FileMetaData> FileMetaDataCache::Get(const FileIdentity& file) {
+  auto lock = mutex_.Lock();
+  auto it = index_.find(file);
+  if (it == index_.end()) {
+    ++stats_.misses;
+    return nullptr;
+  }
+  ++stats_.hits;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return it->second->metadata;
+}
+
+void FileMetaDataCache::Put(const FileIdentity& file,
+                            std::shared_ptr<FileMetaData> metadata) {
+  const int64_t size = metadata->size();
+  auto lock = mutex_.Lock();
+  if (size > capacity_bytes_) {
+    return;
+  }
+  auto it = index_.find(file);
+  if (it != index_.end()) {
+    // Another reader parsed the same footer concurrently
+    stats_.size_bytes -= it->second->size;
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+  EvictLocked(capacity_bytes_ - size);
+  entries_.push_front(Entry{file, std::move(metadata), size});
+  index_.emplace(file, entries_.begin());
+  stats_.size_bytes += size;
+}
+
+void FileMetaDataCache::Clear() {
+  auto lock = mutex_.Lock();
+  entries_.clear();
+  index_.clear();
+  stats_.size_bytes = 0;
+}
+
+void FileMetaDataCache::SetCapacity(int64_t capacity_bytes) {
+  auto lock = mutex_.Lock();
+  capacity_bytes_ = capacity_bytes;
+  EvictLocked(capacity_bytes_);
+}
+
+int64_t FileMetaDataCache::capacity() const {
+  auto lock = mutex_.Lock();
+  return capacity_bytes_;
+}
+
+FileMetaDataCache::Stats FileMetaDataCache::stats() const {
+  auto lock = mutex_.Lock();
+  Stats stats = stats_;
+  stats.num_entries = static_cast<int64_t>(entries_.size());
+  return stats;
+}
+
+void FileMetaDataCache::EvictLocked(int64_t capacity_bytes) {
+  while (!entries_.empty() && stats_.size_bytes > capacity_bytes) {
+    const Entry& entry = entries_.back();
+    stats_.size_bytes -= entry.size;
+    index_.erase(entry.file);
+    entries_.pop_back();
+    ++stats_.evictions;
+  }
+}
+
+}  // namespace parquet
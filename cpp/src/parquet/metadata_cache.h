@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "arrow/util/mutex.h"
+#include "parquet/platform.h"
+#include "parquet/type_fwd.h"
+
+namespace parquet {
+
+/// \brief The identity of a version of a file, under which its footer is cached.
+///
+/// A file rewritten in place gets a new size or modification time (or ETag, for
+/// object stores which expose one), so stale footers are never returned.
+struct PARQUET_EXPORT FileIdentity {
+  /// \brief The path of the file, qualified by its filesystem if needed
+  std::string path;
+  /// \brief The size of the file in bytes
+  int64_t size = -1;
+  /// \brief The modification time of the file, in nanoseconds since the epoch
+  int64_t mtime_ns = -1;
+  /// \brief An entity tag for the content of the file, if known
+  std::string etag;
+
+  bool operator==(const FileIdentity& other) const {
+    return path == other.path && size == other.size && mtime_ns == other.mtime_ns &&
+           etag == other.etag;
+  }
+};
+
+/// \brief A size-bounded, least recently used cache of parsed file footers.
+///
+/// The size of an entry is the size of its thrift-encoded footer, which is roughly
+/// proportional to the memory held by the parsed FileMetaData. The cache is safe to
+/// share between threads; Default() returns the one shared by the whole process.
+class PARQUET_EXPORT FileMetaDataCache {
+ public:
+  struct Stats {
+    /// \brief The number of lookups which found a footer
+    int64_t hits = 0;
+    /// \brief The number of lookups which did not find a footer
+    int64_t misses = 0;
+    /// \brief The number of footers dropped to make room for new ones
+    int64_t evictions = 0;
+    /// \brief The number of footers currently held
+    int64_t num_entries = 0;
+    /// \brief The total size of the footers currently held, in bytes
+    int64_t size_bytes = 0;
+  };
+
+  static constexpr int64_t kDefaultCapacityBytes = 64 << 20;
+
+  explicit FileMetaDataCache(int64_t capacity_bytes = kDefaultCapacityBytes);
+
+  /// \brief The cache shared by the whole process.
+  static const std::shared_ptr<FileMetaDataCache>& Default();
+
+  /// \brief Return the footer cached for the file, or null (a miss).
+  std::shared_ptr<FileMetaData> Get(const FileIdentity& file);
+
+  /// \brief Cache the footer of the file, evicting the least recently used ones as
+  /// needed. Footers larger than the whole capacity are not cached.
+  void Put(const FileIdentity& file, std::shared_ptr<FileMetaData> metadata);
+
+  /// \brief Drop all the cached footers. The statistics are kept.
+  void Clear();
+
+  /// \brief Change the capacity, evicting footers if it shrinks.
+  void SetCapacity(int64_t capacity_bytes);
+
+  int64_t capacity() const;
+
+  Stats stats() const;
+
+ private:
+  struct IdentityHash {
+    std::size_t operator()(const FileIdentity& file) const;
+  };
+  struct Entry {
+    FileIdentity file;
+    std::shared_ptr<FileMetaData> metadata;
+    int64_t size;
+  };
+  using EntryList = std::list<Entry>;
+
+  void EvictLocked(int64_t capacity_bytes);
+
+  mutable ::arrow::util::Mutex mutex_;
+  int64_t capacity_bytes_;
+  Stats stats_;
+  // In most to least recently used order
+  EntryList entries_;
+  std::unordered_map<FileIdentity, EntryList::iterator, IdentityHash> index_;
+};
+
+}  // namespace parquet
@@ -19,7 +19,9 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/io/memory.h"
 #include "arrow/util/key_value_metadata.h"
+#include "parquet/metadata_cache.h"
 #include "parquet/schema.h"
 #include "parquet/statistics.h"
 #include "parquet/thrift_internal.h"
@@ -292,6 +294,65 @@ TEST(Metadata, TestKeyValueMetadata) {
   EXPECT_TRUE(f_accessor->key_value_metadata()->Equals(*kvmeta));
 }
 
+TEST(Metadata, TestFileMetaDataCache) {
+  parquet::schema::NodeVector fields;
+  parquet::SchemaDescriptor schema;
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+
+  // The cache is bounded by the size of the serialized footers, so round-trip one
+  auto sink = CreateOutputStream();
+  FileMetaDataBuilder::Make(&schema, default_writer_properties())
+      ->Finish()
+      ->WriteTo(sink.get());
+  auto buffer = sink->Finish().ValueOrDie();
+  uint32_t metadata_len = static_cast<uint32_t>(buffer->size());
+  std::shared_ptr<FileMetaData> metadata =
+      FileMetaData::Make(buffer->data(), &metadata_len);
+  const int64_t size = metadata->size();
+  ASSERT_GT(size, 0);
+
+  auto make_identity = [](const std::string& path, int64_t mtime_ns) {
+    FileIdentity identity;
+    identity.path = path;
+    identity.size = 1000;
+    identity.mtime_ns = mtime_ns;
+    return identity;
+  };
+  const FileIdentity a = make_identity("a", 1), b = make_identity("b", 1),
+                     c = make_identity("c", 1), rewritten_a = make_identity("a", 2);
+
+  FileMetaDataCache cache(/*capacity_bytes=*/2 * size + size / 2);
+  ASSERT_EQ(cache.Get(a), nullptr);
+  cache.Put(a, metadata);
+  cache.Put(b, metadata);
+  ASSERT_EQ(cache.Get(a), metadata);
+  ASSERT_EQ(cache.Get(rewritten_a), nullptr);
+
+  // b is the least recently used
+  cache.Put(c, metadata);
+  ASSERT_EQ(cache.Get(b), nullptr);
+  ASSERT_EQ(cache.Get(c), metadata);
+
+  auto stats = cache.stats();
+  ASSERT_EQ(stats.hits, 2);
+  ASSERT_EQ(stats.misses, 3);
+  ASSERT_EQ(stats.evictions, 1);
+  ASSERT_EQ(stats.num_entries, 2);
+  ASSERT_EQ(stats.size_bytes, 2 * size);
+
+  cache.SetCapacity(size);
+  ASSERT_EQ(cache.Get(c), metadata);
+  ASSERT_EQ(cache.Get(a), nullptr);
+  ASSERT_EQ(cache.stats().evictions, 2);
+
+  // Too large to cache at all
+  cache.SetCapacity(size - 1);
+  cache.Put(a, metadata);
+  ASSERT_EQ(cache.stats().num_entries, 0);
+  ASSERT_EQ(cache.stats().size_bytes, 0);
+}
+
 TEST(ApplicationVersion, Basics) {
   ApplicationVersion version("parquet-mr version 1.7.9");
   ApplicationVersion version1("parquet-mr version 1.8.0");
@@ -555,6 +555,9 @@ static constexpr bool kArrowDefaultUseThreads = false;
 // Default number of rows to read when using ::arrow::RecordBatchReader
 static constexpr int64_t kArrowDefaultBatchSize = 64 * 1024;
 
+// Default uncompressed size of the column chunk share decoded by a thread
+static constexpr int64_t kArrowDefaultColumnChunkSplitSize = 64 * 1024 * 1024;
+
 /// EXPERIMENTAL: Properties for configuring FileReader behavior.
 class PARQUET_EXPORT ArrowReaderProperties {
  public:
@@ -563,6 +566,8 @@ class PARQUET_EXPORT ArrowReaderProperties {
         read_dict_indices_(),
         batch_size_(kArrowDefaultBatchSize),
         pre_buffer_(false),
+        column_chunk_split_size_(kArrowDefaultColumnChunkSplitSize),
+        unify_dictionaries_(false),
         cache_options_(::arrow::io::CacheOptions::Defaults()),
         coerce_int96_timestamp_unit_(::arrow::TimeUnit::NANO) {}
 
@@ -598,6 +603,29 @@ class PARQUET_EXPORT ArrowReaderProperties {
 
   bool pre_buffer() const { return pre_buffer_; }
 
+  /// Set the uncompressed size above which a column chunk is split into runs of
+  /// pages which are decompressed and decoded in parallel, each run covering about
+  /// this many bytes.
+  ///
+  /// Only applies when use_threads is enabled, to column chunks of top-level
+  /// columns without repetition which are read whole. Each run becomes a chunk of
+  /// its own in the result. Zero disables the splitting.
+  void set_column_chunk_split_size(int64_t size) { column_chunk_split_size_ = size; }
+
+  int64_t column_chunk_split_size() const { return column_chunk_split_size_; }
+
+  /// Unify the dictionaries of the column chunks of the columns read as
+  /// dictionaries (see set_read_dictionary).
+  ///
+  /// When enabled, the values read from a column by a FileReader all index a single
+  /// dictionary, which grows as new values are found: reading a whole file yields
+  /// one dictionary per column, and the dictionary of each batch read starts with
+  /// the values of the previous batch's, so that batches may be written with
+  /// dictionary deltas. The column chunks of these columns are not split.
+  void set_unify_dictionaries(bool unify) { unify_dictionaries_ = unify; }
+
+  bool unify_dictionaries() const { return unify_dictionaries_; }
+
   /// Set options for read coalescing. This can be used to tune the
   /// implementation for characteristics of different filesystems.
   void set_cache_options(::arrow::io::CacheOptions options) { cache_options_ = options; }
@@ -624,6 +652,8 @@ class PARQUET_EXPORT ArrowReaderProperties {
   std::unordered_set<int> read_dict_indices_;
   int64_t batch_size_;
   bool pre_buffer_;
+  int64_t column_chunk_split_size_;
+  bool unify_dictionaries_;
   ::arrow::io::IOContext io_context_;
   ::arrow::io::CacheOptions cache_options_;
   ::arrow::TimeUnit::type coerce_int96_timestamp_unit_;